@@ -535,6 +535,10 @@ SOURCE=.\src\base\cmd\cmdAuto.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\cmd\cmdBench.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\cmd\cmdFlag.c
 # End Source File
 # Begin Source File
@@ -719,6 +723,10 @@ SOURCE=.\src\base\main\mainFrame.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\main\mainDaemon.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\main\mainInit.c
 # End Source File
 # Begin Source File
@@ -1323,6 +1331,10 @@ SOURCE=.\src\bdd\llb\llb4Nonlin.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\bdd\llb\llb4Par.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\bdd\llb\llb4Sweep.c
 # End Source File
 # Begin Source File
@@ -1983,6 +1995,10 @@ SOURCE=.\src\sat\cnf\cnfPost.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\cnf\cnfStream.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\cnf\cnfUtil.c
 # End Source File
 # Begin Source File
@@ -2175,6 +2191,14 @@ SOURCE=.\src\sat\satoko\utils\misc.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\sat\satoko\portfolio.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\sat\satoko\portfolio.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\sat\satoko\satoko.h
 # End Source File
 # Begin Source File
@@ -2975,6 +2999,10 @@ SOURCE=.\src\opt\dar\darMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dar\darPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dar\darPrec.c
 # End Source File
 # Begin Source File
@@ -3095,6 +3123,10 @@ SOURCE=.\src\opt\dau\dau.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\dau\dauCache.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\dau\dauCanon.c
 # End Source File
 # Begin Source File
@@ -3187,6 +3219,10 @@ SOURCE=.\src\opt\sfm\sfmNtk.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\opt\sfm\sfmPar.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\opt\sfm\sfmSat.c
 # End Source File
 # Begin Source File
@@ -4127,6 +4163,10 @@ SOURCE=.\src\misc\util\utilNam.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilPth.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSignal.c
 # End Source File
 # Begin Source File
@@ -4135,6 +4175,14 @@ SOURCE=.\src\misc\util\utilSignal.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilSimd.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilSort.c
 # End Source File
 # Begin Source File
@@ -5277,6 +5325,10 @@ SOURCE=.\src\aig\gia\giaUnate.c
 
 SOURCE=.\src\aig\gia\giaUtil.c
 # End Source File
+# Begin Source File
+
+SOURCE=.\src\aig\gia\giaZip.c
+# End Source File
 # End Group
 # Begin Group "miniaig"
 
@@ -5927,6 +5979,10 @@ SOURCE=.\src\proof\pdr\pdrMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\pdr\pdrPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\pdr\pdrSat.c
 # End Source File
 # Begin Source File
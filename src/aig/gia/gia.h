@@ -64,6 +64,17 @@ struct Gia_Rpr_t_
     unsigned       fColorB :  1;  // marks cone of B
 };
 
+typedef struct Gia_Fan_t_ Gia_Fan_t;
+struct Gia_Fan_t_
+{
+    int            nObjs;         // the number of indexed objects
+    int            nEdges;        // the number of fanout edges
+    unsigned *     pOffsets;      // the first fanout of each object (nObjs+1 entries)
+    int *          pFanouts;      // fanout IDs of each object in increasing order
+    char *         pMemOffsets;   // unaligned memory for the offsets
+    char *         pMemFanouts;   // unaligned memory for the fanouts
+};
+
 typedef struct Gia_Plc_t_ Gia_Plc_t;
 struct Gia_Plc_t_
 {
@@ -92,6 +103,22 @@ struct Gia_Obj_t_
 // - pointer to the next node in the hash table during structural hashing
 // - pointer to the node copy during duplication 
 
+typedef struct Gia_Zip_t_ Gia_Zip_t;
+struct Gia_Zip_t_
+{
+    int            nBlockLog;     // the number of objects in a block (log2)
+    int            nCacheLog;     // the number of decoded blocks kept (log2)
+    int            nCis;          // the number of CIs encoded so far
+    int            nCos;          // the number of COs encoded so far
+    int            nObjs;         // the number of objects encoded so far
+    word           nBytes;        // the number of bytes in the encoded blocks
+    word           nLoads;        // the number of decoded blocks
+    Vec_Ptr_t *    vBlocks;       // the encoded blocks
+    Vec_Str_t *    vBlock;        // the block being encoded
+    int *          pCacheIds;     // the block decoded in each cache line
+    Gia_Obj_t *    pCache;        // the decoded objects
+};
+
 // new AIG manager
 typedef struct Gia_Man_t_ Gia_Man_t;
 struct Gia_Man_t_
@@ -109,8 +136,9 @@ struct Gia_Man_t_
     int            nBufs;         // the number of buffers
     Vec_Int_t *    vCis;          // the vector of CIs (PIs + LOs)
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
-    Vec_Int_t      vHash;         // hash links
+    Vec_Int_t      vHash;         // old hash table while resizing
     Vec_Int_t      vHTable;       // hash table
+    int            iHashMove;     // the next slot of the old table to be moved
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -133,6 +161,7 @@ struct Gia_Man_t_
     int            nFansAlloc;    // the size of fanout representation
     Vec_Int_t *    vFanoutNums;   // static fanout
     Vec_Int_t *    vFanout;       // static fanout
+    Gia_Zip_t *    pZip;          // compressed objects (pObjs is NULL when used)
     Vec_Int_t *    vMapping;      // mapping for each node
     Vec_Wec_t *    vMapping2;     // mapping for each node
     Vec_Wec_t *    vFanouts2;     // mapping fanouts 
@@ -193,6 +222,7 @@ struct Gia_Man_t_
     Vec_Flt_t *    vTiming;       // arrival/required/slack
     void *         pManTime;      // the timing manager
     void *         pLutLib;       // LUT library
+    void *         pCutDb;        // persistent cut database
     word           nHashHit;      // hash table hit
     word           nHashMiss;     // hash table miss
     void *         pData;         // various user data
@@ -468,7 +498,7 @@ static inline int          Gia_ManChoiceNum( Gia_Man_t * p )   { int c = 0; if (
 
 static inline Gia_Obj_t *  Gia_ManConst0( Gia_Man_t * p )      { return p->pObjs;                                                          }
 static inline Gia_Obj_t *  Gia_ManConst1( Gia_Man_t * p )      { return Gia_Not(Gia_ManConst0(p));                                         }
-static inline Gia_Obj_t *  Gia_ManObj( Gia_Man_t * p, int v )  { assert( v >= 0 && v < p->nObjs ); return p->pObjs + v;                    }
+static inline Gia_Obj_t *  Gia_ManObj( Gia_Man_t * p, int v )  { assert( v >= 0 && v < p->nObjs && p->pObjs ); return p->pObjs + v;       }
 static inline Gia_Obj_t *  Gia_ManCi( Gia_Man_t * p, int v )   { return Gia_ManObj( p, Vec_IntEntry(p->vCis,v) );                          }
 static inline Gia_Obj_t *  Gia_ManCo( Gia_Man_t * p, int v )   { return Gia_ManObj( p, Vec_IntEntry(p->vCos,v) );                          }
 static inline Gia_Obj_t *  Gia_ManPi( Gia_Man_t * p, int v )   { assert( v < Gia_ManPiNum(p) );  return Gia_ManCi( p, v );                 }
@@ -675,7 +705,6 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
         }
         p->nObjsAlloc = nObjNew;
     }
-    if ( Vec_IntSize(&p->vHTable) ) Vec_IntPush( &p->vHash, 0 );
     return Gia_ManObj( p, p->nObjs++ );
 }
 static inline int Gia_ManAppendCi( Gia_Man_t * p )  
@@ -1106,6 +1135,35 @@ static inline void        Gia_ObjSetFanoutInt( Gia_Man_t * p, Gia_Obj_t * pObj,
 #define Gia_ObjForEachFanoutStaticId( p, Id, FanId, i )      \
     for ( i = 0; (i < Gia_ObjFanoutNumId(p, Id))   && (((FanId) = Gia_ObjFanoutId(p, Id, i)), 1); i++ )
 
+static inline int         Gia_FanNum( Gia_Fan_t * f, int Id )                      { return (int)(f->pOffsets[Id+1] - f->pOffsets[Id]);                       }
+static inline int *       Gia_FanArray( Gia_Fan_t * f, int Id )                    { return f->pFanouts + f->pOffsets[Id];                                     }
+static inline int         Gia_FanId( Gia_Fan_t * f, int Id, int i )                { assert( i < Gia_FanNum(f, Id) ); return Gia_FanArray(f, Id)[i];           }
+
+#define Gia_FanForEachFanoutId( f, Id, FanId, i )            \
+    for ( i = 0; (i < Gia_FanNum(f, Id)) && (((FanId) = Gia_FanId(f, Id, i)), 1); i++ )
+
+extern void Gia_ManZipLoad( Gia_Man_t * p, int iBlock, int iLine );
+
+static inline int         Gia_ManIsZipped( Gia_Man_t * p )                      { return p->pZip != NULL;                                                    }
+static inline Gia_Obj_t * Gia_ManZipObj( Gia_Man_t * p, int v )
+{
+    Gia_Zip_t * z = p->pZip;
+    int iBlock = v >> z->nBlockLog;
+    int iLine = iBlock & ((1 << z->nCacheLog) - 1);
+    assert( v >= 0 && v < p->nObjs );
+    if ( z->pCacheIds[iLine] != iBlock )
+        Gia_ManZipLoad( p, iBlock, iLine );
+    return z->pCache + ((iLine << z->nBlockLog) | (v & ((1 << z->nBlockLog) - 1)));
+}
+
+// the returned object stays valid until the next call; fanins are accessed by ID
+#define Gia_ManZipForEachObj( p, pObj, i )                   \
+    for ( i = 0; (i < p->nObjs) && ((pObj) = Gia_ManZipObj(p, i)); i++ )
+#define Gia_ManZipForEachAnd( p, pObj, i )                   \
+    for ( i = 0; (i < p->nObjs) && ((pObj) = Gia_ManZipObj(p, i)); i++ ) if ( !Gia_ObjIsAnd(pObj) ) {} else
+#define Gia_ManZipForEachCo( p, pObj, i )                    \
+    for ( i = 0; (i < Vec_IntSize(p->vCos)) && ((pObj) = Gia_ManZipObj(p, Vec_IntEntry(p->vCos, i))); i++ )
+
 static inline int         Gia_ManHasMapping( Gia_Man_t * p )                { return p->vMapping != NULL;                                                   }
 static inline int         Gia_ObjIsLut( Gia_Man_t * p, int Id )             { return Vec_IntEntry(p->vMapping, Id) != 0;                                    }
 static inline int         Gia_ObjLutSize( Gia_Man_t * p, int Id )           { return Vec_IntEntry(p->vMapping, Vec_IntEntry(p->vMapping, Id));              }
@@ -1236,8 +1294,8 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 ////////////////////////////////////////////////////////////////////////
 
 /*=== giaAiger.c ===========================================================*/
-extern int                 Gia_FileSize( char * pFileName );
-extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern size_t              Gia_FileSize( char * pFileName );
+extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
@@ -1280,6 +1338,15 @@ extern void                Gia_ManPrintFanio( Gia_Man_t * pGia, int nNodes );
 extern Gia_Man_t *         Gia_ManDupCof( Gia_Man_t * p, int iVar );
 extern Gia_Man_t *         Gia_ManDupCofAllInt( Gia_Man_t * p, Vec_Int_t * vSigs, int fVerbose );
 extern Gia_Man_t *         Gia_ManDupCofAll( Gia_Man_t * p, int nFanLim, int fVerbose );
+/*=== giaCut.c ============================================================*/
+extern void                Gia_ManCutDbStart( Gia_Man_t * p, int nCutSize, int nCutNum, int fVerbose );
+extern void                Gia_ManCutDbStop( Gia_Man_t * p );
+extern void                Gia_ManCutDbTransfer( Gia_Man_t * pNew, Gia_Man_t * pOld );
+extern void                Gia_ManCutDbUpdate( Gia_Man_t * p );
+extern void                Gia_ManCutDbPrintStats( Gia_Man_t * p );
+extern int                 Gia_ManCutDbCutSize( Gia_Man_t * p );
+extern int *               Gia_ManCutDbCutSet( Gia_Man_t * p, int iObj );
+extern word *              Gia_ManCutDbTruth( Gia_Man_t * p, int iFunc );
 /*=== giaDecs.c ============================================================*/
 extern int                 Gia_ResubVarNum( Vec_Int_t * vResub );
 extern word                Gia_ResubToTruth6( Vec_Int_t * vResub );
@@ -1412,6 +1479,7 @@ extern Gia_Man_t *         Gia_ManSpecReduceInitFrames( Gia_Man_t * p, Abc_Cex_t
 extern void                Gia_ManEquivTransform( Gia_Man_t * p, int fVerbose );
 extern void                Gia_ManEquivImprove( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManEquivToChoices( Gia_Man_t * p, int nSnapshots );
+extern Gia_Man_t *         Gia_ManEquivToSibls( Gia_Man_t * p );
 extern int                 Gia_ManCountChoiceNodes( Gia_Man_t * p );
 extern int                 Gia_ManCountChoices( Gia_Man_t * p );
 extern int                 Gia_ManFilterEquivsForSpeculation( Gia_Man_t * pGia, char * pName1, char * pName2, int fLatchA, int fLatchB );
@@ -1429,7 +1497,11 @@ extern void                Gia_ObjRemoveFanout( Gia_Man_t * p, Gia_Obj_t * pObj,
 extern void                Gia_ManFanoutStart( Gia_Man_t * p );
 extern void                Gia_ManFanoutStop( Gia_Man_t * p );
 extern void                Gia_ManStaticFanoutStart( Gia_Man_t * p );
+extern void                Gia_ManStaticFanoutStartPar( Gia_Man_t * p, int nProcs );
 extern void                Gia_ManStaticFanoutStop( Gia_Man_t * p );
+extern Gia_Fan_t *         Gia_ManFanIndexStart( Gia_Man_t * p, int nProcs );
+extern void                Gia_ManFanIndexStop( Gia_Fan_t * f );
+extern void                Gia_ManFanIndexCollectTfo( Gia_Man_t * p, Gia_Fan_t * f, int * pRoots, int nRoots, Vec_Int_t * vTfo );
 extern void                Gia_ManStaticMappingFanoutStart( Gia_Man_t * p );
 /*=== giaForce.c =========================================================*/
 extern void                For_ManExperiment( Gia_Man_t * pGia, int nIters, int fClustered, int fVerbose );
@@ -1686,6 +1758,17 @@ extern void                Gia_ObjComputeTruthTableStop( Gia_Man_t * p );
 extern word *              Gia_ObjComputeTruthTableCut( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vLeaves );
 /*=== giaTsim.c ============================================================*/
 extern Gia_Man_t *         Gia_ManReduceConst( Gia_Man_t * pAig, int fVerbose );
+/*=== giaZip.c ============================================================*/
+extern int                 Gia_ManZip( Gia_Man_t * p, int nBlockLog, int nCacheLog, int fVerbose );
+extern void                Gia_ManUnzip( Gia_Man_t * p );
+extern void                Gia_ManZipStop( Gia_Man_t * p );
+extern Gia_Man_t *         Gia_ManZipReadAiger( char * pFileName, int nBlockLog, int nCacheLog, int fVerbose );
+extern double              Gia_ManZipMemory( Gia_Man_t * p );
+extern int                 Gia_ManZipLevelNum( Gia_Man_t * p, float * pLevelAve );
+extern void                Gia_ManZipPrintStats( Gia_Man_t * p, Gps_Par_t * pPars );
+extern int                 Gia_ManZipWriteAiger( Gia_Man_t * p, char * pFileName, int fWriteNewLine );
+extern int                 Gia_ManZipWriteCnf( Gia_Man_t * p, char * pFileName, int fVerbose );
+extern int                 Gia_ManZipSimulate( Gia_Man_t * p, int nFrames, int nWords, int nSeed, int fVerbose );
 /*=== giaUtil.c ===========================================================*/
 extern unsigned            Gia_ManRandom( int fReset );
 extern word                Gia_ManRandomW( int fReset );
@@ -578,21 +578,21 @@ void Gia_ManReprFromAigRepr2( Aig_Man_t * pAig, Gia_Man_t * pGia )
 
   Synopsis    [Applies DC2 to the GIA manager.]
 
-  Description []
+  Description [Rewriting uses nProcs threads (0 or 1 means no threading).]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
+Gia_Man_t * Gia_ManCompress2Par( Gia_Man_t * p, int fUpdateLevel, int nProcs, int fVerbose )
 {
     Gia_Man_t * pGia;
     Aig_Man_t * pNew, * pTemp;
     if ( p->pManTime && p->vLevels == NULL )
         Gia_ManLevelWithBoxes( p );
     pNew = Gia_ManToAig( p, 0 );
-    pNew = Dar_ManCompress2( pTemp = pNew, 1, fUpdateLevel, 1, 0, fVerbose );
+    pNew = Dar_ManCompress2Par( pTemp = pNew, 1, fUpdateLevel, 1, 0, nProcs, fVerbose );
     Aig_ManStop( pTemp );
     pGia = Gia_ManFromAig( pNew );
     Aig_ManStop( pNew );
@@ -600,6 +600,22 @@ Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
     return pGia;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Applies DC2 to the GIA manager.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
+{
+    return Gia_ManCompress2Par( p, fUpdateLevel, 0, fVerbose );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -632,11 +648,41 @@ int Gia_ManTestChoices( Gia_Man_t * p )
     Vec_IntFree( vPointed );
     return 1;
 }
+Gia_Man_t * Gia_ManPerformDchNative( Gia_Man_t * p, Dch_Pars_t * pPars )
+{
+    extern Gia_Man_t * Dar_NewChoiceSynthesis( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fPower, int fLightSynth, int fVerbose );
+    extern Gia_Man_t * Cec_ComputeChoicesGia( Gia_Man_t * pMiter, Dch_Pars_t * pPars );
+    Gia_Man_t * pGia, * pMiter;
+    abctime clk = Abc_Clock();
+    // synthesis of the snapshots is only available for AIG managers
+    pMiter = Dar_NewChoiceSynthesis( Gia_ManToAig(p, 0), 1, 1, pPars->fPower, pPars->fLightSynth, pPars->fVerbose );
+    pPars->timeSynth = Abc_Clock() - clk;
+    pGia = Cec_ComputeChoicesGia( pMiter, pPars );
+    Gia_ManStop( pMiter );
+    ABC_FREE( pGia->pName );
+    ABC_FREE( pGia->pSpec );
+    pGia->pName = Abc_UtilStrsav( p->pName );
+    pGia->pSpec = Abc_UtilStrsav( p->pSpec );
+    pGia->nConstrs = p->nConstrs;
+    if ( pPars->fVerbose )
+        Abc_PrintTime( 1, "Total choice computation time", Abc_Clock() - clk );
+    return pGia;
+}
 Gia_Man_t * Gia_ManPerformDch( Gia_Man_t * p, void * pPars )
 {
     int fUseMapping = 0;
     Gia_Man_t * pGia, * pGia1;
     Aig_Man_t * pNew;
+    if ( ((Dch_Pars_t *)pPars)->fUseNative && !p->pManTime )
+    {
+        pGia = Gia_ManPerformDchNative( p, (Dch_Pars_t *)pPars );
+        if ( !Gia_ManTestChoices(pGia) )
+        {
+            Gia_ManStop( pGia );
+            pGia = Gia_ManDup( p );
+        }
+        return pGia;
+    }
     if ( p->pManTime && p->vLevels == NULL )
         Gia_ManLevelWithBoxes( p );
     if ( fUseMapping && Gia_ManHasMapping(p) )
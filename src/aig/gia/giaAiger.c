@@ -23,6 +23,13 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
@@ -61,20 +68,30 @@ char * Gia_FileNameGeneric( char * FileName )
         *pDot = 0;
     return pRes;
 }
-int Gia_FileSize( char * pFileName )
+size_t Gia_FileSize( char * pFileName )
 {
+#ifndef _WIN32
+    struct stat Stat;
+    if ( stat( pFileName, &Stat ) == -1 )
+    {
+        printf( "Gia_FileSize(): The file is unavailable (absent or open).\n" );
+        return 0;
+    }
+    return (size_t)Stat.st_size;
+#else
     FILE * pFile;
-    int nFileSize;
+    size_t nFileSize;
     pFile = fopen( pFileName, "r" );
     if ( pFile == NULL )
     {
         printf( "Gia_FileSize(): The file is unavailable (absent or open).\n" );
         return 0;
     }
-    fseek( pFile, 0, SEEK_END );  
-    nFileSize = ftell( pFile ); 
+    _fseeki64( pFile, 0, SEEK_END );  
+    nFileSize = (size_t)_ftelli64( pFile ); 
     fclose( pFile );
     return nFileSize;
+#endif
 }
 void Gia_FileWriteBufferSize( FILE * pFile, int nSize )
 {
@@ -173,7 +190,7 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, size_t nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
@@ -1000,11 +1017,62 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The file is mapped privately, so that the parser can modify
+  the contents in place (for example, when terminating the names) without
+  affecting the file. Only the modified pages are copied by the OS. 
+  Returns NULL if the file cannot be mapped.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileMapOpen( char * pFileName, size_t * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    int Fd = open( pFileName, O_RDONLY );
+    if ( Fd == -1 )
+        return NULL;
+    // the parser may look one byte past the end of the file, which is safe,
+    // unless the file ends exactly at the page boundary
+    if ( fstat( Fd, &Stat ) == -1 || !S_ISREG(Stat.st_mode) || Stat.st_size == 0 || (ABC_UINT64_T)Stat.st_size > (ABC_UINT64_T)(size_t)-1 || 
+         Stat.st_size % sysconf(_SC_PAGESIZE) == 0 )
+    {
+        close( Fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, Fd, 0 );
+    close( Fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (size_t)Stat.st_size;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+void Gia_FileMapClose( char * pContents, size_t nFileSize )
+{
+#ifndef _WIN32
+    munmap( pContents, nFileSize );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The file is parsed in place after mapping it into memory.
+  If mapping is not available, the file is read into a buffer.]
   
   SideEffects []
 
@@ -1016,19 +1084,29 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
+    size_t nFileSize;
     int RetValue;
 
-    // read the file into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
-
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    pContents = Gia_FileMapOpen( pFileName, &nFileSize );
+    if ( pContents )
+    {
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        Gia_FileMapClose( pContents, nFileSize );
+    }
+    else
+    {
+        // read the file into the buffer
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nFileSize );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        fclose( pFile );
+        pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+        ABC_FREE( pContents );
+    }
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -1231,6 +1309,13 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         printf( "AIG cannot be written because it has no POs.\n" );
         return;
     }
+    // the compressed AIG is written without restoring the objects, if possible
+    if ( Gia_ManIsZipped(pInit) )
+    {
+        if ( !fCompact && Gia_ManZipWriteAiger( pInit, pFileName, fWriteNewLine ) )
+            return;
+        Gia_ManUnzip( pInit );
+    }
 
     // start the output stream
     pFile = fopen( pFileName, "wb" );
@@ -55,6 +55,7 @@ struct Gia_Sto_t_
     int             fTruthMin;
     int             fVerbose;
     Gia_Man_t *     pGia;                      // user's AIG manager (will be modified by adding nodes)
+    Gia_Man_t *     pGiaCopy;                  // the copy of the AIG the cuts refer to, until they are transferred
     Vec_Int_t *     vRefs;                     // refs for each node
     Vec_Wec_t *     vCuts;                     // cuts for each node
     Vec_Mem_t *     vTtMem;                    // truth tables
@@ -573,6 +574,8 @@ void Gia_StoFree( Gia_Sto_t * p )
         Vec_MemHashFree( p->vTtMem );
     if ( p->fCutMin )
         Vec_MemFree( p->vTtMem );
+    if ( p->pGiaCopy )
+        Gia_ManStop( p->pGiaCopy );
     ABC_FREE( p );
 }
 void Gia_StoComputeCutsConst0( Gia_Sto_t * p, int iObj )
@@ -778,6 +781,335 @@ void Gia_ManExtractTest( Gia_Man_t * pGia )
     Abc_PrintTime( 0, "Creating windows", Abc_Clock() - clk );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Persistent cut database.]
+
+  Description [The database is the cut storage above, with truth tables,
+  kept attached to the AIG manager. When a command replaces the current 
+  AIG, the database is moved to the new one together with a copy of the
+  old AIG. The cuts are transferred when they are requested: the nodes, 
+  which are structurally identical to the nodes of the old AIG (the same
+  fanins up to the CIs), keep their cuts and truth tables, while the cuts
+  of the remaining nodes, which are in the TFO of the changed logic, are 
+  recomputed. The cuts are ranked using the references of the AIG, for 
+  which they were computed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCutDbComputeAll( Gia_Sto_t * p )
+{
+    Gia_Obj_t * pObj;  int i, iObj;
+    Gia_ManForEachObj( p->pGia, pObj, iObj )
+        Gia_StoRefObj( p, iObj );
+    Gia_StoComputeCutsConst0( p, 0 );
+    Gia_ManForEachCiId( p->pGia, iObj, i )
+        Gia_StoComputeCutsCi( p, iObj );
+    Gia_ManForEachAnd( p->pGia, pObj, iObj )
+        Gia_StoComputeCutsNode( p, iObj );
+}
+int Gia_ManCutDbIsSupported( Gia_Man_t * p )
+{
+    return !Gia_ManIsZipped(p) && !p->pMuxes && !Gia_ManBufNum(p);
+}
+void Gia_ManCutDbStart( Gia_Man_t * p, int nCutSize, int nCutNum, int fVerbose )
+{
+    Gia_Sto_t * pSto;
+    Gia_ManCutDbStop( p );
+    if ( !Gia_ManCutDbIsSupported(p) )
+    {
+        printf( "The cut database does not support AIGs with MUXes or barrier buffers.\n" );
+        return;
+    }
+    pSto = Gia_StoAlloc( p, nCutSize, nCutNum, 1, 0, fVerbose );
+    Gia_ManCutDbComputeAll( pSto );
+    p->pCutDb = pSto;
+    if ( fVerbose )
+        Gia_ManCutDbPrintStats( p );
+}
+void Gia_ManCutDbStop( Gia_Man_t * p )
+{
+    if ( p->pCutDb == NULL )
+        return;
+    Gia_StoFree( (Gia_Sto_t *)p->pCutDb );
+    p->pCutDb = NULL;
+}
+void Gia_ManCutDbPrintStats( Gia_Man_t * p )
+{
+    Gia_Sto_t * pSto;
+    Vec_Int_t * vCuts;  int i, nCuts = 0;
+    Gia_ManCutDbUpdate( p );
+    pSto = (Gia_Sto_t *)p->pCutDb;
+    if ( pSto == NULL )
+    {
+        printf( "The cut database is not computed.\n" );
+        return;
+    }
+    Vec_WecForEachLevel( pSto->vCuts, vCuts, i )
+        nCuts += Vec_IntSize(vCuts) ? Vec_IntEntry(vCuts, 0) : 0;
+    printf( "Cut database: K = %d  C = %d  Nodes = %d  Cuts = %d  Truths = %d  Mem = %.2f MB\n", 
+        pSto->nCutSize, pSto->nCutNum, Gia_ManAndNum(p), nCuts, Vec_MemEntryNum(pSto->vTtMem),
+        (Vec_WecMemory(pSto->vCuts) + Vec_MemMemory(pSto->vTtMem)) / (1<<20) );
+}
+int Gia_ManCutDbCutSize( Gia_Man_t * p )
+{
+    return p->pCutDb ? ((Gia_Sto_t *)p->pCutDb)->nCutSize : 0;
+}
+int * Gia_ManCutDbCutSet( Gia_Man_t * p, int iObj )
+{
+    Gia_Sto_t * pSto = (Gia_Sto_t *)p->pCutDb;
+    assert( pSto != NULL && pSto->pGia == p );
+    return Vec_IntArray( Vec_WecEntry(pSto->vCuts, iObj) );
+}
+word * Gia_ManCutDbTruth( Gia_Man_t * p, int iFunc )
+{
+    Gia_Sto_t * pSto = (Gia_Sto_t *)p->pCutDb;
+    return Vec_MemReadEntry( pSto->vTtMem, Abc_Lit2Var(iFunc) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the cut database to the new AIG.]
+
+  Description [Transfers the cuts computed for pOld to pNew.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManCutDbFaninLit( Gia_Man_t * p, Vec_Int_t * vRepr, int iObj, int fFanin1 )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p, iObj );
+    if ( fFanin1 )
+        return Abc_Var2Lit( Vec_IntEntry(vRepr, Gia_ObjFaninId1(pObj, iObj)), Gia_ObjFaninC1(pObj) );
+    return Abc_Var2Lit( Vec_IntEntry(vRepr, Gia_ObjFaninId0(pObj, iObj)), Gia_ObjFaninC0(pObj) );
+}
+static inline int * Gia_ManCutDbHashFind( Gia_Man_t * p, Vec_Int_t * vTable, Vec_Int_t * vRepr, int iLit0, int iLit1 )
+{
+    int * pPlace = Vec_IntEntryP( vTable, (int)(((unsigned)iLit0 * 7937 + (unsigned)iLit1 * 2971) % Vec_IntSize(vTable)) );
+    int * pStop  = Vec_IntLimit( vTable );
+    for ( ; *pPlace; pPlace = pPlace + 1 < pStop ? pPlace + 1 : Vec_IntArray(vTable) )
+    {
+        int iFan0 = Gia_ManCutDbFaninLit( p, vRepr, *pPlace, 0 );
+        int iFan1 = Gia_ManCutDbFaninLit( p, vRepr, *pPlace, 1 );
+        if ( Abc_MinInt(iFan0, iFan1) == iLit0 && Abc_MaxInt(iFan0, iFan1) == iLit1 )
+            break;
+    }
+    return pPlace;
+}
+// hashes the old AIG while mapping structural duplicates into their representatives
+Vec_Int_t * Gia_ManCutDbHashStart( Gia_Man_t * p, Vec_Int_t * vRepr )
+{
+    Vec_Int_t * vTable = Vec_IntStart( Abc_PrimeCudd(2 * Gia_ManAndNum(p) + 1) );
+    Gia_Obj_t * pObj;  int i, * pPlace;
+    Vec_IntFill( vRepr, Gia_ManObjNum(p), 0 );
+    Gia_ManForEachCi( p, pObj, i )
+        Vec_IntWriteEntry( vRepr, Gia_ObjId(p, pObj), Gia_ObjId(p, pObj) );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        int iFan0 = Gia_ManCutDbFaninLit( p, vRepr, i, 0 );
+        int iFan1 = Gia_ManCutDbFaninLit( p, vRepr, i, 1 );
+        pPlace = Gia_ManCutDbHashFind( p, vTable, vRepr, Abc_MinInt(iFan0, iFan1), Abc_MaxInt(iFan0, iFan1) );
+        if ( *pPlace == 0 )
+            *pPlace = i;
+        Vec_IntWriteEntry( vRepr, i, *pPlace );
+    }
+    return vTable;
+}
+int Gia_ManCutDbCopyCuts( Gia_Sto_t * p, Vec_Int_t * vCutsOld, Vec_Int_t * vRepr, Vec_Int_t * vMapR, int iObjOld, int iObj )
+{
+    Vec_Int_t * vThis = Vec_WecEntry( p->vCuts, iObj );
+    int nWords = Abc_Truth6WordNum( p->nCutSize );
+    int i, k, v, fSorted, iFunc, pLeaves[GIA_MAX_CUTSIZE], * pCut, * pList = Vec_IntArray( vCutsOld );
+    word uTruth[GIA_MAX_TT_WORDS];
+    assert( Vec_IntSize(vThis) == 0 );
+    Vec_IntPush( vThis, pList[0] );
+    Sdb_ForEachCut( pList, pCut, i )
+    {
+        fSorted = 1;
+        for ( v = 0; v < pCut[0]; v++ )
+        {
+            pLeaves[v] = pCut[v+1] == iObjOld ? iObj : Vec_IntEntry( vMapR, Vec_IntEntry(vRepr, pCut[v+1]) );
+            if ( pLeaves[v] == -1 )
+            {
+                Vec_IntClear( vThis );
+                return 0;
+            }
+            fSorted &= (v == 0 || pLeaves[v-1] < pLeaves[v]);
+        }
+        iFunc = pCut[pCut[0]+1];
+        if ( !fSorted ) // restore the order of leaves by permuting the truth table
+        {
+            Abc_TtCopy( uTruth, Vec_MemReadEntry(p->vTtMem, Abc_Lit2Var(iFunc)), nWords, 0 );
+            for ( k = pCut[0] - 1; k > 0; k-- )
+            for ( v = 0; v < k; v++ )
+                if ( pLeaves[v] > pLeaves[v+1] )
+                {
+                    ABC_SWAP( int, pLeaves[v], pLeaves[v+1] );
+                    Abc_TtSwapAdjacent( uTruth, nWords, v );
+                }
+            iFunc = Abc_Var2Lit( Vec_MemHashInsert(p->vTtMem, uTruth), Abc_LitIsCompl(iFunc) );
+        }
+        for ( v = 1; v < pCut[0]; v++ )
+            if ( pLeaves[v-1] == pLeaves[v] ) // duplicated leaves are merged in the new AIG
+            {
+                Vec_IntClear( vThis );
+                return 0;
+            }
+        Vec_IntPush( vThis, pCut[0] );
+        for ( v = 0; v < pCut[0]; v++ )
+            Vec_IntPush( vThis, pLeaves[v] );
+        Vec_IntPush( vThis, iFunc );
+    }
+    return 1;
+}
+// the cuts are ranked by the number of leaves with one fanout (see Gia_CutTreeLeaves)
+static inline int Gia_ManCutDbSameRank( Vec_Int_t * vRefsOld, Vec_Int_t * vRefs, int iObjOld, int iObj )
+{
+    return (Vec_IntEntry(vRefsOld, iObjOld) == 1) == (Vec_IntEntry(vRefs, iObj) == 1);
+}
+static void Gia_ManCutDbTransferCuts( Gia_Sto_t * p, Gia_Man_t * pNew, Gia_Man_t * pOld )
+{
+    Vec_Int_t * vMap, * vMapR, * vRepr, * vTable, * vRefsOld;
+    Vec_Str_t * vSame;
+    Vec_Wec_t * vCutsOld;
+    Gia_Obj_t * pObj;
+    int i, iObj, nReused = 0;
+    abctime clk = Abc_Clock();
+    // map the new objects into the structurally identical old objects
+    vMap   = Vec_IntStartFull( Gia_ManObjNum(pNew) );
+    vMapR  = Vec_IntStartFull( Gia_ManObjNum(pOld) );
+    vRepr  = Vec_IntAlloc( Gia_ManObjNum(pOld) );
+    vTable = Gia_ManCutDbHashStart( pOld, vRepr );
+    vSame  = Vec_StrStart( Gia_ManObjNum(pNew) );
+    Vec_IntWriteEntry( vMap, 0, 0 );
+    Vec_IntWriteEntry( vMapR, 0, 0 );
+    if ( Gia_ManCiNum(pNew) == Gia_ManCiNum(pOld) )
+        Gia_ManForEachCi( pNew, pObj, i )
+        {
+            Vec_IntWriteEntry( vMap, Gia_ObjId(pNew, pObj), Gia_ManCiIdToId(pOld, i) );
+            Vec_IntWriteEntry( vMapR, Gia_ManCiIdToId(pOld, i), Gia_ObjId(pNew, pObj) );
+        }
+    // restart the storage for the new AIG
+    vCutsOld   = p->vCuts;
+    vRefsOld   = p->vRefs;
+    p->vCuts   = Vec_WecStart( Gia_ManObjNum(pNew) );
+    p->vRefs   = Vec_IntAlloc( Gia_ManObjNum(pNew) );
+    p->pGia    = pNew;
+    Gia_ManForEachObj( pNew, pObj, iObj )
+        Gia_StoRefObj( p, iObj );
+    // vSame marks the objects whose cuts are ranked as in the old AIG
+    Gia_StoComputeCutsConst0( p, 0 );
+    Vec_StrWriteEntry( vSame, 0, 1 );
+    Gia_ManForEachCiId( pNew, iObj, i )
+    {
+        Gia_StoComputeCutsCi( p, iObj );
+        if ( Vec_IntEntry(vMap, iObj) >= 0 )
+            Vec_StrWriteEntry( vSame, iObj, (char)Gia_ManCutDbSameRank(vRefsOld, p->vRefs, Vec_IntEntry(vMap, iObj), iObj) );
+    }
+    Gia_ManForEachAnd( pNew, pObj, iObj )
+    {
+        int iOld0 = Vec_IntEntry( vMap, Gia_ObjFaninId0(pObj, iObj) );
+        int iOld1 = Vec_IntEntry( vMap, Gia_ObjFaninId1(pObj, iObj) );
+        int iOld  = -1;
+        if ( iOld0 >= 0 && iOld1 >= 0 )
+        {
+            int iLit0 = Abc_Var2Lit( iOld0, Gia_ObjFaninC0(pObj) );
+            int iLit1 = Abc_Var2Lit( iOld1, Gia_ObjFaninC1(pObj) );
+            iOld = *Gia_ManCutDbHashFind( pOld, vTable, vRepr, Abc_MinInt(iLit0, iLit1), Abc_MaxInt(iLit0, iLit1) );
+        }
+        // structural duplicates are not mapped, so that the cut leaves remain in the TFI
+        if ( iOld > 0 && Vec_IntEntry(vMapR, iOld) == -1 )
+        {
+            Vec_IntWriteEntry( vMap, iObj, iOld );
+            Vec_IntWriteEntry( vMapR, iOld, iObj );
+            // merging would select the same cuts if the fanin cuts and the ranks of their leaves did not change
+            if ( Vec_StrEntry(vSame, Gia_ObjFaninId0(pObj, iObj)) && Vec_StrEntry(vSame, Gia_ObjFaninId1(pObj, iObj)) && 
+                 Gia_ManCutDbCopyCuts(p, Vec_WecEntry(vCutsOld, iOld), vRepr, vMapR, iOld, iObj) )
+            {
+                Vec_StrWriteEntry( vSame, iObj, (char)Gia_ManCutDbSameRank(vRefsOld, p->vRefs, iOld, iObj) );
+                nReused++;
+                continue;
+            }
+        }
+        Gia_StoComputeCutsNode( p, iObj );
+    }
+    if ( p->fVerbose )
+    {
+        printf( "Cut database: Reused cuts of %d nodes. Recomputed cuts of %d nodes.  ", nReused, Gia_ManAndNum(pNew) - nReused );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_WecFree( vCutsOld );
+    Vec_IntFree( vRefsOld );
+    Vec_StrFree( vSame );
+    Vec_IntFree( vTable );
+    Vec_IntFree( vRepr );
+    Vec_IntFree( vMapR );
+    Vec_IntFree( vMap );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the cut database to the new AIG.]
+
+  Description [Called when pNew replaces pOld as the current AIG. 
+  The database keeps a copy of the AIG its cuts were computed for,
+  which is cheap compared to the transfer of the cuts, so that the
+  AIGs produced by a sequence of commands without a consumer of the
+  cuts do not pay for the transfer.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCutDbTransfer( Gia_Man_t * pNew, Gia_Man_t * pOld )
+{
+    Gia_Sto_t * p = (Gia_Sto_t *)pOld->pCutDb;
+    if ( p == NULL || pNew == pOld || pNew->pCutDb )
+        return;
+    pOld->pCutDb = NULL;
+    if ( !Gia_ManCutDbIsSupported(pOld) || !Gia_ManCutDbIsSupported(pNew) )
+    {
+        Gia_StoFree( p );
+        return;
+    }
+    // the copy has the same object IDs as the original
+    if ( p->pGiaCopy == NULL )
+        p->pGia = p->pGiaCopy = Gia_ManDup( pOld );
+    assert( p->pGia == p->pGiaCopy );
+    pNew->pCutDb = p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the cut database refer to the given AIG.]
+
+  Description [Performs the transfer of the cuts delayed by
+  Gia_ManCutDbTransfer(). Should be called by the commands using
+  the cuts before reading them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCutDbUpdate( Gia_Man_t * p )
+{
+    Gia_Sto_t * pSto = (Gia_Sto_t *)p->pCutDb;
+    if ( pSto == NULL || pSto->pGia == p )
+        return;
+    assert( pSto->pGia == pSto->pGiaCopy );
+    Gia_ManCutDbTransferCuts( pSto, p, pSto->pGiaCopy );
+    assert( pSto->pGia == p );
+    Gia_ManStop( pSto->pGiaCopy );
+    pSto->pGiaCopy = NULL;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
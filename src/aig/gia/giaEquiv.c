@@ -2019,6 +2019,61 @@ Gia_Man_t * Gia_ManEquivToChoices( Gia_Man_t * p, int nSnapshots )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Converts choices given by equivalence classes into siblings.]
+
+  Description [The input is the result of Gia_ManEquivToChoices(), in which
+  the representative is the smallest node of its class and the members are
+  linked through the next-pointers. In the resulting AIG, each member is
+  added before the node pointing to it, so the head of a choice node has
+  the largest ID and points to its first sibling.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManEquivToSibls_rec( Gia_Man_t * pNew, Gia_Man_t * p, Gia_Obj_t * pObj )
+{
+    int iNext;
+    if ( ~pObj->Value )
+        return;
+    assert( Gia_ObjIsAnd(pObj) );
+    iNext = Gia_ObjNext( p, Gia_ObjId(p, pObj) );
+    Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFanin0(pObj) );
+    Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFanin1(pObj) );
+    if ( iNext > 0 )
+        Gia_ManEquivToSibls_rec( pNew, p, Gia_ManObj(p, iNext) );
+    pObj->Value = Gia_ManAppendAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    if ( iNext > 0 )
+    {
+        assert( Abc_Lit2Var(pObj->Value) > Abc_Lit2Var(Gia_ManObj(p, iNext)->Value) );
+        pNew->pSibls[Abc_Lit2Var(pObj->Value)] = Abc_Lit2Var(Gia_ManObj(p, iNext)->Value);
+    }
+}
+Gia_Man_t * Gia_ManEquivToSibls( Gia_Man_t * p )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj;
+    int i;
+    assert( p->pReprs && p->pNexts );
+    pNew = Gia_ManStart( Gia_ManObjNum(p) );
+    pNew->pName = Abc_UtilStrsav( p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->pSpec );
+    pNew->pSibls = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    Gia_ManFillValue( p );
+    Gia_ManConst0(p)->Value = 0;
+    Gia_ManForEachCi( p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManEquivToSibls_rec( pNew, p, Gia_ObjFanin0(pObj) );
+    Gia_ManForEachCo( p, pObj, i )
+        Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p) );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Counts the number of choice nodes]
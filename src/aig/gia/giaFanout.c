@@ -19,6 +19,18 @@
 ***********************************************************************/
 
 #include "gia.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -38,6 +50,25 @@ static inline int * Gia_FanoutObj( int * pData, int ObjId )   { return pData + 5
 static inline int * Gia_FanoutPrev( int * pData, int iFan )   { return pData + 5*(iFan >> 1) + 1 + (iFan & 1);  }
 static inline int * Gia_FanoutNext( int * pData, int iFan )   { return pData + 5*(iFan >> 1) + 3 + (iFan & 1);  }
 
+// CSR fanout index
+#define GIA_FAN_THR_MAX  64      // the largest number of threads
+#define GIA_FAN_ALIGN    64      // the alignment of the arrays (cache line)
+
+enum { GIA_FAN_COUNT, GIA_FAN_SUM, GIA_FAN_SCAN, GIA_FAN_FILL, GIA_FAN_SORT };
+
+typedef struct Gia_FanThData_t_ Gia_FanThData_t;
+struct Gia_FanThData_t_
+{
+    Gia_Man_t *    p;             // the AIG
+    Gia_Fan_t *    f;             // the index being built
+    unsigned *     pCursor;       // the next free fanout slot of each object
+    int            Phase;         // the current phase
+    int            fAtomic;       // several threads update the counters
+    int            Beg;           // the first object of this thread
+    int            End;           // the last object of this thread (exclusive)
+    unsigned       Total;         // the number of fanouts in this block
+};
+
 // these two procedures are only here for the use inside the iterator
 static inline int     Gia_ObjFanout0Int( Gia_Man_t * p, int ObjId )  { assert(ObjId < p->nFansAlloc);  return p->pFanData[5*ObjId];                         }
 static inline int     Gia_ObjFanoutNext( Gia_Man_t * p, int iFan )   { assert(iFan/2 < p->nFansAlloc); return p->pFanData[5*(iFan >> 1) + 3 + (iFan & 1)];  }
@@ -235,52 +266,27 @@ Vec_Int_t * Gia_ManStartFanoutMap( Gia_Man_t * p, Vec_Int_t * vFanoutNums )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManStaticFanoutStart( Gia_Man_t * p )
+void Gia_ManStaticFanoutStartPar( Gia_Man_t * p, int nProcs )
 {
-    Vec_Int_t * vCounts;
-    int * pRefsOld;
-    Gia_Obj_t * pObj, * pFanin;
-    int i, iFanout;
+    Gia_Fan_t * f;
+    int i, nObjs = Gia_ManObjNum(p);
     assert( p->vFanoutNums == NULL );
     assert( p->vFanout == NULL );
-    // recompute reference counters
-    pRefsOld = p->pRefs; p->pRefs = NULL;
-    Gia_ManCreateRefs(p);
-    p->vFanoutNums = Vec_IntAllocArray( p->pRefs, Gia_ManObjNum(p) );
-    p->pRefs = pRefsOld;
-    // start the fanout maps
-    p->vFanout = Gia_ManStartFanoutMap( p, p->vFanoutNums );
-    // incrementally add fanouts
-    vCounts = Vec_IntStart( Gia_ManObjNum(p) );
-    Gia_ManForEachObj( p, pObj, i )
+    // derive the static fanout from the fanout index
+    f = Gia_ManFanIndexStart( p, nProcs );
+    p->vFanoutNums = Vec_IntAlloc( nObjs );
+    p->vFanout = Vec_IntAlloc( nObjs + f->nEdges );
+    for ( i = 0; i < nObjs; i++ )
     {
-        if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
-        {
-            pFanin = Gia_ObjFanin0(pObj);
-            iFanout = Vec_IntEntry( vCounts, Gia_ObjId(p, pFanin) );
-            Gia_ObjSetFanout( p, pFanin, iFanout, pObj );
-            Vec_IntAddToEntry( vCounts, Gia_ObjId(p, pFanin), 1 );
-        }
-        if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
-        {
-            pFanin = Gia_ObjFanin1(pObj);
-            iFanout = Vec_IntEntry( vCounts, Gia_ObjId(p, pFanin) );
-            Gia_ObjSetFanout( p, pFanin, iFanout, pObj );
-            Vec_IntAddToEntry( vCounts, Gia_ObjId(p, pFanin), 1 );
-        }
-        if ( Gia_ObjIsMux(p, pObj) )
-        {
-
-            pFanin = Gia_ObjFanin2(p, pObj);
-            iFanout = Vec_IntEntry( vCounts, Gia_ObjId(p, pFanin) );
-            Gia_ObjSetFanout( p, pFanin, iFanout, pObj );
-            Vec_IntAddToEntry( vCounts, Gia_ObjId(p, pFanin), 1 );
-        }
+        Vec_IntPush( p->vFanoutNums, Gia_FanNum(f, i) );
+        Vec_IntPush( p->vFanout, nObjs + (int)f->pOffsets[i] );
     }
-    // double-check the current number of fanouts added
-    Gia_ManForEachObj( p, pObj, i )
-        assert( Vec_IntEntry(vCounts, i) == Gia_ObjFanoutNum(p, pObj) );
-    Vec_IntFree( vCounts );
+    Vec_IntPushArray( p->vFanout, f->pFanouts, f->nEdges );
+    Gia_ManFanIndexStop( f );
+}
+void Gia_ManStaticFanoutStart( Gia_Man_t * p )
+{
+    Gia_ManStaticFanoutStartPar( p, 1 );
 }
 
 
@@ -384,6 +390,275 @@ void Gia_ManStaticFanoutStop( Gia_Man_t * p )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the fanins contributing to the fanout index.]
+
+  Description [The fanins are the same as those used by the static fanout:
+  the first fanin of AND nodes and COs, the second fanin of AND nodes
+  other than buffers, and the third fanin of MUXes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ManFanIndexFanins( Gia_Man_t * p, Gia_Obj_t * pObj, int iObj, int * pFanins )
+{
+    int nFanins = 0;
+    if ( Gia_ObjIsAnd(pObj) || Gia_ObjIsCo(pObj) )
+        pFanins[nFanins++] = Gia_ObjFaninId0(pObj, iObj);
+    if ( Gia_ObjIsAnd(pObj) && !Gia_ObjIsBuf(pObj) )
+        pFanins[nFanins++] = Gia_ObjFaninId1(pObj, iObj);
+    if ( Gia_ObjIsMux(p, pObj) )
+        pFanins[nFanins++] = Gia_ObjFaninId2(p, iObj);
+    return nFanins;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one phase of building the fanout index.]
+
+  Description [The fanout counts are stored shifted by one entry, so that
+  the inclusive prefix sum of the counts gives the offsets. When several
+  threads fill the fanouts, the order of fanouts in each list depends on
+  scheduling and is restored by sorting the lists.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManFanIndexPhase( Gia_FanThData_t * pThData )
+{
+    Gia_Man_t * p = pThData->p;
+    Gia_Fan_t * f = pThData->f;
+    unsigned * pOffsets = f->pOffsets;
+    int pFanins[3], i, k, nFanins;
+    if ( pThData->Phase == GIA_FAN_COUNT )
+    {
+        for ( i = pThData->Beg; i < pThData->End; i++ )
+        {
+            nFanins = Gia_ManFanIndexFanins( p, Gia_ManObj(p, i), i, pFanins );
+            for ( k = 0; k < nFanins; k++ )
+                if ( pThData->fAtomic )
+                    ABC_FETCH_ADD( pOffsets + pFanins[k] + 1, 1 );
+                else
+                    pOffsets[pFanins[k] + 1]++;
+        }
+    }
+    else if ( pThData->Phase == GIA_FAN_SUM )
+    {
+        pThData->Total = 0;
+        for ( i = pThData->Beg; i < pThData->End; i++ )
+            pThData->Total += pOffsets[i + 1];
+    }
+    else if ( pThData->Phase == GIA_FAN_SCAN )
+    {
+        unsigned Sum = pThData->Total;
+        for ( i = pThData->Beg; i < pThData->End; i++ )
+        {
+            pThData->pCursor[i] = Sum;
+            pOffsets[i + 1] = (Sum += pOffsets[i + 1]);
+        }
+    }
+    else if ( pThData->Phase == GIA_FAN_FILL )
+    {
+        for ( i = pThData->Beg; i < pThData->End; i++ )
+        {
+            nFanins = Gia_ManFanIndexFanins( p, Gia_ManObj(p, i), i, pFanins );
+            for ( k = 0; k < nFanins; k++ )
+                if ( pThData->fAtomic )
+                    f->pFanouts[ABC_FETCH_ADD(pThData->pCursor + pFanins[k], 1)] = i;
+                else
+                    f->pFanouts[pThData->pCursor[pFanins[k]]++] = i;
+        }
+    }
+    else if ( pThData->Phase == GIA_FAN_SORT )
+    {
+        for ( i = pThData->Beg; i < pThData->End; i++ )
+            if ( Gia_FanNum(f, i) > 16 )
+                qsort( (void *)Gia_FanArray(f, i), (size_t)Gia_FanNum(f, i), sizeof(int), 
+                    (int (*)(const void *, const void *)) Vec_IntSortCompare1 );
+            else if ( Gia_FanNum(f, i) > 1 )
+                Vec_IntSelectSort( Gia_FanArray(f, i), Gia_FanNum(f, i) );
+    }
+    else assert( 0 );
+}
+
+#ifdef ABC_USE_PTHREADS
+static void * Gia_ManFanIndexWorker( void * pArg )
+{
+    Gia_ManFanIndexPhase( (Gia_FanThData_t *)pArg );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one phase of building the fanout index in all threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManFanIndexRunPhase( Gia_FanThData_t * pThData, int nThreads, int Phase )
+{
+    int i;
+    for ( i = 0; i < nThreads; i++ )
+        pThData[i].Phase = Phase;
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 )
+    {
+        pthread_t WorkerThread[GIA_FAN_THR_MAX];
+        int status;
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_create( WorkerThread + i, NULL, Gia_ManFanIndexWorker, (void *)(pThData + i) );  assert( status == 0 );
+        }
+        Gia_ManFanIndexPhase( pThData );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+        return;
+    }
+#endif
+    for ( i = 0; i < nThreads; i++ )
+        Gia_ManFanIndexPhase( pThData + i );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates an array aligned on the cache line.]
+
+  Description [Returns the aligned array. The pointer to be freed is
+  returned in ppMemory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_ManFanIndexAlloc( int nEntries, char ** ppMemory )
+{
+    *ppMemory = ABC_ALLOC( char, sizeof(int) * nEntries + GIA_FAN_ALIGN );
+    return (void *)(*ppMemory + ((GIA_FAN_ALIGN - ((ABC_PTRUINT_T)*ppMemory & (GIA_FAN_ALIGN - 1))) & (GIA_FAN_ALIGN - 1)));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the compressed sparse row fanout index.]
+
+  Description [The offsets and the fanouts are 32-bit arrays aligned on
+  the cache line. The objects are divided into contiguous ranges processed
+  by different threads. The prefix sum of the fanout counts is computed 
+  in two passes over the same ranges. The index is a snapshot of the
+  current fanins and is not updated when the AIG changes. It is owned 
+  by the caller and freed by Gia_ManFanIndexStop().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Fan_t * Gia_ManFanIndexStart( Gia_Man_t * p, int nProcs )
+{
+    Gia_FanThData_t ThData[GIA_FAN_THR_MAX];
+    Gia_Fan_t * f;
+    unsigned Sum;
+    int i, nObjs = Gia_ManObjNum(p);
+    nProcs = Abc_MaxInt( 1, Abc_MinInt( nProcs, GIA_FAN_THR_MAX ) );
+    // there is no point in having threads with tiny ranges
+    nProcs = Abc_MinInt( nProcs, 1 + nObjs / 10000 );
+#ifndef ABC_USE_PTHREADS
+    nProcs = 1;
+#endif
+    f = ABC_CALLOC( Gia_Fan_t, 1 );
+    f->nObjs    = nObjs;
+    f->pOffsets = (unsigned *)Gia_ManFanIndexAlloc( nObjs + 1, &f->pMemOffsets );
+    memset( f->pOffsets, 0, sizeof(unsigned) * (nObjs + 1) );
+    // divide the objects among the threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p       = p;
+        ThData[i].f       = f;
+        ThData[i].pCursor = NULL;
+        ThData[i].fAtomic = (nProcs > 1);
+        ThData[i].Beg     = (int)((word)nObjs * i / nProcs);
+        ThData[i].End     = (int)((word)nObjs * (i+1) / nProcs);
+        ThData[i].Total   = 0;
+    }
+    // count the fanouts and compute the offsets
+    Gia_ManFanIndexRunPhase( ThData, nProcs, GIA_FAN_COUNT );
+    Gia_ManFanIndexRunPhase( ThData, nProcs, GIA_FAN_SUM );
+    for ( Sum = 0, i = 0; i < nProcs; i++ )
+    {
+        unsigned Total = ThData[i].Total;
+        ThData[i].Total = Sum;
+        Sum += Total;
+    }
+    assert( Sum < (1u << 31) );
+    f->nEdges = (int)Sum;
+    ThData[0].pCursor = ABC_ALLOC( unsigned, nObjs );
+    for ( i = 1; i < nProcs; i++ )
+        ThData[i].pCursor = ThData[0].pCursor;
+    Gia_ManFanIndexRunPhase( ThData, nProcs, GIA_FAN_SCAN );
+    // place the fanouts
+    f->pFanouts = (int *)Gia_ManFanIndexAlloc( f->nEdges, &f->pMemFanouts );
+    Gia_ManFanIndexRunPhase( ThData, nProcs, GIA_FAN_FILL );
+    if ( nProcs > 1 )
+        Gia_ManFanIndexRunPhase( ThData, nProcs, GIA_FAN_SORT );
+    ABC_FREE( ThData[0].pCursor );
+    return f;
+}
+
+void Gia_ManFanIndexStop( Gia_Fan_t * f )
+{
+    if ( f == NULL )
+        return;
+    ABC_FREE( f->pMemOffsets );
+    ABC_FREE( f->pMemFanouts );
+    ABC_FREE( f );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the transitive fanout of the objects.]
+
+  Description [The roots and their TFO (including COs) are returned in
+  increasing order of object IDs, that is, in a topological order.]
+               
+  SideEffects [Uses the current traversal ID.]
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManFanIndexCollectTfo( Gia_Man_t * p, Gia_Fan_t * f, int * pRoots, int nRoots, Vec_Int_t * vTfo )
+{
+    int i, k, iObj, iFan;
+    Vec_IntClear( vTfo );
+    Gia_ManIncrementTravId( p );
+    for ( i = 0; i < nRoots; i++ )
+        if ( !Gia_ObjIsTravIdCurrentId(p, pRoots[i]) )
+        {
+            Gia_ObjSetTravIdCurrentId( p, pRoots[i] );
+            Vec_IntPush( vTfo, pRoots[i] );
+        }
+    // the array doubles as the stack of unexplored objects
+    Vec_IntForEachEntry( vTfo, iObj, i )
+        Gia_FanForEachFanoutId( f, iObj, iFan, k )
+            if ( !Gia_ObjIsTravIdCurrentId(p, iFan) )
+            {
+                Gia_ObjSetTravIdCurrentId( p, iFan );
+                Vec_IntPush( vTfo, iFan );
+            }
+    Vec_IntSort( vTfo, 0 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Tests static fanout.]
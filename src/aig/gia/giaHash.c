@@ -27,6 +27,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define GIA_HASH_SLOT   3   // the number of ints in one slot (node ID and two fanin literals)
+#define GIA_HASH_MOVE   4   // the number of old slots moved by one hashing call while resizing
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -35,38 +38,126 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Returns the place where this node is stored (or should be stored).]
 
-  Description []
+  Description [The table uses open addressing with linear probing. Each slot
+  stores the node ID followed by the two fanin literals, so that probing
+  compares the keys without touching the array of objects. The control
+  literal of a MUX is checked in the object itself, only if the fanins match.
+  The number of slots is a power of two.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize ) 
+static inline unsigned Gia_ManHashOne( int iLit0, int iLit1, int iLitC ) 
+{
+    unsigned Key = (unsigned)iLit0 * 0x9E3779B1;
+    Key ^= (unsigned)iLit1 * 0x85EBCA77;
+    Key ^= (unsigned)(iLitC + 1) * 0xC2B2AE3D;
+    return Key ^ (Key >> 15);
+}
+static inline int Gia_ManHashSlotNum( Vec_Int_t * vTable )
+{
+    return Vec_IntSize(vTable) / GIA_HASH_SLOT;
+}
+static inline int * Gia_ManHashFindTable( Gia_Man_t * p, Vec_Int_t * vTable, int iLit0, int iLit1, int iLitC )
 {
-    unsigned Key = iLitC * 2011;
-    Key += Abc_Lit2Var(iLit0) * 7937;
-    Key += Abc_Lit2Var(iLit1) * 2971;
-    Key += Abc_LitIsCompl(iLit0) * 911;
-    Key += Abc_LitIsCompl(iLit1) * 353;
-    return (int)(Key % TableSize);
+    int * pTable = Vec_IntArray(vTable), * pPlace;
+    unsigned Mask = (unsigned)Gia_ManHashSlotNum(vTable) - 1;
+    unsigned i = Gia_ManHashOne( iLit0, iLit1, iLitC ) & Mask;
+    for ( ; ; i = (i + 1) & Mask )
+    {
+        pPlace = pTable + GIA_HASH_SLOT * i;
+        if ( pPlace[0] == 0 )
+            return pPlace;
+        if ( pPlace[1] == iLit0 && pPlace[2] == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2(p, pPlace[0]) == iLitC) )
+            return pPlace;
+    }
+    return NULL;
 }
 static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
-    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
+    int * pPlace;
     assert( p->pMuxes || iLit0 < iLit1 );
     assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
     assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
-    for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
+    // while the table is being resized, the old table is still looked up
+    if ( Vec_IntSize(&p->vHash) )
     {
-        Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
-        if ( Gia_ObjFaninLit0(pThis, iThis) == iLit0 && Gia_ObjFaninLit1(pThis, iThis) == iLit1 && (p->pMuxes == NULL || Gia_ObjFaninLit2p(p, pThis) == iLitC) )
-            break;
+        pPlace = Gia_ManHashFindTable( p, &p->vHash, iLit0, iLit1, iLitC );
+        if ( pPlace[0] )
+            return pPlace;
     }
+    pPlace = Gia_ManHashFindTable( p, &p->vHTable, iLit0, iLit1, iLitC );
+    if ( pPlace[0] == 0 ) // the caller may store the node here
+        pPlace[1] = iLit0, pPlace[2] = iLit1;
     return pPlace;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Moves several entries from the old table into the new one.]
+
+  Description [Entries are copied without being removed, so the old table
+  remains valid for lookups until all of its slots have been visited.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManHashMove( Gia_Man_t * p, int nSlots )
+{
+    int * pOld = Vec_IntArray( &p->vHash ), * pSlot, * pPlace;
+    int nSlotsOld = Gia_ManHashSlotNum( &p->vHash );
+    int Stop = Abc_MinInt( p->iHashMove + nSlots, nSlotsOld );
+    for ( ; p->iHashMove < Stop; p->iHashMove++ )
+    {
+        pSlot = pOld + GIA_HASH_SLOT * p->iHashMove;
+        if ( pSlot[0] == 0 )
+            continue;
+        pPlace = Gia_ManHashFindTable( p, &p->vHTable, pSlot[1], pSlot[2], Gia_ObjFaninLit2(p, pSlot[0]) );
+        assert( pPlace[0] == 0 ); // should not be there
+        pPlace[0] = pSlot[0];
+        pPlace[1] = pSlot[1];
+        pPlace[2] = pSlot[2];
+    }
+    if ( p->iHashMove == nSlotsOld )
+        Vec_IntErase( &p->vHash );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts resizing the hash table.]
+
+  Description [The table is doubled when it is three-quarters full. Instead
+  of rehashing all entries at once, the old table is kept and its entries 
+  are moved a few at a time by the following hashing calls.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashResize( Gia_Man_t * p )
+{
+    assert( Vec_IntSize(&p->vHTable) > 0 );
+    assert( Vec_IntSize(&p->vHash) == 0 );
+    p->vHash = p->vHTable;
+    Vec_IntZero( &p->vHTable );
+    Vec_IntFill( &p->vHTable, 2 * Vec_IntSize(&p->vHash), 0 );
+    p->iHashMove = 0;
+//    if ( p->fVerbose )
+//        printf( "Resizing GIA hash table: %d -> %d.\n", Gia_ManHashSlotNum(&p->vHash), Gia_ManHashSlotNum(&p->vHTable) );
+}
+static inline void Gia_ManHashUpdate( Gia_Man_t * p )
+{
+    if ( Vec_IntSize(&p->vHash) )
+        Gia_ManHashMove( p, GIA_HASH_MOVE );
+    else if ( 4 * Gia_ManAndNum(p) > 3 * Gia_ManHashSlotNum(&p->vHTable) )
+        Gia_ManHashResize( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -104,11 +195,11 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
 ***********************************************************************/
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
+    int nEntries = Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc;
     assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
-    Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
-    Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
-//printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
+    assert( Vec_IntSize(&p->vHash) == 0 );
+    Vec_IntFill( &p->vHTable, GIA_HASH_SLOT * (1 << Abc_Base2Log(2 * Abc_MaxInt(nEntries, 1000))), 0 );
+//printf( "Alloced table with %d entries.\n", Gia_ManHashSlotNum(&p->vHTable) );
 }
 
 /**Function*************************************************************
@@ -152,52 +243,11 @@ void Gia_ManHashStop( Gia_Man_t * p )
     Vec_IntErase( &p->vHash );
 }
 
-/**Function*************************************************************
-
-  Synopsis    [Resizes the hash table.]
-
-  Description []
-               
-  SideEffects []
-
-  SeeAlso     []
-
-***********************************************************************/
-void Gia_ManHashResize( Gia_Man_t * p )
-{
-    int i, iThis, iNext, Counter, Counter2, * pPlace;
-    Vec_Int_t vOld = p->vHTable;
-    assert( Vec_IntSize(&vOld) > 0 );
-    // replace the table
-    Vec_IntZero( &p->vHTable );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
-    // rehash the entries from the old table
-    Counter = 0;
-    Vec_IntForEachEntry( &vOld, iThis, i )
-        for ( iNext = Vec_IntEntry(&p->vHash, iThis);  
-              iThis;  iThis = iNext,   
-              iNext = Vec_IntEntry(&p->vHash, iThis)  )
-        {
-            Gia_Obj_t * pThis0 = Gia_ManObj( p, iThis );
-            Vec_IntWriteEntry( &p->vHash, iThis, 0 );
-            pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pThis0, iThis), Gia_ObjFaninLit1(pThis0, iThis), Gia_ObjFaninLit2p(p, pThis0) );
-            assert( *pPlace == 0 ); // should not be there
-            *pPlace = iThis;
-            assert( *pPlace != 0 );
-            Counter++;
-        }
-    Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
-    assert( Counter == Counter2 );
-//    if ( p->fVerbose )
-//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
-    Vec_IntErase( &vOld );
-}
-
 /**Function********************************************************************
 
   Synopsis    [Profiles the hash table.]
 
-  Description []
+  Description [Prints the distribution of the probe lengths of the entries.]
 
   SideEffects []
 
@@ -206,21 +256,25 @@ void Gia_ManHashResize( Gia_Man_t * p )
 ******************************************************************************/
 void Gia_ManHashProfile( Gia_Man_t * p )
 {
-    int iEntry;
-    int i, Counter, Limit;
-    printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
-    printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
-    Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
-    for ( i = 0; i < Limit; i++ )
+    int * pTable = Vec_IntArray( &p->vHTable ), * pSlot;
+    int i, Dist, Counter = 0, nSlots = Gia_ManHashSlotNum( &p->vHTable );
+    int Counts[9] = {0};
+    double Total = 0;
+    for ( i = 0; i < nSlots; i++ )
     {
-        Counter = 0;
-        for ( iEntry = Vec_IntEntry(&p->vHTable, i); 
-              iEntry; 
-              iEntry = iEntry? Vec_IntEntry(&p->vHash, iEntry) : 0 )
-            Counter++;
-        if ( Counter ) 
-            printf( "%d ", Counter );
+        pSlot = pTable + GIA_HASH_SLOT * i;
+        if ( pSlot[0] == 0 )
+            continue;
+        Dist = (i - (int)(Gia_ManHashOne(pSlot[1], pSlot[2], Gia_ObjFaninLit2(p, pSlot[0])) & (unsigned)(nSlots - 1)) + nSlots) % nSlots;
+        Counts[Abc_MinInt(Dist, 8)]++;
+        Total += Dist + 1;
+        Counter++;
     }
+    printf( "Table size = %d. Entries = %d. Load = %.2f. ", nSlots, Counter, 1.0 * Counter / Abc_MaxInt(nSlots, 1) );
+    printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
+    printf( "Average probe length = %.2f. Distance counts:", Counter ? Total / Counter : 0.0 );
+    for ( i = 0; i < 9; i++ )
+        printf( " %d%s=%d", i, i == 8 ? "+" : "", Counts[i] );
     printf( "\n" );
 }
 
@@ -478,8 +532,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashUpdate( p );
     if ( iLit0 < iLit1 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
     if ( Abc_LitIsCompl(iLit0) )
@@ -494,15 +547,7 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendXorReal( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        *pPlace = Abc_Lit2Var( Gia_ManAppendXorReal( p, iLit0, iLit1 ) );
         return Abc_Var2Lit( *pPlace, fCompl );
     }
 }
@@ -541,6 +586,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
         iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1, iLitC = Abc_LitNot(iLitC);
     if ( Abc_LitIsCompl(iLit1) )
         iLit0 = Abc_LitNot(iLit0), iLit1 = Abc_LitNot(iLit1), fCompl = 1;
+    Gia_ManHashUpdate( p );
     {
         int *pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
         if ( *pPlace )
@@ -549,15 +595,7 @@ int Gia_ManHashMuxReal( Gia_Man_t * p, int iLitC, int iLit1, int iLit0 )
             return Abc_Var2Lit( *pPlace, fCompl );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
-        else
-        {
-            int iNode = Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, iLitC );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        *pPlace = Abc_Lit2Var( Gia_ManAppendMuxReal( p, iLitC, iLit1, iLit0 ) );
         return Abc_Var2Lit( *pPlace, fCompl );
     }
 }
@@ -588,8 +626,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
-    if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
-        Gia_ManHashResize( p );
+    Gia_ManHashUpdate( p );
     if ( p->fAddStrash )
     {
         Gia_Obj_t * pObj = Gia_ManAddStrash( p, Gia_ObjFromLit(p, iLit0), Gia_ObjFromLit(p, iLit1) );
@@ -606,15 +643,7 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
             return Abc_Var2Lit( *pPlace, 0 );
         }
         p->nHashMiss++;
-        if ( Vec_IntSize(&p->vHash) < Vec_IntCap(&p->vHash) )
-            *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
-        else
-        {
-            int iNode = Gia_ManAppendAnd( p, iLit0, iLit1 );
-            pPlace = Gia_ManHashFind( p, iLit0, iLit1, -1 );
-            assert( *pPlace == 0 );
-            *pPlace = Abc_Lit2Var( iNode );
-        }
+        *pPlace = Abc_Lit2Var( Gia_ManAppendAnd( p, iLit0, iLit1 ) );
         return Abc_Var2Lit( *pPlace, 0 );
     }
 }
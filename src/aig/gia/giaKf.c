@@ -1014,7 +1014,7 @@ void Kf_ManComputeCuts( Kf_Man_t * p )
     assert( nProcs <= PAR_THR_MAX );
     // start fanins
     vFanins = Kf_ManCreateFaninCounts( p->pGia );
-    Gia_ManStaticFanoutStart( p->pGia );
+    Gia_ManStaticFanoutStartPar( p->pGia, nProcs );
     // start the stack
     vStack = Vec_IntAlloc( 1000 );
     Gia_ManForEachObjReverse( p->pGia, pObj, k )
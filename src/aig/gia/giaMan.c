@@ -84,6 +84,8 @@ void Gia_ManStop( Gia_Man_t * p )
     if ( p->vSeqModelVec )
         Vec_PtrFreeFree( p->vSeqModelVec );
     Gia_ManStaticFanoutStop( p );
+    Gia_ManZipStop( p );
+    Gia_ManCutDbStop( p );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
     assert( p->pManTime == NULL );
     Vec_PtrFreeFree( p->vNamesIn );
@@ -192,10 +194,11 @@ void Gia_ManStop( Gia_Man_t * p )
 double Gia_ManMemory( Gia_Man_t * p )
 {
     double Memory = sizeof(Gia_Man_t);
-    Memory += sizeof(Gia_Obj_t) * Gia_ManObjNum(p);
+    Memory += p->pZip ? Gia_ManZipMemory(p) : sizeof(Gia_Obj_t) * Gia_ManObjNum(p);
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
     Memory += sizeof(int) * Vec_IntSize(&p->vHTable);
+    Memory += sizeof(int) * Vec_IntSize(&p->vHash);
     Memory += sizeof(int) * Gia_ManObjNum(p) * (p->pRefs != NULL);
     Memory += Vec_IntMemory( p->vLevels );
     Memory += Vec_IntMemory( p->vCellMapping );
@@ -493,6 +496,11 @@ void Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars )
 {
     extern float Gia_ManLevelAve( Gia_Man_t * p );
     int fHaveLevels = p->vLevels != NULL;
+    if ( Gia_ManIsZipped(p) )
+    {
+        Gia_ManZipPrintStats( p, pPars );
+        return;
+    }
     if ( pPars && pPars->fMiter )
     {
         Gia_ManPrintStatsMiter( p, 0 );
@@ -76,6 +76,7 @@ struct Mf_Man_t_
     int             iCur;           // current position
     int             Iter;           // mapping iterations
     int             fUseEla;        // use exact area
+    int             fUseCutDb;      // use cuts of the cut database
     // statistics
     abctime         clkStart;       // starting time
     double          CutCount[4];    // cut counts
@@ -1367,6 +1368,52 @@ Gia_Man_t * Mf_ManDeriveMappingGia( Mf_Man_t * p )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Loads the cuts of the node from the cut database.]
+
+  Description [The cuts of the database are ranked by the delay and the 
+  area flow of this mapper. Falls back to the cut merging, if the database
+  has no cuts of the given size.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Mf_ObjLoadCutDb( Mf_Man_t * p, int iObj )
+{
+    Mf_Cut_t pCuts[MF_CUT_MAX], * pCutsR[MF_CUT_MAX];
+    Mf_Obj_t * pBest = Mf_ManObj(p, iObj);
+    int nLutSize = p->pPars->nLutSize;
+    int nCutNum  = p->pPars->nCutNum;
+    int * pList  = Gia_ManCutDbCutSet( p->pGia, iObj );
+    int i, * pCut, nCutsR = 0;
+    for ( i = 0; i < nCutNum; i++ )
+        pCutsR[i] = pCuts + i;
+    for ( i = 0, pCut = pList + 1; i < pList[0]; i++, pCut += pCut[0] + 2 )
+    {
+        if ( pCut[0] < 2 || pCut[0] > nLutSize ) // skip the trivial cut
+            continue;
+        pCutsR[nCutsR]->nLeaves = pCut[0];
+        memcpy( pCutsR[nCutsR]->pLeaves, pCut+1, sizeof(int) * pCut[0] );
+        pCutsR[nCutsR]->iFunc = MF_NO_FUNC;
+        pCutsR[nCutsR]->Sign = Mf_CutGetSign( pCut+1, pCut[0] );
+        Mf_CutParams( p, pCutsR[nCutsR], pBest->nFlowRefs );
+        nCutsR = Mf_SetAddCut( pCutsR, nCutsR, nCutNum );
+    }
+    if ( nCutsR == 0 )
+    {
+        Mf_ObjMergeOrder( p, iObj );
+        return;
+    }
+    pBest->Flow = pCutsR[0]->Flow;
+    pBest->Delay = pCutsR[0]->Delay;
+    pBest->iCutSet = Mf_ManSaveCuts( p, pCutsR, nCutsR );
+    p->nCutCounts[pCutsR[0]->nLeaves]++;
+    p->CutCount[3] += nCutsR;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1488,6 +1535,7 @@ void Mf_ManPrintInit( Mf_Man_t * p )
     printf( "Edge = %d  ",    p->pPars->fOptEdge );
     printf( "CutMin = %d  ",  p->pPars->fCutMin );
     printf( "Coarse = %d  ",  p->pPars->fCoarsen );
+    printf( "CutDb = %d  ",   p->fUseCutDb );
     printf( "CNF = %d  ",     p->pPars->fGenCnf );
     printf( "FFL = %d  ",     p->pPars->fGenLit );
     printf( "\n" );
@@ -1532,7 +1580,10 @@ void Mf_ManComputeCuts( Mf_Man_t * p )
 {
     int i;
     Gia_ManForEachAndId( p->pGia, i )
-        Mf_ObjMergeOrder( p, i );
+        if ( p->fUseCutDb )
+            Mf_ObjLoadCutDb( p, i );
+        else
+            Mf_ObjMergeOrder( p, i );
     Mf_ManSetMapRefs( p );
     Mf_ManPrintStats( p, (char *)(p->fUseEla ? "Ela  " : (p->Iter ? "Area " : "Delay")) );
 }
@@ -1823,13 +1874,21 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
 {
     Mf_Man_t * p;
     Gia_Man_t * pNew, * pCls;
+    int fUseCutDb;
     if ( pPars->fGenCnf || pPars->fGenLit )
         pPars->fCutMin = 1;
     if ( Gia_ManHasChoices(pGia) )
         pPars->fCutMin = 1, pPars->fCoarsen = 0; 
+    // the cuts of the database are computed for the original AIG, not for the coarsened one
+    fUseCutDb = pGia->pCutDb && !pPars->fCutMin && !pPars->fCoarsen && Gia_ManCutDbCutSize(pGia) >= pPars->nLutSize;
+    if ( pPars->fVerbose && pGia->pCutDb && !fUseCutDb )
+        printf( "The cut database is not used (it requires mapping without coarsening, \"&mf -k\").\n" );
+    if ( fUseCutDb )
+        Gia_ManCutDbUpdate( pGia );
     pCls = pPars->fCoarsen ? Gia_ManDupMuxes(pGia, pPars->nCoarseLimit) : pGia;
     p = Mf_ManAlloc( pCls, pPars );
     p->pGia0 = pGia;
+    p->fUseCutDb = fUseCutDb;
     if ( pPars->fVerbose && pPars->fCoarsen )
     {
         printf( "Initial " );  Gia_ManPrintMuxStats( pGia );  printf( "\n" );
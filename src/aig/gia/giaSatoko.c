@@ -30,6 +30,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SATOKO_PORT_MAX 64  // the largest number of solvers in the portfolio
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -145,12 +147,45 @@ satoko_t * Gia_ManSatokoFromDimacs( char * pFileName, satoko_opts_t * opts )
     Vec_IntFree( vLits );
     return pSat;
 }
+int Gia_ManSatokoSolvePar( satoko_t ** pSats, int nSats, satoko_opts_t * opts, int * pCost )
+{
+    satoko_share_t * pShare = satoko_share_create( 8 );
+    int i, iWinner, status;
+    for ( i = 0; i < nSats; i++ )
+    {
+        satoko_configure( pSats[i], opts );
+        satoko_diversify( pSats[i], i );
+        satoko_share_attach( pSats[i], pShare, i );
+    }
+    status = satoko_portfolio_solve( pSats, nSats, &iWinner );
+    if ( opts->verbose )
+        for ( i = 0; i < nSats; i++ )
+            printf( "Solver %2d : Conf = %9ld.  Exported = %7ld.  Imported = %7ld.%s\n", i, 
+                satoko_stats(pSats[i])->n_conflicts, satoko_stats(pSats[i])->n_exported, 
+                satoko_stats(pSats[i])->n_imported, i == iWinner ? "  (winner)" : "" );
+    if ( pCost )
+        *pCost = satoko_stats(pSats[iWinner])->n_conflicts;
+    for ( i = 0; i < nSats; i++ )
+        satoko_share_attach( pSats[i], NULL, 0 );
+    satoko_share_destroy( pShare );
+    return status;
+}
 void Gia_ManSatokoDimacs( char * pFileName, satoko_opts_t * opts )
 {
     abctime clk = Abc_Clock();  
     int status = SATOKO_UNSAT;
     satoko_t * pSat = Gia_ManSatokoFromDimacs( pFileName, opts );
-    if ( pSat )
+    if ( pSat && opts->n_threads > 1 )
+    {
+        satoko_t * pSats[SATOKO_PORT_MAX] = { pSat };
+        int i, nSats = Abc_MinInt( opts->n_threads, SATOKO_PORT_MAX );
+        for ( i = 1; i < nSats; i++ )
+            pSats[i] = Gia_ManSatokoFromDimacs( pFileName, opts );
+        status = Gia_ManSatokoSolvePar( pSats, nSats, opts, NULL );
+        for ( i = 0; i < nSats; i++ )
+            satoko_destroy( pSats[i] );
+    }
+    else if ( pSat )
     {
         status = satoko_solve( pSat );
         satoko_destroy( pSat );
@@ -196,11 +231,35 @@ satoko_t * Gia_ManSatokoCreate( Gia_Man_t * p, satoko_opts_t * opts )
     satoko_destroy( pSat );
     return NULL;
 }
+int Gia_ManSatokoCallOnePar( Gia_Man_t * p, satoko_opts_t * opts, int iOutput )
+{
+    abctime clk = Abc_Clock();
+    satoko_t * pSats[SATOKO_PORT_MAX] = { NULL };
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 1, 0, 0 );
+    int i, nSats = Abc_MinInt( opts->n_threads, SATOKO_PORT_MAX );
+    int status = SATOKO_UNSAT, Cost = 0;
+    for ( i = 0; i < nSats; i++ )
+    {
+        pSats[i] = Gia_ManSatokoInit( pCnf, opts );
+        if ( pSats[i] == NULL || satoko_simplify(pSats[i]) != SATOKO_OK )
+            break;
+    }
+    Cnf_DataFree( pCnf );
+    if ( i == nSats )
+        status = Gia_ManSatokoSolvePar( pSats, nSats, opts, &Cost );
+    for ( i = 0; i < nSats; i++ )
+        if ( pSats[i] )
+            satoko_destroy( pSats[i] );
+    Gia_ManSatokoReport( iOutput, status, Abc_Clock() - clk );
+    return Cost;
+}
 int Gia_ManSatokoCallOne( Gia_Man_t * p, satoko_opts_t * opts, int iOutput )
 {
     abctime clk = Abc_Clock();
     satoko_t * pSat;
     int status = SATOKO_UNSAT, Cost = 0;
+    if ( opts->n_threads > 1 )
+        return Gia_ManSatokoCallOnePar( p, opts, iOutput );
     pSat = Gia_ManSatokoCreate( p, opts );
     if ( pSat )
     {
@@ -21,7 +21,7 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
-//#include <immintrin.h>
+#include "misc/util/utilSimd.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -98,7 +98,14 @@ static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
     word * pSims2 = pSims + nWords*i; int w;
-    if ( Gia_ObjIsXor(pObj) )
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+    {
+        if ( Gia_ObjIsXor(pObj) )
+            Abc_SimdXor( pSims2, pSims0, pSims1, Diff0, Diff1, nWords );
+        else
+            Abc_SimdAnd( pSims2, pSims0, pSims1, Diff0, Diff1, nWords );
+    }
+    else if ( Gia_ObjIsXor(pObj) )
         for ( w = 0; w < nWords; w++ )
             pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
     else
@@ -357,55 +364,57 @@ Gia_Man_t * Gia_ManPerformMuxDec( Gia_Man_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Computes the TFO of each CI.]
 
-  Description []
+  Description [For each CI, returns the CI, the internal nodes in its TFO
+  that are also in the TFI of some CO, in a topological order, and the 
+  indexes of the affected output pairs (offset by the number of objects).]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Gia_ManComputeTfos_rec( Gia_Man_t * p, int iObj, int iRoot, Vec_Int_t * vNode )
-{
-    Gia_Obj_t * pObj;
-    if ( Gia_ObjIsTravIdPreviousId(p, iObj) )
-        return 1;
-    if ( Gia_ObjIsTravIdCurrentId(p, iObj) )
-        return 0;
-    pObj = Gia_ManObj( p, iObj );
-    if ( !Gia_ObjIsAnd(pObj) )
-        return 0;
-    if ( Gia_ManComputeTfos_rec( p, Gia_ObjFaninId0(pObj, iObj), iRoot, vNode ) |
-         Gia_ManComputeTfos_rec( p, Gia_ObjFaninId1(pObj, iObj), iRoot, vNode ) )
-    {
-         Gia_ObjSetTravIdPreviousId(p, iObj);
-         Vec_IntPush( vNode, iObj );
-         return 1;
-    }
-    Gia_ObjSetTravIdCurrentId(p, iObj);
-    return 0;
-}
 Vec_Wec_t * Gia_ManComputeTfos( Gia_Man_t * p )
 {
     Vec_Wec_t * vNodes = Vec_WecStart( Gia_ManCiNum(p) );
+    Vec_Bit_t * vReach = Vec_BitStart( Gia_ManObjNum(p) );
+    Vec_Int_t * vTfo = Vec_IntAlloc( 100 );
     Vec_Int_t * vTemp = Vec_IntAlloc( 100 );
-    int i, o, IdCi, IdCo;
+    Gia_Fan_t * f = Gia_ManFanIndexStart( p, 1 );
+    Gia_Obj_t * pObj;
+    int i, k, IdCi, iObj;
+    // mark the nodes in the TFI of the COs (dangling nodes are skipped)
+    Gia_ManForEachObjReverse( p, pObj, iObj )
+    {
+        if ( Gia_ObjIsCo(pObj) )
+            Vec_BitWriteEntry( vReach, Gia_ObjFaninId0(pObj, iObj), 1 );
+        else if ( Gia_ObjIsAnd(pObj) && Vec_BitEntry(vReach, iObj) )
+        {
+            Vec_BitWriteEntry( vReach, Gia_ObjFaninId0(pObj, iObj), 1 );
+            Vec_BitWriteEntry( vReach, Gia_ObjFaninId1(pObj, iObj), 1 );
+        }
+    }
     Gia_ManForEachCiId( p, IdCi, i )
     {
         Vec_Int_t * vNode = Vec_WecEntry( vNodes, i );
-        Gia_ManIncrementTravId( p );
-        Gia_ManIncrementTravId( p );
-        Gia_ObjSetTravIdPreviousId(p, IdCi);
-        Vec_IntPush( vNode, IdCi );
+        Gia_ManFanIndexCollectTfo( p, f, &IdCi, 1, vTfo );
         Vec_IntClear( vTemp );
-        Gia_ManForEachCoId( p, IdCo, o )
-            if ( Gia_ManComputeTfos_rec( p, Gia_ObjFaninId0(Gia_ManObj(p, IdCo), IdCo), IdCi, vNode ) )
-                Vec_IntPush( vTemp, Gia_ManObjNum(p) + (o >> 1) );
+        Vec_IntForEachEntry( vTfo, iObj, k )
+        {
+            pObj = Gia_ManObj( p, iObj );
+            if ( Gia_ObjIsCo(pObj) )
+                Vec_IntPush( vTemp, Gia_ManObjNum(p) + (Gia_ObjCioId(pObj) >> 1) );
+            else if ( iObj == IdCi || (Gia_ObjIsAnd(pObj) && Vec_BitEntry(vReach, iObj)) )
+                Vec_IntPush( vNode, iObj );
+        }
         Vec_IntUniqify( vTemp );
         Vec_IntAppend( vNode, vTemp );
     }
+    Gia_ManFanIndexStop( f );
     Vec_IntFree( vTemp );
+    Vec_IntFree( vTfo );
+    Vec_BitFree( vReach );
     Vec_WecSort( vNodes, 1 );
     //Vec_WecPrint( vNodes, 0 );
     //Gia_AigerWrite( p, "dump.aig", 0, 0, 0 );
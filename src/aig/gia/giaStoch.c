@@ -21,6 +21,18 @@
 #include "gia.h"
 #include "base/main/main.h"
 #include "base/cmd/cmd.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -67,53 +79,190 @@ Gia_Man_t * Gia_ManDupWithMapping( Gia_Man_t * pGia )
     Gia_ManDupMapping( pCopy, pGia );
     return pCopy;
 }
-void Gia_ManStochSynthesis( Vec_Ptr_t * vAigs, char * pScript )
+Gia_Man_t * Gia_StochProcessOne( Abc_Frame_t * pAbc, Gia_Man_t * pGia, char * pScript, int * pfError )
 {
-    Gia_Man_t * pGia, * pNew; int i;
-    Vec_PtrForEachEntry( Gia_Man_t *, vAigs, pGia, i )
+    Gia_Man_t * pNew, * pCopy = Gia_ManDupWithMapping(pGia);
+    Abc_FrameUpdateGia( pAbc, pGia );
+    if ( Cmd_CommandExecute(pAbc, pScript) )
     {
-        Gia_Man_t * pCopy = Gia_ManDupWithMapping(pGia);
-        Abc_FrameUpdateGia( Abc_FrameGetGlobalFrame(), pGia );
-        if ( Abc_FrameIsBatchMode() )
+        Abc_Print( 1, "Something did not work out with the command \"%s\".\n", pScript );
+        *pfError = 1;
+        return pCopy;
+    }
+    pNew = Abc_FrameReadGia(pAbc);
+    if ( Gia_ManHasMapping(pNew) && Gia_ManHasMapping(pCopy) )
+    {
+        if ( Gia_ManLutNum(pNew) < Gia_ManLutNum(pCopy) )
         {
-            if ( Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), pScript) )
-            {
-                Abc_Print( 1, "Something did not work out with the command \"%s\".\n", pScript );
-                return;
-            }
+            Gia_ManStop( pCopy );
+            pCopy = Gia_ManDupWithMapping( pNew );
         }
-        else
+    }
+    else
+    {
+        if ( Gia_ManAndNum(pNew) < Gia_ManAndNum(pCopy) )
         {
-            Abc_FrameSetBatchMode( 1 );
-            if ( Cmd_CommandExecute(Abc_FrameGetGlobalFrame(), pScript) )
-            {
-                Abc_Print( 1, "Something did not work out with the command \"%s\".\n", pScript );
-                Abc_FrameSetBatchMode( 0 );
-                return;
-            }
-            Abc_FrameSetBatchMode( 0 );
+            Gia_ManStop( pCopy );
+            pCopy = Gia_ManDup( pNew );
         }
-        pNew = Abc_FrameReadGia(Abc_FrameGetGlobalFrame());
-        if ( Gia_ManHasMapping(pNew) && Gia_ManHasMapping(pCopy) )
+    }
+    return pCopy;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the partitions in the current thread.]
+
+  Description [The script is run in a private frame, as it is done by 
+  the worker threads (see Gia_ManStochSynthesisPar), so that the current
+  design of the global frame, including its CI/CO names, is not replaced
+  by the partitions, and the result does not depend on the thread count.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManStochSynthesis( Vec_Ptr_t * vAigs, char * pScript )
+{
+    Abc_Frame_t * pAbc = Abc_FramePrivateStart();
+    Gia_Man_t * pGia; int i, fError = 0;
+    Vec_PtrForEachEntry( Gia_Man_t *, vAigs, pGia, i )
+    {
+        Abc_Random( 1 );
+        Gia_ManRandom( 1 );
+        Vec_PtrWriteEntry( vAigs, i, Gia_StochProcessOne(pAbc, pGia, pScript, &fError) );
+        if ( fError )
+            break;
+    }
+    Abc_FramePrivateStop( pAbc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the partitions concurrently.]
+
+  Description [Each worker thread runs the script in its own private frame.
+  The random number generators are thread-local and reset before each 
+  partition, so the result of a partition does not depend on the thread 
+  that processed it, and the output is the same for any thread count.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Gia_ManStochSynthesisPar( Vec_Ptr_t * vAigs, char * pScript, int nProcs, int fVerbose ) { Gia_ManStochSynthesis( vAigs, pScript ); }
+
+#else // pthreads are used
+
+#define STOCH_THR_MAX 100
+typedef struct Gia_StochThData_t_
+{
+    Abc_Frame_t * pAbc;
+    Gia_Man_t *   pGia;
+    char *        pScript;
+    int           iAig;
+    volatile int  fWorking;
+    int           fError;
+} Gia_StochThData_t;
+void * Gia_StochWorkerThread( void * pArg )
+{
+    extern void Dar_LibStop();
+    Gia_StochThData_t * pThData = (Gia_StochThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    Abc_FrameSetThreadFrame( pThData->pAbc );
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        ABC_FENCE();
+        assert( pThData->fWorking );
+        if ( pThData->pGia == NULL )
         {
-            if ( Gia_ManLutNum(pNew) < Gia_ManLutNum(pCopy) )
-            {
-                Gia_ManStop( pCopy );
-                pCopy = Gia_ManDupWithMapping( pNew );
-            }
+            Abc_FrameSetThreadFrame( NULL );
+            Dar_LibStop(); // the library is started on demand in each thread
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
         }
-        else
+        Abc_Random( 1 );
+        Gia_ManRandom( 1 );
+        pThData->pGia = Gia_StochProcessOne( pThData->pAbc, pThData->pGia, pThData->pScript, &pThData->fError );
+        ABC_FENCE();
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void Gia_ManStochSynthesisPar( Vec_Ptr_t * vAigs, char * pScript, int nProcs, int fVerbose )
+{
+    Gia_StochThData_t ThData[STOCH_THR_MAX];
+    pthread_t WorkerThread[STOCH_THR_MAX];
+    int i, status, iNext = 0, nErrors = 0, fWorkToDo = 1;
+    nProcs = Abc_MinInt( nProcs, Abc_MinInt(Vec_PtrSize(vAigs), STOCH_THR_MAX) );
+    if ( nProcs <= 1 )
+    {
+        Gia_ManStochSynthesis( vAigs, pScript );
+        return;
+    }
+    // start threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pAbc     = Abc_FramePrivateStart();
+        ThData[i].pGia     = NULL;
+        ThData[i].pScript  = pScript;
+        ThData[i].iAig     = -1;
+        ThData[i].fWorking = 0;
+        ThData[i].fError   = 0;
+        status = pthread_create( WorkerThread + i, NULL, Gia_StochWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // distribute partitions in their order
+    while ( fWorkToDo )
+    {
+        fWorkToDo = (int)(iNext < Vec_PtrSize(vAigs));
+        for ( i = 0; i < nProcs; i++ )
         {
-            if ( Gia_ManAndNum(pNew) < Gia_ManAndNum(pCopy) )
+            if ( ThData[i].fWorking )
             {
-                Gia_ManStop( pCopy );
-                pCopy = Gia_ManDup( pNew );
+                fWorkToDo = 1;
+                continue;
             }
+            ABC_FENCE();
+            if ( ThData[i].iAig >= 0 )
+            {
+                Vec_PtrWriteEntry( vAigs, ThData[i].iAig, ThData[i].pGia );
+                ThData[i].pGia = NULL;
+                ThData[i].iAig = -1;
+            }
+            if ( iNext == Vec_PtrSize(vAigs) )
+                continue;
+            ThData[i].iAig     = iNext;
+            ThData[i].pGia     = (Gia_Man_t *)Vec_PtrEntry( vAigs, iNext++ );
+            ABC_FENCE();
+            ThData[i].fWorking = 1;
         }
-        Vec_PtrWriteEntry( vAigs, i, pCopy );
     }
+    // stop threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        assert( !ThData[i].fWorking && ThData[i].pGia == NULL );
+        ABC_FENCE();
+        ThData[i].fWorking = 1;
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        nErrors += ThData[i].fError;
+        Abc_FramePrivateStop( ThData[i].pAbc );
+    }
+    if ( fVerbose && nErrors )
+        printf( "The script failed in %d thread(s); the original partitions were kept.\n", nErrors );
 }
 
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -184,7 +333,7 @@ Gia_Man_t * Gia_ManDupDivideOne( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vA
     pNew->vMapping = vMapping;
     return pNew;
 }
-Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, char * pScript )
+Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, char * pScript, int nProcs, int fVerbose )
 {
     Vec_Ptr_t * vAigs = Vec_PtrAlloc( Vec_WecSize(vCis) );  int i;
     for ( i = 0; i < Vec_WecSize(vCis); i++ )
@@ -192,7 +341,10 @@ Vec_Ptr_t * Gia_ManDupDivide( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds
         Gia_ManCollectNodes( p, Vec_WecEntry(vCis, i), Vec_WecEntry(vAnds, i), Vec_WecEntry(vCos, i) );
         Vec_PtrPush( vAigs, Gia_ManDupDivideOne(p, Vec_WecEntry(vCis, i), Vec_WecEntry(vAnds, i), Vec_WecEntry(vCos, i)) );
     }
-    Gia_ManStochSynthesis( vAigs, pScript );
+    if ( nProcs > 1 )
+        Gia_ManStochSynthesisPar( vAigs, pScript, nProcs, fVerbose );
+    else
+        Gia_ManStochSynthesis( vAigs, pScript );
     return vAigs;
 }
 Gia_Man_t * Gia_ManDupStitch( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, Vec_Ptr_t * vAigs, int fHash )
@@ -388,26 +540,33 @@ Vec_Wec_t * Gia_ManStochOutputs( Gia_Man_t * p, Vec_Wec_t * vAnds )
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_ManStochSyn( int nMaxSize, int nIters, int TimeOut, int Seed, int fVerbose, char * pScript )
+int Gia_ManStochSeed( int Seed, int iIter )
+{
+    // the generator is derived again in each iteration because the serial
+    // flow resets it in the current thread before processing each partition
+    int i;
+    Abc_Random(1);
+    for ( i = 0; i < 10+Seed+iIter; i++ )
+        Abc_Random(0);
+    return Abc_Random(0) & 0x7FFFFFFF;
+}
+void Gia_ManStochSyn( int nMaxSize, int nIters, int TimeOut, int Seed, int nProcs, int fVerbose, char * pScript )
 {
     abctime nTimeToStop  = TimeOut ? Abc_Clock() + TimeOut * CLOCKS_PER_SEC : 0;
     abctime clkStart     = Abc_Clock();
     int fMapped          = Gia_ManHasMapping(Abc_FrameReadGia(Abc_FrameGetGlobalFrame()));
     int nLutEnd, nLutBeg = fMapped ? Gia_ManLutNum(Abc_FrameReadGia(Abc_FrameGetGlobalFrame())) : 0;
     int i, nEnd, nBeg    = Gia_ManAndNum(Abc_FrameReadGia(Abc_FrameGetGlobalFrame()));
-    Abc_Random(1);
-    for ( i = 0; i < 10+Seed; i++ )
-        Abc_Random(0);
     if ( fVerbose )
-    printf( "Running %d iterations of script \"%s\".\n", nIters, pScript );
+    printf( "Running %d iterations of script \"%s\" using %d thread(s).\n", nIters, pScript, Abc_MaxInt(nProcs, 1) );
     for ( i = 0; i < nIters; i++ )
     {
         abctime clk = Abc_Clock();
         Gia_Man_t * pGia  = Gia_ManDupWithMapping( Abc_FrameReadGia(Abc_FrameGetGlobalFrame()) );
-        Vec_Wec_t * vAnds = Gia_ManStochNodes( pGia, nMaxSize, Abc_Random(0) & 0x7FFFFFFF );
+        Vec_Wec_t * vAnds = Gia_ManStochNodes( pGia, nMaxSize, Gia_ManStochSeed(Seed, i) );
         Vec_Wec_t * vIns  = Gia_ManStochInputs( pGia, vAnds );
         Vec_Wec_t * vOuts = Gia_ManStochOutputs( pGia, vAnds );
-        Vec_Ptr_t * vAigs = Gia_ManDupDivide( pGia, vIns, vAnds, vOuts, pScript );
+        Vec_Ptr_t * vAigs = Gia_ManDupDivide( pGia, vIns, vAnds, vOuts, pScript, nProcs, fVerbose );
         Gia_Man_t * pNew  = Gia_ManDupStitchMap( pGia, vIns, vAnds, vOuts, vAigs );
         int fMapped = Gia_ManHasMapping(pGia) && Gia_ManHasMapping(pNew);
         Abc_FrameUpdateGia( Abc_FrameGetGlobalFrame(), pNew );
@@ -0,0 +1,931 @@
+/**CFile****************************************************************
+
+  FileName    [giaZip.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Compressed storage of AIG objects.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: giaZip.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The objects are split into blocks of 2^nBlockLog consecutive IDs.
+// Each block starts with the number of CIs and COs before it, followed
+// by one or two AIGER-style varints per object:
+//   CI    : X = 0
+//   const : X = 2
+//   CO    : X = ((iDiff0 << 1 | fCompl0) << 1) | 1
+//   AND   : X =  (iDiff1 << 1 | fCompl1) << 1 (X >= 4 because iDiff1 > 0)
+//           Y =  zigzag(iDiff0 - iDiff1) << 1 | fCompl0
+// The fanins of an AND node are usually close, so most nodes take 2-4 bytes
+// compared to 12 bytes in Gia_Obj_t. The decoded blocks are kept in a small
+// direct-mapped cache, which makes sequential traversals decode each block once.
+
+static inline unsigned Gia_ZipZigZag( int x )         { return ((unsigned)x << 1) ^ (unsigned)(x >> 31); }
+static inline int      Gia_ZipUnZigZag( unsigned x )  { return (int)(x >> 1) ^ -(int)(x & 1);            }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the compressed storage.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Zip_t * Gia_ZipAlloc( int nBlockLog, int nCacheLog )
+{
+    Gia_Zip_t * z = ABC_CALLOC( Gia_Zip_t, 1 );
+    z->nBlockLog = nBlockLog;
+    z->nCacheLog = nCacheLog;
+    z->vBlocks   = Vec_PtrAlloc( 100 );
+    z->vBlock    = Vec_StrAlloc( 4 << nBlockLog );
+    z->pCacheIds = ABC_FALLOC( int, 1 << nCacheLog );
+    z->pCache    = ABC_ALLOC( Gia_Obj_t, (size_t)1 << (nBlockLog + nCacheLog) );
+    return z;
+}
+void Gia_ZipFree( Gia_Zip_t * z )
+{
+    Vec_PtrFreeFree( z->vBlocks );
+    Vec_StrFreeP( &z->vBlock );
+    ABC_FREE( z->pCacheIds );
+    ABC_FREE( z->pCache );
+    ABC_FREE( z );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Appends one object to the compressed storage.]
+
+  Description [Objects should be added in the order of their IDs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ZipFlush( Gia_Zip_t * z )
+{
+    char * pBlock = ABC_ALLOC( char, Vec_StrSize(z->vBlock) );
+    memcpy( pBlock, Vec_StrArray(z->vBlock), (size_t)Vec_StrSize(z->vBlock) );
+    Vec_PtrPush( z->vBlocks, pBlock );
+    z->nBytes += Vec_StrSize(z->vBlock);
+    Vec_StrClear( z->vBlock );
+}
+void Gia_ZipAppendObj( Gia_Zip_t * z, Gia_Obj_t * pObj )
+{
+    if ( (z->nObjs & ((1 << z->nBlockLog) - 1)) == 0 )
+    {
+        if ( z->nObjs > 0 )
+            Gia_ZipFlush( z );
+        Gia_AigerWriteUnsigned( z->vBlock, z->nCis );
+        Gia_AigerWriteUnsigned( z->vBlock, z->nCos );
+    }
+    if ( Gia_ObjIsCi(pObj) )
+    {
+        Gia_AigerWriteUnsigned( z->vBlock, 0 );
+        z->nCis++;
+    }
+    else if ( Gia_ObjIsCo(pObj) )
+    {
+        Gia_AigerWriteUnsigned( z->vBlock, (((unsigned)pObj->iDiff0 << 1 | pObj->fCompl0) << 1) | 1 );
+        z->nCos++;
+    }
+    else if ( Gia_ObjIsAnd(pObj) )
+    {
+        Gia_AigerWriteUnsigned( z->vBlock, ((unsigned)pObj->iDiff1 << 1 | pObj->fCompl1) << 1 );
+        Gia_AigerWriteUnsigned( z->vBlock, Gia_ZipZigZag((int)pObj->iDiff0 - (int)pObj->iDiff1) << 1 | pObj->fCompl0 );
+    }
+    else
+    {
+        assert( Gia_ObjIsConst0(pObj) );
+        Gia_AigerWriteUnsigned( z->vBlock, 2 );
+    }
+    z->nObjs++;
+}
+void Gia_ZipFinish( Gia_Zip_t * z )
+{
+    if ( Vec_StrSize(z->vBlock) > 0 )
+        Gia_ZipFlush( z );
+    Vec_StrFreeP( &z->vBlock );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes one block into the given array of objects.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ZipDecode( Gia_Zip_t * z, int iBlock, Gia_Obj_t * pObjs )
+{
+    unsigned char * pPos = (unsigned char *)Vec_PtrEntry( z->vBlocks, iBlock );
+    int nObjs = Abc_MinInt( 1 << z->nBlockLog, z->nObjs - (iBlock << z->nBlockLog) );
+    int nCis  = Gia_AigerReadUnsigned( &pPos );
+    int nCos  = Gia_AigerReadUnsigned( &pPos );
+    Gia_Obj_t * pObj;
+    unsigned X, Y;
+    memset( pObjs, 0, sizeof(Gia_Obj_t) * nObjs );
+    for ( pObj = pObjs; pObj < pObjs + nObjs; pObj++ )
+    {
+        X = Gia_AigerReadUnsigned( &pPos );
+        if ( X == 0 )
+        {
+            pObj->fTerm   = 1;
+            pObj->iDiff0  = GIA_NONE;
+            pObj->iDiff1  = nCis++;
+        }
+        else if ( X == 2 )
+        {
+            pObj->iDiff0  = GIA_NONE;
+            pObj->iDiff1  = GIA_NONE;
+        }
+        else if ( X & 1 )
+        {
+            pObj->fTerm   = 1;
+            pObj->fCompl0 = (X >> 1) & 1;
+            pObj->iDiff0  = X >> 2;
+            pObj->iDiff1  = nCos++;
+        }
+        else
+        {
+            Y = Gia_AigerReadUnsigned( &pPos );
+            pObj->fCompl1 = (X >> 1) & 1;
+            pObj->iDiff1  = X >> 2;
+            pObj->fCompl0 = Y & 1;
+            pObj->iDiff0  = (int)pObj->iDiff1 + Gia_ZipUnZigZag( Y >> 1 );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes one block into the cache line.]
+
+  Description [Called by Gia_ManZipObj() when the block is not cached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManZipLoad( Gia_Man_t * p, int iBlock, int iLine )
+{
+    Gia_Zip_t * z = p->pZip;
+    Gia_ZipDecode( z, iBlock, z->pCache + ((size_t)iLine << z->nBlockLog) );
+    z->pCacheIds[iLine] = iBlock;
+    z->nLoads++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compresses the objects of the AIG.]
+
+  Description [Replaces the object array by the compressed storage and
+  releases the data derived from the objects (levels, references, copies,
+  fanouts, structural hashing). Returns 0 if the AIG has data attached
+  to individual objects that cannot be kept (muxes, choices, equivalences,
+  mapping, placement, node names). The flags fMark0 and fMark1 and the 
+  object values are not preserved; the phase is recomputed when the objects
+  are restored by Gia_ManUnzip().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManZip( Gia_Man_t * p, int nBlockLog, int nCacheLog, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Gia_Obj_t * pObj;
+    Gia_Zip_t * z;
+    int i;
+    if ( p->pZip )
+        return 1;
+    if ( p->pMuxes || p->pReprs || p->pNexts || p->pSibls || p->vMapping || p->vCellMapping || p->vPacking ||
+         p->pPlacement || p->vNamesNode || p->vObjClasses || p->vGateClasses || p->vEdge1 )
+    {
+        Abc_Print( 1, "Gia_ManZip(): Cannot compress the AIG with muxes, choices, mapping, or other node data.\n" );
+        return 0;
+    }
+    assert( nBlockLog >= 4 && nBlockLog <= 20 );
+    assert( nCacheLog >= 0 && nCacheLog <= 12 );
+    z = Gia_ZipAlloc( nBlockLog, nCacheLog );
+    Gia_ManForEachObj( p, pObj, i )
+        Gia_ZipAppendObj( z, pObj );
+    Gia_ZipFinish( z );
+    assert( z->nObjs == Gia_ManObjNum(p) );
+    assert( z->nCis == Gia_ManCiNum(p) && z->nCos == Gia_ManCoNum(p) );
+    // release the objects and the data indexed by them
+    Gia_ManStaticFanoutStop( p );
+    if ( p->pFanData )
+        Gia_ManFanoutStop( p );
+    Gia_ManHashStop( p );
+    Vec_IntFreeP( &p->vLevels );
+    Vec_IntErase( &p->vCopies );
+    Vec_IntErase( &p->vCopies2 );
+    Vec_IntErase( &p->vRefs );
+    ABC_FREE( p->pRefs );
+    ABC_FREE( p->pLutRefs );
+    ABC_FREE( p->pTravIds );
+    p->nTravIdsAlloc = 0;
+    ABC_FREE( p->pObjs );
+    p->nObjsAlloc = 0;
+    p->pZip = z;
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Compressed %d objects into %d blocks of %d objects using %.2f MB (%.2f bytes per object).  ",
+            Gia_ManObjNum(p), Vec_PtrSize(z->vBlocks), 1 << nBlockLog, 1.0*z->nBytes/(1<<20), 1.0*z->nBytes/Gia_ManObjNum(p) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the object array of the compressed AIG.]
+
+  Description [The phase of the objects is not stored in the encoding;
+  it is recomputed after decoding.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManUnzip( Gia_Man_t * p )
+{
+    Gia_Zip_t * z = p->pZip;
+    int i;
+    if ( z == NULL )
+        return;
+    assert( p->pObjs == NULL && z->nObjs == p->nObjs );
+    p->pObjs = ABC_ALLOC( Gia_Obj_t, p->nObjs );
+    p->nObjsAlloc = p->nObjs;
+    for ( i = 0; i < Vec_PtrSize(z->vBlocks); i++ )
+        Gia_ZipDecode( z, i, p->pObjs + ((size_t)i << z->nBlockLog) );
+    Gia_ZipFree( z );
+    p->pZip = NULL;
+    Gia_ManSetPhase( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the compressed objects without restoring them.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManZipStop( Gia_Man_t * p )
+{
+    if ( p->pZip == NULL )
+        return;
+    Gia_ZipFree( p->pZip );
+    p->pZip = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads one AIGER varint from the file.]
+
+  Description [Returns 0 at the end of the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_ZipReadUnsignedFile( FILE * pFile, unsigned * pX )
+{
+    unsigned x = 0;
+    int i = 0, ch;
+    while ( (ch = getc(pFile)) != EOF )
+    {
+        x |= (unsigned)(ch & 0x7f) << (7 * i++);
+        if ( (ch & 0x80) == 0 )
+        {
+            *pX = x;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the binary AIGER file directly into the compressed AIG.]
+
+  Description [The objects are appended to the compressed storage as they
+  are read, so the object array is never allocated and the memory peak is
+  the compressed size plus one literal per CO. As with "&r -s", the AIG
+  is not structurally hashed and the dangling nodes are kept. The CI and
+  CO names are read from the symbol table. The AIGER 1.9 fields (except
+  bad states and constraints), the non-zero initial values, and the ABC 
+  extensions after the comment are not supported; such files should be 
+  read by &r and compressed by &zip. Returns NULL on failure.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManZipReadAiger( char * pFileName, int nBlockLog, int nCacheLog, int fVerbose )
+{
+    extern char * Gia_FileNameGeneric( char * FileName );
+    abctime clk = Abc_Clock();
+    Gia_Man_t * pNew;
+    Gia_Zip_t * z;
+    Gia_Obj_t Obj;
+    Vec_Int_t * vLits;
+    Vec_Ptr_t * vNames[3] = { NULL, NULL, NULL };
+    char Buffer[1000], * pName;
+    unsigned Delta0, Delta1, uLit, uLit0, uLit1;
+    int nTotal, nInputs, nLatches, nOutputs, nAnds, nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
+    int i, k, iObj, iTerm, nCis, nBufs = 0, fError = 0;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( -1, "Gia_ManZipReadAiger(): Cannot open the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    // read the parameters (M I L O A + B C J F)
+    if ( fgets( Buffer, 1000, pFile ) == NULL || strncmp( Buffer, "aig ", 4 ) ||
+         sscanf( Buffer + 4, "%d %d %d %d %d %d %d %d %d", &nTotal, &nInputs, &nLatches, &nOutputs, &nAnds, &nBad, &nConstr, &nJust, &nFair ) < 5 )
+    {
+        Abc_Print( -1, "Gia_ManZipReadAiger(): The file \"%s\" is not a binary AIGER file.\n", pFileName );
+        fclose( pFile );
+        return NULL;
+    }
+    if ( nTotal != nInputs + nLatches + nAnds || nInputs < 0 || nLatches < 0 || nOutputs < 0 || nAnds < 0 )
+    {
+        Abc_Print( -1, "Gia_ManZipReadAiger(): The number of objects does not match.\n" );
+        fclose( pFile );
+        return NULL;
+    }
+    if ( nJust || nFair )
+    {
+        Abc_Print( -1, "Gia_ManZipReadAiger(): Reading AIGER files with liveness properties is not supported.\n" );
+        fclose( pFile );
+        return NULL;
+    }
+    nOutputs += nBad + nConstr;
+    // read the latch and PO literals
+    vLits = Vec_IntAlloc( nLatches + nOutputs );
+    for ( i = 0; !fError && i < nLatches + nOutputs; i++ )
+    {
+        int Init = 0, nItems;
+        if ( fgets( Buffer, 1000, pFile ) == NULL )
+            fError = 1;
+        else if ( (nItems = sscanf( Buffer, "%u %d", &uLit, &Init )) < 1 || (int)(uLit >> 1) > nTotal )
+            fError = 1;
+        else if ( i < nLatches && nItems == 2 && Init != 0 )
+        {
+            Abc_Print( -1, "Gia_ManZipReadAiger(): Latches with non-zero initial values are not supported.\n" );
+            fError = 2;
+        }
+        else
+            Vec_IntPush( vLits, (int)uLit );
+    }
+    // create the constant node and the CIs
+    z = Gia_ZipAlloc( nBlockLog, nCacheLog );
+    memset( &Obj, 0, sizeof(Gia_Obj_t) );
+    Obj.iDiff0 = Obj.iDiff1 = GIA_NONE;
+    Gia_ZipAppendObj( z, &Obj );
+    Obj.fTerm = 1;
+    for ( i = 0; i < nInputs + nLatches; i++ )
+        Gia_ZipAppendObj( z, &Obj );
+    // create the AND nodes (the fanin with the smaller literal is the first one)
+    for ( i = 0; !fError && i < nAnds; i++ )
+    {
+        iObj  = 1 + nInputs + nLatches + i;
+        uLit  = (unsigned)iObj << 1;
+        if ( !Gia_ZipReadUnsignedFile( pFile, &Delta0 ) || !Gia_ZipReadUnsignedFile( pFile, &Delta1 ) || Delta0 == 0 || Delta0 > uLit || Delta1 > uLit - Delta0 )
+        {
+            fError = 1;
+            break;
+        }
+        uLit1 = uLit  - Delta0;
+        uLit0 = uLit1 - Delta1;
+        if ( uLit0 != uLit1 && (uLit0 >> 1) == (uLit1 >> 1) )
+        {
+            Abc_Print( -1, "Gia_ManZipReadAiger(): Node %d has complemented fanins (read the file by \"&r\").\n", iObj );
+            fError = 2;
+            break;
+        }
+        memset( &Obj, 0, sizeof(Gia_Obj_t) );
+        Obj.iDiff0  = iObj - (uLit0 >> 1);
+        Obj.fCompl0 = uLit0 & 1;
+        Obj.iDiff1  = iObj - (uLit1 >> 1);
+        Obj.fCompl1 = uLit1 & 1;
+        nBufs += (uLit0 == uLit1);
+        Gia_ZipAppendObj( z, &Obj );
+    }
+    // create the POs followed by the latch inputs
+    for ( k = 0; !fError && k < nOutputs + nLatches; k++ )
+    {
+        uLit = (unsigned)Vec_IntEntry( vLits, k < nOutputs ? nLatches + k : k - nOutputs );
+        memset( &Obj, 0, sizeof(Gia_Obj_t) );
+        Obj.fTerm   = 1;
+        Obj.iDiff0  = z->nObjs - (uLit >> 1);
+        Obj.fCompl0 = uLit & 1;
+        Gia_ZipAppendObj( z, &Obj );
+    }
+    Vec_IntFree( vLits );
+    if ( fError )
+    {
+        if ( fError == 1 )
+            Abc_Print( -1, "Gia_ManZipReadAiger(): The file \"%s\" is corrupted.\n", pFileName );
+        Gia_ZipFree( z );
+        fclose( pFile );
+        return NULL;
+    }
+    Gia_ZipFinish( z );
+    // read the CI and CO names (inputs, latch outputs, outputs)
+    while ( !fError && fgets( Buffer, 1000, pFile ) != NULL && Buffer[0] != 'c' )
+    {
+        k = Buffer[0] == 'i' ? 0 : (Buffer[0] == 'l' ? 1 : (Buffer[0] == 'o' ? 2 : -1));
+        if ( k == -1 || sscanf( Buffer + 1, "%d", &iTerm ) != 1 || (pName = strchr(Buffer, ' ')) == NULL )
+        {
+            fError = 1;
+            break;
+        }
+        if ( vNames[k] == NULL )
+            vNames[k] = Vec_PtrAlloc( 100 );
+        if ( Vec_PtrSize(vNames[k]) != iTerm )
+        {
+            fError = 1;
+            break;
+        }
+        pName += strspn( pName, " " );
+        pName[strcspn(pName, "\r\n")] = 0;
+        Vec_PtrPush( vNames[k], Abc_UtilStrsav(pName) );
+    }
+    fclose( pFile );
+    // create the manager without the object array
+    pNew = Gia_ManStart( 1 );
+    ABC_FREE( pNew->pObjs );
+    pNew->nObjsAlloc = 0;
+    pNew->nObjs      = z->nObjs;
+    pNew->nConstrs   = nConstr;
+    pNew->pZip       = z;
+    nCis = nInputs + nLatches;
+    for ( i = 0; i < nCis; i++ )
+        Vec_IntPush( pNew->vCis, 1 + i );
+    for ( i = 0; i < nOutputs + nLatches; i++ )
+        Vec_IntPush( pNew->vCos, 1 + nCis + nAnds + i );
+    Gia_ManSetRegNum( pNew, nLatches );
+    pNew->nBufs = nBufs;
+    if ( !fError && (vNames[0] ? Vec_PtrSize(vNames[0]) : 0) == nInputs && (vNames[1] ? Vec_PtrSize(vNames[1]) : 0) == nLatches && 
+         (vNames[2] ? Vec_PtrSize(vNames[2]) : 0) == nOutputs && nInputs + nOutputs > 0 )
+    {
+        pNew->vNamesIn  = Vec_PtrAlloc( nCis );
+        pNew->vNamesOut = Vec_PtrAlloc( nOutputs + nLatches );
+        for ( i = 0; i < nInputs; i++ )
+            Vec_PtrPush( pNew->vNamesIn, Vec_PtrEntry(vNames[0], i) );
+        for ( i = 0; i < nLatches; i++ )
+            Vec_PtrPush( pNew->vNamesIn, Vec_PtrEntry(vNames[1], i) );
+        for ( i = 0; i < nOutputs; i++ )
+            Vec_PtrPush( pNew->vNamesOut, Vec_PtrEntry(vNames[2], i) );
+        for ( i = 0; i < nLatches; i++ )
+        {
+            sprintf( Buffer, "%.990s_in", (char *)Vec_PtrEntry(vNames[1], i) );
+            Vec_PtrPush( pNew->vNamesOut, Abc_UtilStrsav(Buffer) );
+        }
+        for ( k = 0; k < 3; k++ )
+            Vec_PtrFreeP( &vNames[k] );
+    }
+    else if ( vNames[0] || vNames[1] || vNames[2] )
+        Abc_Print( 0, "Gia_ManZipReadAiger(): The names are incomplete and will be ignored.\n" );
+    for ( k = 0; k < 3; k++ )
+        if ( vNames[k] )
+            Vec_PtrFreeFree( vNames[k] );
+    pName = Gia_FileNameGeneric( pFileName );
+    pNew->pName = Abc_UtilStrsav( pName );
+    ABC_FREE( pName );
+    pNew->pSpec = Abc_UtilStrsav( pFileName );
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Read %d objects into %d blocks of %d objects using %.2f MB (%.2f bytes per object).  ",
+            Gia_ManObjNum(pNew), Vec_PtrSize(z->vBlocks), 1 << nBlockLog, 1.0*z->nBytes/(1<<20), 1.0*z->nBytes/Gia_ManObjNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns memory used by the compressed objects.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+double Gia_ManZipMemory( Gia_Man_t * p )
+{
+    Gia_Zip_t * z = p->pZip;
+    double Memory = sizeof(Gia_Zip_t);
+    Memory += (double)z->nBytes;
+    Memory += Vec_PtrMemory( z->vBlocks );
+    Memory += sizeof(int) * (1 << z->nCacheLog);
+    Memory += sizeof(Gia_Obj_t) * (1 << (z->nBlockLog + z->nCacheLog));
+    return Memory;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the levels of the compressed AIG.]
+
+  Description [Follows Gia_ManLevelNum(). Returns the number of levels
+  and the average level of the COs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManZipLevelNum( Gia_Man_t * p, float * pLevelAve )
+{
+    Gia_Obj_t * pObj;
+    int * pLevels = ABC_CALLOC( int, p->nObjs );
+    int i, Level, nLevels = 0;
+    word Ave = 0;
+    Gia_ManZipForEachObj( p, pObj, i )
+    {
+        if ( !p->fGiaSimple && Gia_ObjIsBuf(pObj) )
+            Level = pLevels[Gia_ObjFaninId0(pObj, i)];
+        else if ( Gia_ObjIsXor(pObj) )
+            Level = 2 + Abc_MaxInt( pLevels[Gia_ObjFaninId0(pObj, i)], pLevels[Gia_ObjFaninId1(pObj, i)] );
+        else if ( Gia_ObjIsAnd(pObj) )
+            Level = 1 + Abc_MaxInt( pLevels[Gia_ObjFaninId0(pObj, i)], pLevels[Gia_ObjFaninId1(pObj, i)] );
+        else if ( Gia_ObjIsCo(pObj) )
+            Level = pLevels[Gia_ObjFaninId0(pObj, i)], Ave += Level;
+        else
+            Level = 0;
+        pLevels[i] = Level;
+        nLevels = Abc_MaxInt( nLevels, Level );
+    }
+    ABC_FREE( pLevels );
+    if ( pLevelAve )
+        *pLevelAve = Gia_ManCoNum(p) ? (float)((double)Ave / Gia_ManCoNum(p)) : (float)0;
+    return p->nLevels = nLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints stats for the compressed AIG.]
+
+  Description [Follows Gia_ManPrintStats() for the subset of statistics
+  that can be computed by streaming over the objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManZipPrintStats( Gia_Man_t * p, Gps_Par_t * pPars )
+{
+    float LevelAve;
+    int nLevels = Gia_ManZipLevelNum( p, &LevelAve );
+    if ( pPars && pPars->fNoColor )
+    {
+        if ( p->pName )
+            Abc_Print( 1, "%-8s : ", p->pName );
+    }
+    else
+    {
+#ifdef WIN32
+    SetConsoleTextAttribute( GetStdHandle(STD_OUTPUT_HANDLE), 15 ); // bright
+    if ( p->pName )
+        Abc_Print( 1, "%-8s : ", p->pName );
+    SetConsoleTextAttribute( GetStdHandle(STD_OUTPUT_HANDLE), 7 );  // normal
+#else
+    if ( p->pName )
+        Abc_Print( 1, "%s%-8s%s : ", "\033[1;37m", p->pName, "\033[0m" );  // bright
+#endif
+    }
+    Abc_Print( 1, "i/o =%7d/%7d", Gia_ManPiNum(p), Gia_ManPoNum(p) );
+    if ( Gia_ManConstrNum(p) )
+        Abc_Print( 1, "(c=%d)", Gia_ManConstrNum(p) );
+    if ( Gia_ManRegNum(p) )
+        Abc_Print( 1, "  ff =%7d", Gia_ManRegNum(p) );
+    if ( pPars && pPars->fNoColor )
+    {
+        Abc_Print( 1, "  and =%8d", Gia_ManAndNum(p) );
+        Abc_Print( 1, "  lev =%5d", nLevels );
+        Abc_Print( 1, " (%.2f)", LevelAve );
+    }
+    else
+    {
+#ifdef WIN32
+    {
+    HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
+    SetConsoleTextAttribute( hConsole, 11 ); // blue
+    Abc_Print( 1, "  and =%8d", Gia_ManAndNum(p) );
+    SetConsoleTextAttribute( hConsole, 13 ); // magenta
+    Abc_Print( 1, "  lev =%5d", nLevels );
+    Abc_Print( 1, " (%.2f)", LevelAve );
+    SetConsoleTextAttribute( hConsole, 7 ); // normal
+    }
+#else
+    Abc_Print( 1, "  %sand =%8d%s", "\033[1;36m", Gia_ManAndNum(p), "\033[0m" ); // blue
+    Abc_Print( 1, "  %slev =%5d%s", "\033[1;35m", nLevels, "\033[0m" ); // magenta
+    Abc_Print( 1, " %s(%.2f)%s",    "\033[1;35m", LevelAve, "\033[0m" );
+#endif
+    }
+    Abc_Print( 1, "  mem =%5.2f MB", Gia_ManMemory(p)/(1<<20) );
+    Abc_Print( 1, "  zip =%5.2f B/obj", 1.0*p->pZip->nBytes/Gia_ManObjNum(p) );
+    if ( Gia_ManBufNum(p) )
+        Abc_Print( 1, "  buf = %d", Gia_ManBufNum(p) );
+    if ( Gia_ManXorNum(p) )
+        Abc_Print( 1, "  xor = %d", Gia_ManXorNum(p) );
+    Abc_Print( 1, "\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the compressed AIG into the binary AIGER file.]
+
+  Description [Streams over the objects without restoring them. Returns 0
+  if the AIG is not normalized (all CIs followed by the AND nodes, followed
+  by the COs) or has features not supported by the streaming writer; in
+  this case the AIG should be written by Gia_AigerWrite() after restoring.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManZipWriteAiger( Gia_Man_t * p, char * pFileName, int fWriteNewLine )
+{
+    extern void Gia_FileWriteBufferSize( FILE * pFile, int nSize );
+    FILE * pFile;
+    Gia_Obj_t * pObj;
+    unsigned uLit, uLit0, uLit1;
+    int i;
+    assert( Gia_ManIsZipped(p) );
+    if ( Gia_ManXorNum(p) || Gia_ManBufNum(p) || Gia_ManConstrNum(p) || p->pAigExtra || p->pManTime ||
+         p->vFlopClasses || p->vRegClasses || p->vRegInits || p->vInitClasses || p->vConfigs || p->nAnd2Delay )
+        return 0;
+    for ( i = 0; i < Gia_ManCiNum(p); i++ )
+        if ( Vec_IntEntry(p->vCis, i) != i + 1 )
+            return 0;
+    for ( i = 0; i < Gia_ManCoNum(p); i++ )
+        if ( Vec_IntEntry(p->vCos, i) != Gia_ManObjNum(p) - Gia_ManCoNum(p) + i )
+            return 0;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        fprintf( stdout, "Gia_ManZipWriteAiger(): Cannot open the output file \"%s\".\n", pFileName );
+        return 1;
+    }
+    // write the header "M I L O A" where M = I + L + A
+    fprintf( pFile, "aig %u %u %u %u %u\n",
+        Gia_ManCiNum(p) + Gia_ManAndNum(p), Gia_ManPiNum(p), Gia_ManRegNum(p), Gia_ManPoNum(p), Gia_ManAndNum(p) );
+    // write latch drivers and PO drivers
+    for ( i = Gia_ManPoNum(p); i < Gia_ManCoNum(p); i++ )
+    {
+        int iObj = Vec_IntEntry( p->vCos, i );
+        pObj = Gia_ManZipObj( p, iObj );
+        fprintf( pFile, "%u\n", Abc_Var2Lit(Gia_ObjFaninId0(pObj, iObj), pObj->fCompl0) );
+    }
+    for ( i = 0; i < Gia_ManPoNum(p); i++ )
+    {
+        int iObj = Vec_IntEntry( p->vCos, i );
+        pObj = Gia_ManZipObj( p, iObj );
+        fprintf( pFile, "%u\n", Abc_Var2Lit(Gia_ObjFaninId0(pObj, iObj), pObj->fCompl0) );
+    }
+    // write the nodes
+    Gia_ManZipForEachAnd( p, pObj, i )
+    {
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit0 = Abc_Var2Lit( Gia_ObjFaninId0(pObj, i), pObj->fCompl0 );
+        uLit1 = Abc_Var2Lit( Gia_ObjFaninId1(pObj, i), pObj->fCompl1 );
+        assert( p->fGiaSimple || uLit0 < uLit1 );
+        Gia_AigerWriteUnsignedFile( pFile, uLit  - Abc_MaxInt(uLit0, uLit1) );
+        Gia_AigerWriteUnsignedFile( pFile, Abc_MaxInt(uLit0, uLit1) - Abc_MinInt(uLit0, uLit1) );
+    }
+    // write the symbol table
+    if ( p->vNamesIn && p->vNamesOut )
+    {
+        assert( Vec_PtrSize(p->vNamesIn)  == Gia_ManCiNum(p) );
+        assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
+        for ( i = 0; i < Gia_ManPiNum(p); i++ )
+            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+        for ( i = 0; i < Gia_ManRegNum(p); i++ )
+            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+        for ( i = 0; i < Gia_ManPoNum(p); i++ )
+            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+    }
+    fprintf( pFile, "c" );
+    // write name
+    if ( p->pName )
+    {
+        fprintf( pFile, "n" );
+        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
+        fwrite( p->pName, 1, strlen(p->pName), pFile );
+        fprintf( pFile, "%c", '\0' );
+    }
+    // write comments
+    if ( fWriteNewLine )
+        fprintf( pFile, "c\n" );
+    fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+    fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the CNF of the compressed AIG into a DIMACS file.]
+
+  Description [The variable of object i is i+1. The constant node is set
+  to zero and the POs are asserted, as in the CNF written for miters.
+  The latches are treated as free inputs. Returns 0 if the file cannot
+  be opened.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManZipWriteCnf( Gia_Man_t * p, char * pFileName, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    FILE * pFile;
+    Gia_Obj_t * pObj;
+    int i, Var, Var0, Var1, nClauses = 1 + Gia_ManPoNum(p);
+    assert( Gia_ManIsZipped(p) );
+    // count the clauses
+    Gia_ManZipForEachAnd( p, pObj, i )
+        nClauses += (!p->fGiaSimple && Gia_ObjIsBuf(pObj)) ? 2 : (Gia_ObjIsXor(pObj) ? 4 : 3);
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        fprintf( stdout, "Gia_ManZipWriteCnf(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    fprintf( pFile, "c CNF of the compressed AIG \"%s\" generated by ABC on %s\n", p->pName ? p->pName : "", Gia_TimeStamp() );
+    fprintf( pFile, "p cnf %d %d\n", Gia_ManObjNum(p), nClauses );
+    fprintf( pFile, "-1 0\n" );
+    Gia_ManZipForEachObj( p, pObj, i )
+    {
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( Gia_ObjCioId(pObj) < Gia_ManPoNum(p) )
+                fprintf( pFile, "%d 0\n", pObj->fCompl0 ? -(Gia_ObjFaninId0(pObj, i) + 1) : (Gia_ObjFaninId0(pObj, i) + 1) );
+            continue;
+        }
+        if ( !Gia_ObjIsAnd(pObj) )
+            continue;
+        Var  = i + 1;
+        Var0 = pObj->fCompl0 ? -(Gia_ObjFaninId0(pObj, i) + 1) : (Gia_ObjFaninId0(pObj, i) + 1);
+        Var1 = pObj->fCompl1 ? -(Gia_ObjFaninId1(pObj, i) + 1) : (Gia_ObjFaninId1(pObj, i) + 1);
+        if ( !p->fGiaSimple && Gia_ObjIsBuf(pObj) )
+        {
+            fprintf( pFile, "%d %d 0\n", -Var,  Var0 );
+            fprintf( pFile, "%d %d 0\n",  Var, -Var0 );
+        }
+        else if ( Gia_ObjIsXor(pObj) )
+        {
+            fprintf( pFile, "%d %d %d 0\n", -Var,  Var0,  Var1 );
+            fprintf( pFile, "%d %d %d 0\n", -Var, -Var0, -Var1 );
+            fprintf( pFile, "%d %d %d 0\n",  Var, -Var0,  Var1 );
+            fprintf( pFile, "%d %d %d 0\n",  Var,  Var0, -Var1 );
+        }
+        else
+        {
+            fprintf( pFile, "%d %d 0\n", -Var, Var0 );
+            fprintf( pFile, "%d %d 0\n", -Var, Var1 );
+            fprintf( pFile, "%d %d %d 0\n", Var, -Var0, -Var1 );
+        }
+    }
+    fclose( pFile );
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Written CNF with %d variables and %d clauses into file \"%s\".  ", Gia_ManObjNum(p), nClauses, pFileName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs random simulation of the compressed AIG.]
+
+  Description [Simulates the given number of frames starting from the
+  all-zero initial state with nWords random words per primary input.
+  The words are simulated one at a time, so the simulation info takes
+  one word per object, irrespective of nWords. Streams over the objects
+  once per frame and word. Returns the index of the PO asserted in the
+  earliest frame (the smallest index if there are several) or -1 if no
+  PO was asserted.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManZipSimulate( Gia_Man_t * p, int nFrames, int nWords, int nSeed, int fVerbose )
+{
+    abctime clk = Abc_Clock();
+    Gia_Obj_t * pObj;
+    word * pSims  = ABC_CALLOC( word, Gia_ManObjNum(p) );
+    word * pState = ABC_ALLOC( word, Gia_ManRegNum(p) + 1 );
+    word * pNext  = ABC_ALLOC( word, Gia_ManRegNum(p) + 1 );
+    word Sim0, Sim1;
+    int f, i, w, iCio, fFound, iOut = -1, iFrame = -1;
+    assert( Gia_ManIsZipped(p) );
+    Abc_RandomW( 1 );
+    for ( i = 0; i < nSeed; i++ )
+        Abc_RandomW( 0 );
+    for ( w = 0; w < nWords && iFrame != 0; w++ )
+    {
+        memset( pState, 0, sizeof(word) * Gia_ManRegNum(p) );
+        // frames after the earliest failure found so far are not simulated
+        for ( f = 0, fFound = 0; f < nFrames && !fFound && (iFrame == -1 || f <= iFrame); f++ )
+        {
+            Gia_ManZipForEachObj( p, pObj, i )
+            {
+                if ( Gia_ObjIsCi(pObj) )
+                {
+                    iCio = Gia_ObjCioId(pObj);
+                    pSims[i] = iCio < Gia_ManPiNum(p) ? Abc_RandomW( 0 ) : pState[iCio - Gia_ManPiNum(p)];
+                    continue;
+                }
+                if ( !Gia_ObjIsAnd(pObj) && !Gia_ObjIsCo(pObj) )
+                    continue;
+                Sim0 = pObj->fCompl0 ? ~pSims[Gia_ObjFaninId0(pObj, i)] : pSims[Gia_ObjFaninId0(pObj, i)];
+                if ( Gia_ObjIsCo(pObj) )
+                {
+                    iCio = Gia_ObjCioId(pObj);
+                    if ( iCio >= Gia_ManPoNum(p) )
+                        pNext[iCio - Gia_ManPoNum(p)] = Sim0;
+                    else if ( Sim0 && (iFrame == -1 || f < iFrame || (f == iFrame && iCio < iOut)) )
+                        iOut = iCio, iFrame = f, fFound = 1;
+                    continue;
+                }
+                Sim1 = pObj->fCompl1 ? ~pSims[Gia_ObjFaninId1(pObj, i)] : pSims[Gia_ObjFaninId1(pObj, i)];
+                if ( !p->fGiaSimple && Gia_ObjIsBuf(pObj) )
+                    pSims[i] = Sim0;
+                else if ( Gia_ObjIsXor(pObj) )
+                    pSims[i] = Sim0 ^ Sim1;
+                else
+                    pSims[i] = Sim0 & Sim1;
+            }
+            ABC_SWAP( word *, pState, pNext );
+        }
+    }
+    if ( fVerbose )
+    {
+        if ( iOut >= 0 )
+            Abc_Print( 1, "Output %d was asserted in frame %d.  ", iOut, iFrame );
+        else
+            Abc_Print( 1, "No output was asserted in %d frames with %d words.  ", nFrames, nWords );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    ABC_FREE( pSims );
+    ABC_FREE( pState );
+    ABC_FREE( pNext );
+    return iOut;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -649,6 +649,7 @@ extern ABC_DLL int                Abc_ExactIsRunning();
 extern ABC_DLL Abc_Obj_t *        Abc_ExactBuildNode( word * pTruth, int nVars, int * pArrTimeProfile, Abc_Obj_t ** pFanins, Abc_Ntk_t * pNtk );
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkFindExact( word * pTruth, int nVars, int nFunc, int nMaxDepth, int * pArrivalTimes, int nBTLimit, int nStartGates, int fVerbose );
 /*=== abcFanio.c ==========================================================*/
+extern ABC_DLL void               Abc_NtkReserveFanio( Abc_Ntk_t * pNtk, Vec_Int_t * vFanins, Vec_Int_t * vFanouts );
 extern ABC_DLL void               Abc_ObjAddFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFanin );
 extern ABC_DLL void               Abc_ObjDeleteFanin( Abc_Obj_t * pObj, Abc_Obj_t * pFanin );
 extern ABC_DLL void               Abc_ObjRemoveFanins( Abc_Obj_t * pObj );
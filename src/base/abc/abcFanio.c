@@ -70,6 +70,62 @@ static inline void Vec_IntPushMem( Mem_Step_t * pMemMan, Vec_Int_t * p, int Entr
     p->pArray[p->nSize++] = Entry;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reserves fanin/fanout arrays in one contiguous block.]
+
+  Description [Takes the expected number of fanins and fanouts of each
+  object, indexed by object ID. The arrays of the objects are carved in 
+  the order of object IDs from one block, which is fetched from the step 
+  memory manager and released together with the network. The capacities 
+  are rounded up to powers of two, so that the arrays can still grow by 
+  Vec_IntPushMem(), which recycles them into the step memory manager. 
+  Arrays that are already allocated are not changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_ObjFanioCap( int nEntries ) { return nEntries <= 2 ? 2 : 1 << Abc_Base2Log(nEntries); }
+
+void Abc_NtkReserveFanio( Abc_Ntk_t * pNtk, Vec_Int_t * vFanins, Vec_Int_t * vFanouts )
+{
+    Abc_Obj_t * pObj;
+    int * pArray;
+    word nTotal = 0;
+    int i, nFanins, nFanouts;
+    if ( pNtk->pMmStep == NULL )
+        return;
+    assert( Vec_IntSize(vFanins) >= Abc_NtkObjNumMax(pNtk) );
+    assert( Vec_IntSize(vFanouts) >= Abc_NtkObjNumMax(pNtk) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        if ( pObj->vFanins.nCap == 0 && (nFanins = Vec_IntEntry(vFanins, i)) > 0 )
+            nTotal += Abc_ObjFanioCap( nFanins );
+        if ( pObj->vFanouts.nCap == 0 && (nFanouts = Vec_IntEntry(vFanouts, i)) > 0 )
+            nTotal += Abc_ObjFanioCap( nFanouts );
+    }
+    if ( nTotal == 0 || nTotal > 0x7FFFFFFF / sizeof(int) )
+        return;
+    pArray = (int *)Mem_StepEntryFetch( pNtk->pMmStep, (int)(nTotal * sizeof(int)) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        if ( pObj->vFanins.nCap == 0 && (nFanins = Vec_IntEntry(vFanins, i)) > 0 )
+        {
+            pObj->vFanins.pArray = pArray;
+            pObj->vFanins.nCap   = Abc_ObjFanioCap( nFanins );
+            pArray += pObj->vFanins.nCap;
+        }
+        if ( pObj->vFanouts.nCap == 0 && (nFanouts = Vec_IntEntry(vFanouts, i)) > 0 )
+        {
+            pObj->vFanouts.pArray = pArray;
+            pObj->vFanouts.nCap   = Abc_ObjFanioCap( nFanouts );
+            pArray += pObj->vFanouts.nCap;
+        }
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Creates fanout/fanin relationship between the nodes.]
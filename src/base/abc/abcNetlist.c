@@ -53,6 +53,7 @@ Abc_Ntk_t * Abc_NtkToLogic( Abc_Ntk_t * pNtk )
 {
     Abc_Ntk_t * pNtkNew; 
     Abc_Obj_t * pObj, * pFanin;
+    Vec_Int_t * vFanins, * vFanouts;
     int i, k;
     // consider the case of the AIG
     if ( Abc_NtkIsStrash(pNtk) )
@@ -70,6 +71,17 @@ Abc_Ntk_t * Abc_NtkToLogic( Abc_Ntk_t * pNtk )
         Abc_NtkDupObj(pNtkNew, pObj, 0);
         Abc_ObjAssignName( pObj->pCopy, Abc_ObjName(Abc_ObjFanout0(pObj)), NULL );
     }
+    // reserve the fanin/fanout arrays (the fanouts of a driver are the fanouts of its net)
+    vFanins  = Vec_IntStart( Abc_NtkObjNumMax(pNtkNew) );
+    vFanouts = Vec_IntStart( Abc_NtkObjNumMax(pNtkNew) );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+        Vec_IntWriteEntry( vFanins, pObj->pCopy->Id, Abc_ObjFaninNum(pObj) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( (Abc_ObjIsNode(pObj) || Abc_ObjIsCi(pObj)) && Abc_ObjFanoutNum(pObj) == 1 && pObj->pCopy )
+            Vec_IntWriteEntry( vFanouts, pObj->pCopy->Id, Abc_ObjFanoutNum(Abc_ObjFanout0(pObj)) );
+    Abc_NtkReserveFanio( pNtkNew, vFanins, vFanouts );
+    Vec_IntFree( vFanins );
+    Vec_IntFree( vFanouts );
     // reconnect the internal nodes in the new network
     Abc_NtkForEachNode( pNtk, pObj, i )
         Abc_ObjForEachFanin( pObj, pFanin, k )
@@ -427,6 +427,7 @@ Abc_Ntk_t * Abc_NtkDup( Abc_Ntk_t * pNtk )
 {
     Abc_Ntk_t * pNtkNew; 
     Abc_Obj_t * pObj, * pFanin;
+    Vec_Int_t * vFanins, * vFanouts;
     int i, k;
     if ( pNtk == NULL )
         return NULL;
@@ -456,6 +457,17 @@ Abc_Ntk_t * Abc_NtkDup( Abc_Ntk_t * pNtk )
         Abc_NtkForEachObj( pNtk, pObj, i )
             if ( pObj->pCopy == NULL )
                 Abc_NtkDupObj(pNtkNew, pObj, Abc_NtkHasBlackbox(pNtk) && Abc_ObjIsNet(pObj));
+        // reserve the fanin/fanout arrays of the new objects
+        vFanins  = Vec_IntStart( Abc_NtkObjNumMax(pNtkNew) );
+        vFanouts = Vec_IntStart( Abc_NtkObjNumMax(pNtkNew) );
+        Abc_NtkForEachObj( pNtk, pObj, i )
+        {
+            Vec_IntWriteEntry( vFanins,  pObj->pCopy->Id, Abc_ObjFaninNum(pObj) );
+            Vec_IntWriteEntry( vFanouts, pObj->pCopy->Id, Abc_ObjFanoutNum(pObj) );
+        }
+        Abc_NtkReserveFanio( pNtkNew, vFanins, vFanouts );
+        Vec_IntFree( vFanins );
+        Vec_IntFree( vFanouts );
         // reconnect all objects (no need to transfer attributes on edges)
         Abc_NtkForEachObj( pNtk, pObj, i )
             if ( !Abc_ObjIsBox(pObj) && !Abc_ObjIsBo(pObj) )
@@ -1594,7 +1594,7 @@ clk = Abc_Clock();
   SeeAlso     []
 
 ***********************************************************************/
-Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nProcs, int fVerbose )
 {
     Aig_Man_t * pMan, * pTemp;
     Abc_Ntk_t * pNtkAig;
@@ -1606,7 +1606,7 @@ Abc_Ntk_t * Abc_NtkDC2( Abc_Ntk_t * pNtk, int fBalance, int fUpdateLevel, int fF
 //    Aig_ManPrintStats( pMan );
 
 clk = Abc_Clock();
-    pMan = Dar_ManCompress2( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, fVerbose ); 
+    pMan = Dar_ManCompress2Par( pTemp = pMan, fBalance, fUpdateLevel, fFanout, fPower, nProcs, fVerbose ); 
     Aig_ManStop( pTemp );
 //ABC_PRT( "time", Abc_Clock() - clk );
 
@@ -1867,6 +1867,49 @@ Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo,
     return pNtkNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Streams the fast CNF of the current network into a file.]
+
+  Description [Writes the same clauses as Abc_NtkDarToCnf() with the fast
+  algorithm, without keeping the CNF in memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkDarToCnfStream( Abc_Ntk_t * pNtk, char * pFileName, int fChangePol, int nProcs, int fVerbose )
+{
+    Aig_Man_t * pMan;
+    ABC_INT64_T nClauses;
+    int nVars = 0;
+    abctime clk = Abc_Clock();
+    assert( Abc_NtkIsStrash(pNtk) );
+
+    // convert to the AIG manager
+    pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    if ( pMan == NULL )
+        return 0;
+    if ( !Aig_ManCheck( pMan ) )
+    {
+        Abc_Print( 1, "Abc_NtkDarToCnfStream: AIG check has failed.\n" );
+        Aig_ManStop( pMan );
+        return 0;
+    }
+    if ( fVerbose )
+    Aig_ManPrintStats( pMan );
+
+    // derive CNF and write it into a file
+    nClauses = Cnf_DeriveFastStream( pMan, pFileName, fChangePol, nProcs, &nVars );
+    Aig_ManStop( pMan );
+    if ( nClauses < 0 )
+        return 0;
+    Abc_Print( 1, "CNF stats: Vars = %6d. Clauses = %7.0f.   ", nVars, (double)nClauses );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    return 1;
+}
+
 
 /**Function*************************************************************
 
@@ -60,6 +60,7 @@ static int CmdCommandSis           ( Abc_Frame_t * pAbc, int argc, char ** argv
 static int CmdCommandMvsis         ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandCapo          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandStarter       ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandBench         ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandAutoTuner     ( Abc_Frame_t * pAbc, int argc, char ** argv );
 
 extern int Cmd_CommandAbcLoadPlugIn( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -111,6 +112,7 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Various", "mvsis",       CmdCommandMvsis,           1 );
     Cmd_CommandAdd( pAbc, "Various", "capo",        CmdCommandCapo,            0 );
     Cmd_CommandAdd( pAbc, "Various", "starter",     CmdCommandStarter,         0 );
+    Cmd_CommandAdd( pAbc, "Various", "bench",       CmdCommandBench,           0 );
     Cmd_CommandAdd( pAbc, "Various", "autotuner",   CmdCommandAutoTuner,       0 );
 
     Cmd_CommandAdd( pAbc, "Various", "load_plugin", Cmd_CommandAbcLoadPlugIn,  0 );
@@ -2453,6 +2455,137 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Runs the built-in performance benchmark suite.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int CmdCommandBench( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Vec_Ptr_t * vDesigns;
+    char * pFileOut  = "bench.json";
+    int c, nMultBits =   8;
+    int nCountBits   =  16;
+    int nFrames      = 100;
+    int nThreads     =   0;
+    int fVerbose     =   0;
+    int i, RetValue;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "MCFTovh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'M':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-M\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nMultBits = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nMultBits < 0 ) 
+                goto usage;
+            break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nCountBits = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nCountBits != 0 && (nCountBits < 3 || nCountBits > 30) ) 
+                goto usage;
+            break;
+        case 'F':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-F\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nFrames = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nFrames <= 0 ) 
+                goto usage;
+            break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads < 0 ) 
+                goto usage;
+            break;
+        case 'o':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-o\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileOut = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    // collect the bundled designs
+    vDesigns = Vec_PtrAlloc( 10 );
+    for ( i = globalUtilOptind; i < argc; i++ )
+    {
+        FILE * pFile = fopen( argv[i], "rb" );
+        if ( pFile == NULL )
+        {
+            Abc_Print( -1, "Cannot open input file \"%s\".\n", argv[i] );
+            Vec_PtrFree( vDesigns );
+            return 1;
+        }
+        fclose( pFile );
+        Vec_PtrPush( vDesigns, argv[i] );
+    }
+    if ( argc == globalUtilOptind )
+    {
+        FILE * pFile = fopen( "i10.aig", "rb" );
+        if ( pFile != NULL )
+        {
+            fclose( pFile );
+            Vec_PtrPush( vDesigns, "i10.aig" );
+        }
+    }
+    RetValue = Cmd_RunBench( pAbc, pFileOut, vDesigns, nMultBits, nCountBits, nFrames, nThreads, fVerbose );
+    Vec_PtrFree( vDesigns );
+    return RetValue == -1;
+
+usage:
+    Abc_Print( -2, "usage: bench [-MCFT num] [-o file] [-vh] <file1> <file2> ...\n" );
+    Abc_Print( -2, "\t         runs the performance benchmark suite and writes the results in JSON\n" );
+    Abc_Print( -2, "\t         (wall and CPU time, process peak RSS and its growth, network size)\n" );
+    Abc_Print( -2, "\t-M num : the width of the generated multiplier (0 = none) [default = %d]\n", nMultBits );
+    Abc_Print( -2, "\t-C num : the width of the generated sequential counters (0 = none) [default = %d]\n", nCountBits );
+    Abc_Print( -2, "\t-F num : the frame limit for bounded model checking [default = %d]\n", nFrames );
+    Abc_Print( -2, "\t-T num : the number of frames running the stress test at the same time,\n" );
+    Abc_Print( -2, "\t         each in its own thread, with the results compared (0 = none) [default = %d]\n", nThreads );
+    Abc_Print( -2, "\t-o file: the output JSON file [default = %s]\n", pFileOut );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    Abc_Print( -2, "\t<file> : AIGs to benchmark (default is \"i10.aig\" in the current directory, if present)\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -181,9 +181,11 @@ int Cmd_CommandHandleSpecial( Abc_Frame_t * pAbc, const char * sCommand )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Executes the command line in the given frame.]
 
-  Description []
+  Description [While the commands run, the frame is the current frame of 
+  the calling thread. Several threads can execute commands concurrently,
+  each in its own frame (see Abc_FramePrivateStart).]
                
   SideEffects []
 
@@ -192,10 +194,14 @@ int Cmd_CommandHandleSpecial( Abc_Frame_t * pAbc, const char * sCommand )
 ***********************************************************************/
 int Cmd_CommandExecute( Abc_Frame_t * pAbc, const char * sCommand )
 {
+    Abc_Frame_t * pPrev = Abc_FrameReadThreadFrame();
     int fStatus = 0, argc, loop;
     const char * sCommandNext;
     char **argv;
 
+    // the commands see the given frame as the current frame of this thread
+    if ( pAbc != Abc_FrameReadGlobalFrame() )
+        Abc_FrameSetThreadFrame( pAbc );
     if ( !pAbc->fAutoexac && !pAbc->fSource ) 
         Cmd_HistoryAddCommand(pAbc, sCommand);
     sCommandNext = sCommand;
@@ -211,6 +217,7 @@ int Cmd_CommandExecute( Abc_Frame_t * pAbc, const char * sCommand )
         CmdFreeArgv( argc, argv );
     } 
     while ( fStatus == 0 && *sCommandNext != '\0' );
+    Abc_FrameSetThreadFrame( pPrev );
     return fStatus;
 }
 
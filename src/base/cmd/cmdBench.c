@@ -0,0 +1,812 @@
+/**CFile****************************************************************
+
+  FileName    [cmdBench.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Built-in performance benchmark suite.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: cmdBench.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+#include "aig/gia/gia.h"
+#include "cmdInt.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+#if defined(_WIN32)
+#include <time.h>
+#else
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// design kinds
+#define BENCH_COMB   0   // combinational design
+#define BENCH_SEQ    1   // sequential design with a safety property
+
+// the flows of the suite; in the command lines, $D stands for
+// the design file, $L for the Liberty library, and $F for the frame limit
+typedef struct Cmd_BenchFlow_t_ Cmd_BenchFlow_t;
+struct Cmd_BenchFlow_t_
+{
+    char *         pName;       // flow name
+    int            Kind;        // the kind of designs the flow is applied to
+    char *         pCommands;   // semicolon-separated commands
+};
+
+static Cmd_BenchFlow_t s_BenchFlows[] = {
+    { "gia_synth",  BENCH_COMB,  "&r $D; &st; &synch2; &if -K 6; &mfs; &cec"          },
+    { "dch_if",     BENCH_COMB,  "read $D; strash; dch; if -K 6"                       },
+    { "gia_dch",    BENCH_COMB,  "&r $D; &st; &dch; &if -K 6"                          },
+    { "gia_dch_n",  BENCH_COMB,  "&r $D; &st; &dch -n; &if -K 6"                       },
+    { "stime",      BENCH_COMB,  "read_lib $L; read $D; strash; dch; map; topo; stime" },
+    { "pdr",        BENCH_SEQ,   "read $D; pdr"                                        },
+    { "bmc3",       BENCH_SEQ,   "read $D; bmc3 -F $F"                                 },
+    { NULL,         0,           NULL                                                  }
+};
+
+// the script of the stress test, which is run in several frames at the same time;
+// $O stands for the output file of the thread
+static char * s_BenchStress = 
+    "read $D; strash; rewrite; balance; refactor; resub; dc2; fraig; dch; if -K 6; "
+    "strash; &get; &dc2; &synch2; &if -K 6; &put; strash; write_aiger $O";
+
+// the cells of the generated Liberty library
+static char * s_BenchCells[][4] = {
+    // name       area    function    unateness
+    { "INV_X1",   "1.0",  "!A",       "negative_unate" },
+    { "BUF_X1",   "1.5",  "A",        "positive_unate" },
+    { "NAND2_X1", "1.3",  "!(A&B)",   "negative_unate" },
+    { "NOR2_X1",  "1.5",  "!(A|B)",   "negative_unate" },
+    { "AND2_X1",  "2.0",  "A&B",      "positive_unate" },
+    { "OR2_X1",   "2.2",  "A|B",      "positive_unate" },
+    { NULL,       NULL,   NULL,       NULL             }
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns wall-clock time in seconds.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static double Cmd_BenchWallTime()
+{
+#if defined(_WIN32)
+    return 1.0 * clock() / CLOCKS_PER_SEC;
+#else
+    struct timeval tv;
+    gettimeofday( &tv, NULL );
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the peak resident set size of the process in KB.]
+
+  Description [Returns 0 if this information is not available.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static long Cmd_BenchPeakRss()
+{
+#if defined(_WIN32)
+    return 0;
+#else
+    struct rusage ru;
+    if ( getrusage( RUSAGE_SELF, &ru ) != 0 )
+        return 0;
+#if defined(__APPLE__) && defined(__MACH__)
+    return (long)(ru.ru_maxrss / 1024);
+#else
+    return (long)ru.ru_maxrss;
+#endif
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Generates a sequential design with a provable property.]
+
+  Description [The design contains a binary counter A, a Gray-code
+  counter B, and a modulo counter C, all incremented by the same enable
+  input. The property fails if B differs from the Gray code of A, or if
+  C reaches a value, which is unreachable because C wraps around earlier.
+  The second part is not inductive, so that proving the property requires
+  strengthening.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cmd_BenchGenCounters( int nBits )
+{
+    Gia_Man_t * pNew;
+    int * pA = ABC_ALLOC( int, nBits );
+    int * pB = ABC_ALLOC( int, nBits );
+    int * pC = ABC_ALLOC( int, nBits );
+    Vec_Int_t * vNext = Vec_IntAlloc( 3 * nBits );
+    int i, iEn, iCarry, iBad, iWrap, iUnreach, iLit;
+    int Modulo = (1 << nBits) - 3;
+    assert( nBits >= 3 && nBits <= 30 );
+    pNew = Gia_ManStart( 100 * nBits );
+    pNew->pName = Abc_UtilStrsav( "counters" );
+    Gia_ManHashAlloc( pNew );
+    iEn = Gia_ManAppendCi( pNew );
+    for ( i = 0; i < nBits; i++ )
+        pA[i] = Gia_ManAppendCi( pNew );
+    for ( i = 0; i < nBits; i++ )
+        pB[i] = Gia_ManAppendCi( pNew );
+    for ( i = 0; i < nBits; i++ )
+        pC[i] = Gia_ManAppendCi( pNew );
+    // binary counter
+    for ( iCarry = iEn, i = 0; i < nBits; i++ )
+    {
+        Vec_IntPush( vNext, Gia_ManHashXor(pNew, pA[i], iCarry) );
+        iCarry = Gia_ManHashAnd( pNew, pA[i], iCarry );
+    }
+    // Gray-code counter derived from the next state of the binary counter
+    for ( i = 0; i < nBits; i++ )
+        Vec_IntPush( vNext, i == nBits-1 ? Vec_IntEntry(vNext, i) : Gia_ManHashXor(pNew, Vec_IntEntry(vNext, i), Vec_IntEntry(vNext, i+1)) );
+    // modulo counter
+    for ( iWrap = 1, i = 0; i < nBits; i++ )
+        iWrap = Gia_ManHashAnd( pNew, iWrap, Abc_LitNotCond(pC[i], !((Modulo - 1) >> i & 1)) );
+    iWrap = Gia_ManHashAnd( pNew, iWrap, iEn );
+    for ( iCarry = iEn, i = 0; i < nBits; i++ )
+    {
+        iLit = Gia_ManHashXor( pNew, pC[i], iCarry );
+        Vec_IntPush( vNext, Gia_ManHashAnd(pNew, iLit, Abc_LitNot(iWrap)) );
+        iCarry = Gia_ManHashAnd( pNew, pC[i], iCarry );
+    }
+    // the property
+    for ( iBad = 0, i = 0; i < nBits; i++ )
+    {
+        iLit = i == nBits-1 ? pA[i] : Gia_ManHashXor( pNew, pA[i], pA[i+1] );
+        iBad = Gia_ManHashOr( pNew, iBad, Gia_ManHashXor(pNew, iLit, pB[i]) );
+    }
+    for ( iUnreach = 1, i = 0; i < nBits; i++ )
+        iUnreach = Gia_ManHashAnd( pNew, iUnreach, Abc_LitNotCond(pC[i], !((Modulo + 1) >> i & 1)) );
+    Gia_ManAppendCo( pNew, Gia_ManHashOr(pNew, iBad, iUnreach) );
+    Vec_IntForEachEntry( vNext, iLit, i )
+        Gia_ManAppendCo( pNew, iLit );
+    Gia_ManSetRegNum( pNew, 3 * nBits );
+    Gia_ManHashStop( pNew );
+    Vec_IntFree( vNext );
+    ABC_FREE( pA );
+    ABC_FREE( pB );
+    ABC_FREE( pC );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes a small Liberty library used by the timing flows.]
+
+  Description [All cells share the same timing tables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_BenchWriteLiberty( char * pFileName )
+{
+    char * pTables[4] = { "cell_rise", "cell_fall", "rise_transition", "fall_transition" };
+    char * pValues[4] = {
+        "\"0.0270, 0.0630, 0.2230\", \"0.0540, 0.0900, 0.2500\", \"0.1740, 0.2100, 0.3700\"",
+        "\"0.0250, 0.0610, 0.2210\", \"0.0520, 0.0880, 0.2480\", \"0.1720, 0.2080, 0.3680\"",
+        "\"0.0170, 0.0530, 0.2130\", \"0.0440, 0.0800, 0.2400\", \"0.1640, 0.2000, 0.3600\"",
+        "\"0.0170, 0.0530, 0.2130\", \"0.0440, 0.0800, 0.2400\", \"0.1640, 0.2000, 0.3600\"" };
+    FILE * pFile = fopen( pFileName, "wb" );
+    int i, k, p;
+    if ( pFile == NULL )
+        return 0;
+    fprintf( pFile, "library(bench) {\n" );
+    fprintf( pFile, "  time_unit : \"1ns\";\n" );
+    fprintf( pFile, "  capacitive_load_unit(1,pf);\n" );
+    fprintf( pFile, "  lu_table_template(tmpl) {\n" );
+    fprintf( pFile, "    variable_1 : input_net_transition;\n" );
+    fprintf( pFile, "    variable_2 : total_output_net_capacitance;\n" );
+    fprintf( pFile, "    index_1(\"0.01, 0.1, 0.5\");\n" );
+    fprintf( pFile, "    index_2(\"0.001, 0.01, 0.05\");\n" );
+    fprintf( pFile, "  }\n" );
+    for ( i = 0; s_BenchCells[i][0]; i++ )
+    {
+        int nPins = strchr(s_BenchCells[i][2], 'B') ? 2 : 1;
+        fprintf( pFile, "  cell(%s) {\n", s_BenchCells[i][0] );
+        fprintf( pFile, "    area : %s;\n", s_BenchCells[i][1] );
+        for ( p = 0; p < nPins; p++ )
+            fprintf( pFile, "    pin(%c) { direction : input; capacitance : 0.002; }\n", 'A' + p );
+        fprintf( pFile, "    pin(Y) {\n" );
+        fprintf( pFile, "      direction : output;\n" );
+        fprintf( pFile, "      function : \"%s\";\n", s_BenchCells[i][2] );
+        for ( p = 0; p < nPins; p++ )
+        {
+            fprintf( pFile, "      timing() {\n" );
+            fprintf( pFile, "        related_pin : \"%c\";\n", 'A' + p );
+            fprintf( pFile, "        timing_sense : %s;\n", s_BenchCells[i][3] );
+            for ( k = 0; k < 4; k++ )
+            {
+                fprintf( pFile, "        %s(tmpl) {\n", pTables[k] );
+                fprintf( pFile, "          index_1(\"0.01, 0.1, 0.5\");\n" );
+                fprintf( pFile, "          index_2(\"0.001, 0.01, 0.05\");\n" );
+                fprintf( pFile, "          values(%s);\n", pValues[k] );
+                fprintf( pFile, "        }\n" );
+            }
+            fprintf( pFile, "      }\n" );
+        }
+        fprintf( pFile, "    }\n" );
+        fprintf( pFile, "  }\n" );
+    }
+    fprintf( pFile, "}\n" );
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Substitutes the parameters into the command line.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_BenchSubstitute( Vec_Str_t * vCmd, char * pCommand, char * pDesign, char * pLib, int nFrames, char * pOut )
+{
+    char * pCur;
+    Vec_StrClear( vCmd );
+    for ( pCur = pCommand; *pCur; pCur++ )
+    {
+        if ( pCur[0] == '$' && pCur[1] == 'D' )
+            Vec_StrPrintStr( vCmd, pDesign ), pCur++;
+        else if ( pCur[0] == '$' && pCur[1] == 'L' )
+            Vec_StrPrintStr( vCmd, pLib ), pCur++;
+        else if ( pCur[0] == '$' && pCur[1] == 'F' )
+            Vec_StrPrintNum( vCmd, nFrames ), pCur++;
+        else if ( pCur[0] == '$' && pCur[1] == 'O' && pOut )
+            Vec_StrPrintStr( vCmd, pOut ), pCur++;
+        else
+            Vec_StrPush( vCmd, *pCur );
+    }
+    Vec_StrPush( vCmd, '\0' );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes a string into the JSON file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_BenchWriteString( FILE * pFile, char * pStr )
+{
+    fputc( '\"', pFile );
+    for ( ; *pStr; pStr++ )
+    {
+        if ( *pStr == '\"' || *pStr == '\\' )
+            fputc( '\\', pFile );
+        if ( (unsigned char)*pStr >= ' ' )
+            fputc( *pStr, pFile );
+    }
+    fputc( '\"', pFile );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the size of the current network into the JSON file.]
+
+  Description [Commands starting with '&' are reported using the AIG
+  of the frame; other commands are reported using the current network.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cmd_BenchWriteSize( FILE * pFile, Abc_Frame_t * pAbc, char * pCommand )
+{
+    if ( pCommand[0] == '&' )
+    {
+        Gia_Man_t * pGia = pAbc->pGia;
+        if ( pGia == NULL )
+            return;
+        fprintf( pFile, ", \"pis\": %d, \"pos\": %d, \"latches\": %d, \"ands\": %d, \"levels\": %d",
+            Gia_ManPiNum(pGia), Gia_ManPoNum(pGia), Gia_ManRegNum(pGia), Gia_ManAndNum(pGia), Gia_ManLevelNum(pGia) );
+        if ( Gia_ManHasMapping(pGia) )
+            fprintf( pFile, ", \"luts\": %d, \"lut_levels\": %d", Gia_ManLutNum(pGia), Gia_ManLutLevel(pGia, NULL) );
+    }
+    else
+    {
+        Abc_Ntk_t * pNtk = pAbc->pNtkCur;
+        if ( pNtk == NULL )
+            return;
+        fprintf( pFile, ", \"pis\": %d, \"pos\": %d, \"latches\": %d, \"nodes\": %d, \"levels\": %d",
+            Abc_NtkPiNum(pNtk), Abc_NtkPoNum(pNtk), Abc_NtkLatchNum(pNtk), Abc_NtkNodeNum(pNtk),
+            Abc_NtkIsStrash(pNtk) ? Abc_AigLevel(pNtk) : Abc_NtkLevel(pNtk) );
+        if ( Abc_NtkHasMapping(pNtk) )
+            fprintf( pFile, ", \"area\": %.2f, \"delay\": %.2f", Abc_NtkGetMappedArea(pNtk), Abc_NtkDelayTrace(pNtk, NULL, NULL, 0) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one flow on one design.]
+
+  Description [Returns the number of commands that failed. A command also
+  fails if an internal self-check reports an error while it runs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_BenchRunFlow( Abc_Frame_t * pAbc, FILE * pFile, Cmd_BenchFlow_t * pFlow, char * pDesign, char * pDesignFile, char * pLib, int nFrames, int fVerbose )
+{
+    extern int If_DsdManVerifyFailures();
+    Vec_Str_t * vCmd = Vec_StrAlloc( 1000 );
+    char * pCommands = Abc_UtilStrsav( pFlow->pCommands );
+    char * pCommand, * pNext;
+    double WallTotal = 0, CpuTotal = 0;
+    int nFailed = 0, fFirst = 1;
+    fprintf( pFile, "    {\n      \"flow\": " );
+    Cmd_BenchWriteString( pFile, pFlow->pName );
+    fprintf( pFile, ",\n      \"design\": " );
+    Cmd_BenchWriteString( pFile, pDesign );
+    fprintf( pFile, ",\n      \"commands\": [\n" );
+    // the commands are split without strtok(), which may be used by the commands
+    for ( pCommand = pCommands; pCommand; pCommand = pNext )
+    {
+        double WallTime, CpuTime;
+        long PeakRss, PeakRssPrev;
+        abctime clk;
+        int Status, nVerifyFails;
+        if ( (pNext = strchr(pCommand, ';')) )
+            *pNext++ = 0;
+        while ( *pCommand == ' ' )
+            pCommand++;
+        Cmd_BenchSubstitute( vCmd, pCommand, pDesignFile, pLib, nFrames, NULL );
+        if ( fVerbose )
+            printf( "bench: %-10s %-10s : %s\n", pFlow->pName, pDesign, Vec_StrArray(vCmd) );
+        fflush( stdout );
+        PeakRssPrev = Cmd_BenchPeakRss();
+        nVerifyFails = If_DsdManVerifyFailures();
+        WallTime = Cmd_BenchWallTime();
+        clk      = Abc_Clock();
+        Status   = Cmd_CommandExecute( pAbc, Vec_StrArray(vCmd) );
+        if ( Status == 0 && If_DsdManVerifyFailures() > nVerifyFails )
+        {
+            printf( "bench: %-10s %-10s : Command \"%s\" failed verification.\n", pFlow->pName, pDesign, Vec_StrArray(vCmd) );
+            Status = 1;
+        }
+        CpuTime  = 1.0 * (Abc_Clock() - clk) / CLOCKS_PER_SEC;
+        WallTime = Cmd_BenchWallTime() - WallTime;
+        WallTotal += WallTime;
+        CpuTotal  += CpuTime;
+        nFailed   += (Status != 0);
+        fprintf( pFile, "%s        { \"command\": ", fFirst ? "" : ",\n" );
+        Cmd_BenchWriteString( pFile, Vec_StrArray(vCmd) );
+        // the peak RSS is the high-water mark of the process; the growth shows 
+        // how much this command raised it (0 if it stayed below the earlier peak)
+        PeakRss  = Cmd_BenchPeakRss();
+        fprintf( pFile, ", \"status\": %d, \"wall_sec\": %.4f, \"cpu_sec\": %.4f, \"process_peak_rss_kb\": %ld, \"peak_rss_growth_kb\": %ld",
+            Status, WallTime, CpuTime, PeakRss, PeakRss - PeakRssPrev );
+        if ( Status == 0 )
+            Cmd_BenchWriteSize( pFile, pAbc, pCommand );
+        fprintf( pFile, " }" );
+        fFirst = 0;
+        if ( Status != 0 )
+            break;
+    }
+    fprintf( pFile, "\n      ],\n" );
+    fprintf( pFile, "      \"prob_status\": %d, \"failed\": %d, \"wall_sec\": %.4f, \"cpu_sec\": %.4f\n    }",
+        pAbc->Status, nFailed, WallTotal, CpuTotal );
+    printf( "bench: %-10s %-10s : Wall = %9.2f sec  Cpu = %9.2f sec  Process peak RSS = %8.2f MB%s\n",
+        pFlow->pName, pDesign, WallTotal, CpuTotal, Cmd_BenchPeakRss() / 1024.0, nFailed ? "  (failed)" : "" );
+    ABC_FREE( pCommands );
+    Vec_StrFree( vCmd );
+    return nFailed;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the two AIGER files contain the same AIG.]
+
+  Description [The AIGs are compared structurally rather than as files,
+  because the AIGER writer puts a time stamp into the comment.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_BenchFilesEqual( char * pFileName1, char * pFileName2 )
+{
+    Gia_Man_t * p1 = Gia_AigerRead( pFileName1, 0, 1, 0 );
+    Gia_Man_t * p2 = Gia_AigerRead( pFileName2, 0, 1, 0 );
+    Gia_Obj_t * pObj1, * pObj2;
+    int i, RetValue = p1 && p2 && Gia_ManObjNum(p1) == Gia_ManObjNum(p2) && 
+        Gia_ManCiNum(p1) == Gia_ManCiNum(p2) && Gia_ManCoNum(p1) == Gia_ManCoNum(p2) && Gia_ManRegNum(p1) == Gia_ManRegNum(p2);
+    if ( RetValue )
+        Gia_ManForEachObj1( p1, pObj1, i )
+        {
+            pObj2 = Gia_ManObj( p2, i );
+            if ( Gia_ObjIsAnd(pObj1) != Gia_ObjIsAnd(pObj2) || Gia_ObjIsCo(pObj1) != Gia_ObjIsCo(pObj2) )
+                break;
+            if ( (Gia_ObjIsAnd(pObj1) || Gia_ObjIsCo(pObj1)) && Gia_ObjFaninLit0(pObj1, i) != Gia_ObjFaninLit0(pObj2, i) )
+                break;
+            if ( Gia_ObjIsAnd(pObj1) && Gia_ObjFaninLit1(pObj1, i) != Gia_ObjFaninLit1(pObj2, i) )
+                break;
+        }
+    RetValue = RetValue && i == Gia_ManObjNum(p1);
+    if ( p1 ) Gia_ManStop( p1 );
+    if ( p2 ) Gia_ManStop( p2 );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the two AIGER files are proved equivalent.]
+
+  Description [The check is done by "&cec" in the given frame.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_BenchFilesEquiv( Abc_Frame_t * pAbc, char * pFileName1, char * pFileName2 )
+{
+    Vec_Str_t * vCmd = Vec_StrAlloc( 1000 );
+    int RetValue;
+    Vec_StrPrintF( vCmd, "&cec %s %s", pFileName1, pFileName2 );
+    Vec_StrPush( vCmd, '\0' );
+    pAbc->Status = -1;
+    RetValue = !Cmd_CommandExecute( pAbc, Vec_StrArray(vCmd) ) && pAbc->Status == 1;
+    Vec_StrFree( vCmd );
+    return RetValue;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Cmd_BenchThData_t_
+{
+    Abc_Frame_t *  pAbc;        // the private frame of the thread
+    char *         pScript;     // the script with the parameters substituted
+    int            Status;      // the result of the script
+} Cmd_BenchThData_t;
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the stress script in the private frame.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Cmd_BenchStressThread( void * pArg )
+{
+    Cmd_BenchThData_t * pThData = (Cmd_BenchThData_t *)pArg;
+    pThData->Status = Cmd_CommandExecute( pThData->pAbc, pThData->pScript );
+    return NULL;
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the stress test on one design.]
+
+  Description [Runs the stress script in the current frame, and then
+  in nThreads private frames at the same time, each frame in its own
+  thread. The results of the threads are compared with the result of
+  the current frame: the AIGs are expected to be identical, and those
+  that are not are checked for equivalence. Returns the number of threads
+  that failed or produced a different AIG plus the number of internal
+  self-check failures (such as DSD verification in the mapper) during 
+  the threaded runs, or -1 if the reference run failed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cmd_BenchRunStress( Abc_Frame_t * pAbc, FILE * pFile, char * pDesign, char * pDesignFile, char * pPrefix, int nThreads, int fVerbose )
+{
+    extern int If_DsdManVerifyFailures();
+    Vec_Str_t * vCmd = Vec_StrAlloc( 1000 );
+    Vec_Str_t * vOut = Vec_StrAlloc( 1000 );
+    char * pRef;
+    double WallRef, WallPar = 0;
+    int i, nFailed = 0, nDiffs = 0, nNonEq = 0, nSame = 0, nVerifyFails;
+    // reference run in the current frame
+    Vec_StrPrintF( vOut, "%s_%s_ref.aig", pPrefix, pDesign );
+    Vec_StrPush( vOut, '\0' );
+    pRef = Abc_UtilStrsav( Vec_StrArray(vOut) );
+    Cmd_BenchSubstitute( vCmd, s_BenchStress, pDesignFile, NULL, 0, pRef );
+    if ( fVerbose )
+        printf( "bench: stress     %-10s : %s\n", pDesign, Vec_StrArray(vCmd) );
+    fflush( stdout );
+    WallRef = Cmd_BenchWallTime();
+    nVerifyFails = If_DsdManVerifyFailures();
+    if ( Cmd_CommandExecute( pAbc, Vec_StrArray(vCmd) ) || If_DsdManVerifyFailures() > nVerifyFails )
+    {
+        printf( "bench: stress     %-10s : The reference run has failed.\n", pDesign );
+        fprintf( pFile, "    { \"design\": " );
+        Cmd_BenchWriteString( pFile, pDesign );
+        fprintf( pFile, ", \"threads\": %d, \"failed\": -1 }", nThreads );
+        remove( pRef );
+        ABC_FREE( pRef );
+        Vec_StrFree( vOut );
+        Vec_StrFree( vCmd );
+        return -1;
+    }
+    WallRef = Cmd_BenchWallTime() - WallRef;
+#ifdef ABC_USE_PTHREADS
+    {
+        Cmd_BenchThData_t * pThData = ABC_CALLOC( Cmd_BenchThData_t, nThreads );
+        pthread_t * pThreads = ABC_CALLOC( pthread_t, nThreads );
+        int status;
+        // the frames are started and stopped by the main thread
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Vec_StrClear( vOut );
+            Vec_StrPrintF( vOut, "%s_%s_t%d.aig", pPrefix, pDesign, i );
+            Vec_StrPush( vOut, '\0' );
+            Cmd_BenchSubstitute( vCmd, s_BenchStress, pDesignFile, NULL, 0, Vec_StrArray(vOut) );
+            pThData[i].pAbc    = Abc_FramePrivateStart();
+            pThData[i].pScript = Abc_UtilStrsav( Vec_StrArray(vCmd) );
+            pThData[i].Status  = -1;
+        }
+        WallPar = Cmd_BenchWallTime();
+        nVerifyFails = If_DsdManVerifyFailures();
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_create( pThreads + i, NULL, Cmd_BenchStressThread, (void *)(pThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+        {
+            status = pthread_join( pThreads[i], NULL );  assert( status == 0 );
+        }
+        WallPar = Cmd_BenchWallTime() - WallPar;
+        // the self-checks cannot be attributed to the threads, so they are counted separately
+        nVerifyFails = If_DsdManVerifyFailures() - nVerifyFails;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Vec_StrClear( vOut );
+            Vec_StrPrintF( vOut, "%s_%s_t%d.aig", pPrefix, pDesign, i );
+            Vec_StrPush( vOut, '\0' );
+            if ( pThData[i].Status != 0 )
+                nFailed++;
+            else if ( Cmd_BenchFilesEqual( pRef, Vec_StrArray(vOut) ) )
+                nSame++;
+            else if ( !Cmd_BenchFilesEquiv( pAbc, pRef, Vec_StrArray(vOut) ) )
+                nDiffs++, nNonEq++;
+            else
+                nDiffs++;
+            remove( Vec_StrArray(vOut) );
+            Abc_FramePrivateStop( pThData[i].pAbc );
+            ABC_FREE( pThData[i].pScript );
+        }
+        ABC_FREE( pThData );
+        ABC_FREE( pThreads );
+    }
+#else
+    printf( "bench: stress     %-10s : ABC is compiled without pthreads; only the reference run is performed.\n", pDesign );
+    nThreads = 0;
+    nVerifyFails = 0;
+#endif
+    fprintf( pFile, "    { \"design\": " );
+    Cmd_BenchWriteString( pFile, pDesign );
+    fprintf( pFile, ", \"threads\": %d, \"failed\": %d, \"different\": %d, \"nonequivalent\": %d, \"identical\": %d, \"verify_failed\": %d, \"ref_wall_sec\": %.4f, \"wall_sec\": %.4f }",
+        nThreads, nFailed, nDiffs, nNonEq, nSame, nVerifyFails, WallRef, WallPar );
+    printf( "bench: stress     %-10s : Threads = %d  Failed = %d  Different = %d (non-equivalent = %d)  Verification failures = %d  Wall = %9.2f sec (reference %.2f sec)\n",
+        pDesign, nThreads, nFailed, nDiffs, nNonEq, nVerifyFails, WallPar, WallRef );
+    remove( pRef );
+    ABC_FREE( pRef );
+    Vec_StrFree( vOut );
+    Vec_StrFree( vCmd );
+    return nFailed + nDiffs + nVerifyFails;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the benchmark suite.]
+
+  Description [Applies the flows to the bundled designs given by the
+  user (or i10.aig from the current directory, if present) and to
+  the generated designs: a multiplier with nMultBits bits and a set
+  of counters with nCountBits bits. The results are written into
+  the JSON file. The generated files are placed next to the JSON file
+  and removed at the end. If nThreads is positive, the stress test
+  is run on the combinational designs in nThreads frames at the same
+  time. Returns the number of failed flows and stress tests, or -1
+  if the suite could not be started.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_RunBench( Abc_Frame_t * pAbc, char * pFileOut, Vec_Ptr_t * vDesigns, int nMultBits, int nCountBits, int nFrames, int nThreads, int fVerbose )
+{
+    Vec_Ptr_t * vFiles = Vec_PtrAlloc( 10 );
+    Vec_Ptr_t * vNames = Vec_PtrAlloc( 10 );
+    Vec_Int_t * vKinds = Vec_IntAlloc( 10 );
+    Vec_Ptr_t * vTemps = Vec_PtrAlloc( 10 );
+    Vec_Str_t * vCmd   = Vec_StrAlloc( 1000 );
+    char * pPrefix, * pLib, * pTemp, * pName;
+    double WallTime = Cmd_BenchWallTime();
+    int i, k, nFailed = 0, fFirst = 1, fSourceOld = pAbc->fSource;
+    FILE * pFile = fopen( pFileOut, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open output file \"%s\".\n", pFileOut );
+        return -1;
+    }
+    // the prefix of the generated files is the output file name without extension
+    pPrefix = Extra_FileNameGenericAppend( pFileOut, "" );
+    pPrefix = Abc_UtilStrsav( pPrefix );
+    // bundled designs
+    Vec_PtrForEachEntry( char *, vDesigns, pName, i )
+    {
+        Vec_PtrPush( vFiles, Abc_UtilStrsav(pName) );
+        Vec_PtrPush( vNames, Extra_FileNameGeneric(Extra_FileNameWithoutPath(pName)) );
+        Vec_IntPush( vKinds, BENCH_COMB );
+    }
+    // generated designs
+    if ( nMultBits > 0 )
+    {
+        Vec_StrClear( vCmd );
+        Vec_StrPrintF( vCmd, "%s_mult%d.blif", pPrefix, nMultBits );
+        Vec_StrPush( vCmd, '\0' );
+        pName = Abc_UtilStrsav( Vec_StrArray(vCmd) );
+        Vec_PtrPush( vTemps, Abc_UtilStrsav(pName) );
+        Vec_StrClear( vCmd );
+        Vec_StrPrintF( vCmd, "gen -m -N %d %s; read %s; strash; write %s_mult%d.aig", nMultBits, pName, pName, pPrefix, nMultBits );
+        Vec_StrPush( vCmd, '\0' );
+        ABC_FREE( pName );
+        if ( Cmd_CommandExecute( pAbc, Vec_StrArray(vCmd) ) == 0 )
+        {
+            Vec_StrClear( vCmd );
+            Vec_StrPrintF( vCmd, "%s_mult%d.aig", pPrefix, nMultBits );
+            Vec_StrPush( vCmd, '\0' );
+            Vec_PtrPush( vFiles, Abc_UtilStrsav(Vec_StrArray(vCmd)) );
+            Vec_PtrPush( vTemps, Abc_UtilStrsav(Vec_StrArray(vCmd)) );
+            Vec_StrClear( vCmd );
+            Vec_StrPrintF( vCmd, "mult%d", nMultBits );
+            Vec_StrPush( vCmd, '\0' );
+            Vec_PtrPush( vNames, Abc_UtilStrsav(Vec_StrArray(vCmd)) );
+            Vec_IntPush( vKinds, BENCH_COMB );
+        }
+        else
+            printf( "Generating the multiplier has failed.\n" );
+    }
+    if ( nCountBits > 0 )
+    {
+        Gia_Man_t * pGia = Cmd_BenchGenCounters( nCountBits );
+        Vec_StrClear( vCmd );
+        Vec_StrPrintF( vCmd, "%s_counters%d.aig", pPrefix, nCountBits );
+        Vec_StrPush( vCmd, '\0' );
+        Gia_AigerWrite( pGia, Vec_StrArray(vCmd), 0, 0, 0 );
+        Gia_ManStop( pGia );
+        Vec_PtrPush( vFiles, Abc_UtilStrsav(Vec_StrArray(vCmd)) );
+        Vec_PtrPush( vTemps, Abc_UtilStrsav(Vec_StrArray(vCmd)) );
+        Vec_StrClear( vCmd );
+        Vec_StrPrintF( vCmd, "counters%d", nCountBits );
+        Vec_StrPush( vCmd, '\0' );
+        Vec_PtrPush( vNames, Abc_UtilStrsav(Vec_StrArray(vCmd)) );
+        Vec_IntPush( vKinds, BENCH_SEQ );
+    }
+    // generated library
+    Vec_StrClear( vCmd );
+    Vec_StrPrintF( vCmd, "%s.lib", pPrefix );
+    Vec_StrPush( vCmd, '\0' );
+    pLib = Abc_UtilStrsav( Vec_StrArray(vCmd) );
+    Vec_PtrPush( vTemps, Abc_UtilStrsav(pLib) );
+    if ( !Cmd_BenchWriteLiberty( pLib ) )
+        printf( "Cannot write the library file \"%s\".\n", pLib );
+    // run the flows without recording the commands in the history
+    pAbc->fSource = 1;
+    fprintf( pFile, "{\n" );
+    fprintf( pFile, "  \"version\": " );
+    Cmd_BenchWriteString( pFile, Abc_UtilsGetVersion(pAbc) );
+    fprintf( pFile, ",\n  \"runs\": [\n" );
+    for ( k = 0; s_BenchFlows[k].pName; k++ )
+        Vec_PtrForEachEntry( char *, vFiles, pName, i )
+        {
+            if ( Vec_IntEntry(vKinds, i) != s_BenchFlows[k].Kind )
+                continue;
+            fprintf( pFile, "%s", fFirst ? "" : ",\n" );
+            nFailed += Cmd_BenchRunFlow( pAbc, pFile, s_BenchFlows + k, (char *)Vec_PtrEntry(vNames, i), pName, pLib, nFrames, fVerbose ) > 0;
+            fFirst = 0;
+        }
+    fprintf( pFile, "\n  ],\n" );
+    if ( nThreads > 0 )
+    {
+        fFirst = 1;
+        fprintf( pFile, "  \"stress\": [\n" );
+        Vec_PtrForEachEntry( char *, vFiles, pName, i )
+        {
+            if ( Vec_IntEntry(vKinds, i) != BENCH_COMB )
+                continue;
+            fprintf( pFile, "%s", fFirst ? "" : ",\n" );
+            nFailed += Cmd_BenchRunStress( pAbc, pFile, (char *)Vec_PtrEntry(vNames, i), pName, pPrefix, nThreads, fVerbose ) != 0;
+            fFirst = 0;
+        }
+        fprintf( pFile, "\n  ],\n" );
+    }
+    WallTime = Cmd_BenchWallTime() - WallTime;
+    fprintf( pFile, "  \"failed\": %d, \"wall_sec\": %.4f, \"process_peak_rss_kb\": %ld\n}\n", nFailed, WallTime, Cmd_BenchPeakRss() );
+    fclose( pFile );
+    pAbc->fSource = fSourceOld;
+    printf( "bench: Finished %s.  Wall = %.2f sec.  Results are written into \"%s\".\n",
+        nFailed ? "with failures" : "successfully", WallTime, pFileOut );
+    // remove the generated files
+    Vec_PtrForEachEntry( char *, vTemps, pTemp, i )
+        remove( pTemp );
+    Vec_PtrFreeFree( vTemps );
+    Vec_PtrFreeFree( vFiles );
+    Vec_PtrFreeFree( vNames );
+    Vec_IntFree( vKinds );
+    Vec_StrFree( vCmd );
+    ABC_FREE( pPrefix );
+    ABC_FREE( pLib );
+    return nFailed;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -68,6 +68,8 @@ extern void       CmdCommandAliasAdd( Abc_Frame_t * pAbc, char * sName, int argc
 extern void       CmdCommandAliasPrint( Abc_Frame_t * pAbc, Abc_Alias * pAlias );
 extern char *     CmdCommandAliasLookup( Abc_Frame_t * pAbc, char * sCommand );
 extern void       CmdCommandAliasFree( Abc_Alias * p );
+/*=== cmdBench.c =======================================================*/
+extern int        Cmd_RunBench( Abc_Frame_t * pAbc, char * pFileOut, Vec_Ptr_t * vDesigns, int nMultBits, int nCountBits, int nFrames, int nThreads, int fVerbose );
 /*=== cmdUtils.c =======================================================*/
 extern int        CmdCommandDispatch( Abc_Frame_t * pAbc, int * argc, char *** argv );
 extern const char *     CmdSplitLine( Abc_Frame_t * pAbc, const char * sCommand, int * argc, char *** argv );
@@ -79,6 +79,38 @@ int cmdCheckShellEscape( Abc_Frame_t * pAbc, int argc, char ** argv)
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Restores the compressed AIGs before running the command.]
+
+  Description [Only a few commands work with the compressed objects
+  (see &zip). All other commands get the AIGs with the object array.
+  The code outside of the commands gets the current AIG through
+  Abc_FrameReadGia() or Abc_FrameGetGia(), which restore it as well,
+  while Gia_ManObj() asserts that the object array is present.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void CmdCommandUnzipGia( Abc_Frame_t * pAbc, Abc_Command * pCommand )
+{
+    static char * pZipAware[] = { "&ps", "&w", "&write", "&r", "&read", "&zip", "&zip_sim", "&zip_cnf", NULL };
+    int i;
+    if ( !(pAbc->pGia && Gia_ManIsZipped(pAbc->pGia)) && !(pAbc->pGia2 && Gia_ManIsZipped(pAbc->pGia2)) )
+        return;
+    if ( !strcmp(pCommand->sGroup, "Basic") )
+        return;
+    for ( i = 0; pZipAware[i]; i++ )
+        if ( !strcmp(pCommand->sName, pZipAware[i]) )
+            return;
+    if ( pAbc->pGia )
+        Gia_ManUnzip( pAbc->pGia );
+    if ( pAbc->pGia2 )
+        Gia_ManUnzip( pAbc->pGia2 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Executes one command.]
@@ -147,6 +179,9 @@ int CmdCommandDispatch( Abc_Frame_t * pAbc, int * pargc, char *** pargv )
         }
     }
 
+    // restore the compressed AIGs, unless the command can use them
+    CmdCommandUnzipGia( pAbc, pCommand );
+
     // execute the command
     clk = Extra_CpuTimeDouble();
     pFunc = (int (*)(Abc_Frame_t *, int, char **))pCommand->pFunc;
@@ -2152,19 +2152,35 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     int fFastAlgo;
     int fAllPrimes;
     int fChangePol;
+    int fStream;
+    int nProcs;
     int fVerbose;
     extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose );
+    extern int Abc_NtkDarToCnfStream( Abc_Ntk_t * pNtk, char * pFileName, int fChangePol, int nProcs, int fVerbose );
 
     fNewAlgo = 1;
     fFastAlgo = 0;
     fAllPrimes = 0;
     fChangePol = 1;
+    fStream = 0;
+    nProcs = 1;
     fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nfpcvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pnfpcsvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs <= 0 )
+                    goto usage;
+                break;
             case 'n':
                 fNewAlgo ^= 1;
                 break;
@@ -2177,6 +2193,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
             case 'c':
                 fChangePol ^= 1;
                 break;
+            case 's':
+                fStream ^= 1;
+                break;
             case 'v':
                 fVerbose ^= 1;
                 break;
@@ -2195,6 +2214,14 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
         goto usage;
     // get the output file name
     pFileName = argv[globalUtilOptind];
+    // streaming writes plain text; compressed files use the in-memory CNF
+    if ( fStream && !Abc_NtkIsStrash(pAbc->pNtkCur) )
+    {
+        fStream = 0;
+        printf( "Warning: Streaming CNF is only available for AIGs (run \"strash\").\n" );
+    }
+    if ( fStream && strlen(pFileName) > 3 && !strcmp(pFileName + strlen(pFileName) - 3, ".gz") )
+        fStream = 0, fFastAlgo = 1;
     // check if the feature will be used
     if ( Abc_NtkIsStrash(pAbc->pNtkCur) && fAllPrimes )
     {
@@ -2202,7 +2229,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
         printf( "Warning: Selected option to write all primes has no effect when deriving CNF from AIG.\n" );
     }
     // call the corresponding file writer
-    if ( fFastAlgo )
+    if ( fStream )
+        Abc_NtkDarToCnfStream( pAbc->pNtkCur, pFileName, fChangePol, nProcs, fVerbose );
+    else if ( fFastAlgo )
         Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, fVerbose );
     else if ( fNewAlgo )
         Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, fVerbose );
@@ -2213,12 +2242,14 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_cnf [-nfpcvh] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_cnf [-P num] [-nfpcsvh] <file>\n" );
     fprintf( pAbc->Err, "\t         generates CNF for the miter (see also \"&write_cnf\")\n" );
     fprintf( pAbc->Err, "\t-n     : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-f     : toggle using fast algorithm [default = %s]\n", fFastAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-p     : toggle using all primes to enhance implicativity [default = %s]\n", fAllPrimes? "yes" : "no" );
     fprintf( pAbc->Err, "\t-c     : toggle adjasting polarity of internal variables [default = %s]\n", fChangePol? "yes" : "no" );
+    fprintf( pAbc->Err, "\t-s     : toggle streaming the fast CNF into the file without storing it [default = %s]\n", fStream? "yes" : "no" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads deriving clauses when streaming [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes" : "no" );
     fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
     fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
@@ -0,0 +1,511 @@
+/**CFile****************************************************************
+
+  FileName    [mainDaemon.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [The main package.]
+
+  Synopsis    [Long-running daemon serving command scripts over a UNIX socket.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: mainDaemon.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#ifndef WIN32
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE     // struct ucred used with SO_PEERCRED
+#endif
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <signal.h>
+#include <errno.h>
+#endif
+
+#include "base/abc/abc.h"
+#include "mainInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+/*
+    The daemon keeps one initialized frame alive (resource file sourced,
+    DAR/rewriting tables built, libraries read once) and serves clients
+    connecting to a UNIX socket. Each connection carries one job: a script
+    terminated by the end of the stream or by a line containing only ".".
+    Lines are executed by Cmd_CommandExecute() one after another until one
+    of them fails. Everything the job prints to stdout/stderr is sent back
+    to the client, followed by the line "@status <n>" with the status of
+    the last executed line.
+
+    The socket is created with permissions 0600, and connections from
+    other users are refused. A client that does not send the complete
+    job within ABC_DMN_TIMEOUT seconds is disconnected without running it,
+    and the output of a job is dropped if the client does not read it 
+    within this time.
+
+    The current designs are cleared before each job, while libraries and
+    other settings of the frame persist. Designs can be kept across jobs
+    under a name (handle) using the following commands, which the daemon
+    adds to the frame:
+
+        @save <handle>   store copies of the current network and &-space AIG
+        @load <handle>   make copies of the stored designs current
+        @free <handle>   delete the stored designs
+        @list            list the handles
+        @stop            shut down the daemon after this job
+
+    Example of a client session using a BSD netcat:
+
+        printf 'read_genlib lib.genlib\nread top.aig\n@save top\n' | nc -N -U /tmp/abc.sock
+        printf '@load top\nstrash; dc2; map; print_stats\n' | nc -N -U /tmp/abc.sock
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define ABC_DMN_TIMEOUT 60   // seconds to wait for the client to send or receive
+
+typedef struct Abc_Dmn_t_ Abc_Dmn_t;
+struct Abc_Dmn_t_
+{
+    Abc_Frame_t * pAbc;         // the frame serving the jobs
+    Vec_Ptr_t *   vNames;       // handle names
+    Vec_Ptr_t *   vNtks;        // networks saved under the handles (or NULL)
+    Vec_Ptr_t *   vGias;        // AIGs saved under the handles (or NULL)
+    int           nJobs;        // the number of jobs served
+    int           fStop;        // set to stop the daemon
+    int           fVerbose;     // verbose output
+};
+
+static Abc_Dmn_t * s_pDmn = NULL; // the running daemon
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef WIN32
+
+/**Function*************************************************************
+
+  Synopsis    [Manipulation of design handles.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_DmnHandleFind( Abc_Dmn_t * p, char * pName )
+{
+    char * pTemp; int i;
+    Vec_PtrForEachEntry( char *, p->vNames, pTemp, i )
+        if ( !strcmp(pTemp, pName) )
+            return i;
+    return -1;
+}
+static void Abc_DmnHandleClean( Abc_Dmn_t * p, int i )
+{
+    Abc_Ntk_t * pNtk = (Abc_Ntk_t *)Vec_PtrEntry( p->vNtks, i );
+    Gia_Man_t * pGia = (Gia_Man_t *)Vec_PtrEntry( p->vGias, i );
+    if ( pNtk ) Abc_NtkDelete( pNtk );
+    if ( pGia ) Gia_ManStop( pGia );
+    Vec_PtrWriteEntry( p->vNtks, i, NULL );
+    Vec_PtrWriteEntry( p->vGias, i, NULL );
+}
+static int Abc_DmnHandleSave( Abc_Dmn_t * p, char * pName )
+{
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk( p->pAbc );
+    Gia_Man_t * pGia = Abc_FrameReadGia( p->pAbc );
+    int i = Abc_DmnHandleFind( p, pName );
+    if ( pNtk == NULL && pGia == NULL )
+    {
+        Abc_Print( -1, "There is no design to save under handle \"%s\".\n", pName );
+        return 1;
+    }
+    if ( i == -1 )
+    {
+        i = Vec_PtrSize( p->vNames );
+        Vec_PtrPush( p->vNames, Abc_UtilStrsav(pName) );
+        Vec_PtrPush( p->vNtks, NULL );
+        Vec_PtrPush( p->vGias, NULL );
+    }
+    else
+        Abc_DmnHandleClean( p, i );
+    Vec_PtrWriteEntry( p->vNtks, i, pNtk ? Abc_NtkDup(pNtk) : NULL );
+    Vec_PtrWriteEntry( p->vGias, i, pGia ? Gia_ManDupWithAttributes(pGia) : NULL );
+    return 0;
+}
+static int Abc_DmnHandleLoad( Abc_Dmn_t * p, char * pName )
+{
+    Abc_Ntk_t * pNtk; Gia_Man_t * pGia;
+    int i = Abc_DmnHandleFind( p, pName );
+    if ( i == -1 )
+    {
+        Abc_Print( -1, "Handle \"%s\" is not defined.\n", pName );
+        return 1;
+    }
+    pNtk = (Abc_Ntk_t *)Vec_PtrEntry( p->vNtks, i );
+    pGia = (Gia_Man_t *)Vec_PtrEntry( p->vGias, i );
+    if ( pNtk )
+        Abc_FrameReplaceCurrentNetwork( p->pAbc, Abc_NtkDup(pNtk) );
+    if ( pGia )
+        Abc_FrameUpdateGia( p->pAbc, Gia_ManDupWithAttributes(pGia) );
+    return 0;
+}
+static int Abc_DmnHandleFree( Abc_Dmn_t * p, char * pName )
+{
+    int i = Abc_DmnHandleFind( p, pName );
+    if ( i == -1 )
+    {
+        Abc_Print( -1, "Handle \"%s\" is not defined.\n", pName );
+        return 1;
+    }
+    Abc_DmnHandleClean( p, i );
+    ABC_FREE( p->vNames->pArray[i] );
+    Vec_PtrDrop( p->vNames, i );
+    Vec_PtrDrop( p->vNtks, i );
+    Vec_PtrDrop( p->vGias, i );
+    return 0;
+}
+static void Abc_DmnHandleList( Abc_Dmn_t * p )
+{
+    char * pName; int i;
+    Vec_PtrForEachEntry( char *, p->vNames, pName, i )
+    {
+        Abc_Ntk_t * pNtk = (Abc_Ntk_t *)Vec_PtrEntry( p->vNtks, i );
+        Gia_Man_t * pGia = (Gia_Man_t *)Vec_PtrEntry( p->vGias, i );
+        printf( "%-20s :", pName );
+        if ( pNtk )
+            printf( "  ntk \"%s\" (%d objs)", Abc_NtkName(pNtk), Abc_NtkObjNum(pNtk) );
+        if ( pGia )
+            printf( "  gia \"%s\" (%d objs)", Gia_ManName(pGia), Gia_ManObjNum(pGia) );
+        printf( "\n" );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Commands available to the jobs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_DmnCommandHandle( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( !strcmp(argv[0], "@list") )
+    {
+        if ( argc != globalUtilOptind )
+            goto usage;
+        Abc_DmnHandleList( s_pDmn );
+        return 0;
+    }
+    if ( !strcmp(argv[0], "@stop") )
+    {
+        if ( argc != globalUtilOptind )
+            goto usage;
+        s_pDmn->fStop = 1;
+        return 0;
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    if ( !strcmp(argv[0], "@save") )
+        return Abc_DmnHandleSave( s_pDmn, argv[globalUtilOptind] );
+    if ( !strcmp(argv[0], "@load") )
+        return Abc_DmnHandleLoad( s_pDmn, argv[globalUtilOptind] );
+    if ( !strcmp(argv[0], "@free") )
+        return Abc_DmnHandleFree( s_pDmn, argv[globalUtilOptind] );
+    return 1;
+
+usage:
+    if ( !strcmp(argv[0], "@list") || !strcmp(argv[0], "@stop") )
+    {
+        Abc_Print( -2, "usage: %s [-h]\n", argv[0] );
+        Abc_Print( -2, "\t         %s\n", !strcmp(argv[0], "@list") ? "lists the design handles of the daemon" : "shuts down the daemon after the current job" );
+    }
+    else
+    {
+        Abc_Print( -2, "usage: %s [-h] <handle>\n", argv[0] );
+        if ( !strcmp(argv[0], "@save") )
+            Abc_Print( -2, "\t         saves copies of the current network and AIG under the handle\n" );
+        else if ( !strcmp(argv[0], "@load") )
+            Abc_Print( -2, "\t         makes copies of the designs saved under the handle current\n" );
+        else
+            Abc_Print( -2, "\t         deletes the designs saved under the handle\n" );
+    }
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the last line of the job is the terminating "."]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_DmnJobIsComplete( Vec_Str_t * vJob )
+{
+    char * pEnd = Vec_StrArray(vJob) + Vec_StrSize(vJob);
+    int nSize = Vec_StrSize(vJob);
+    if ( nSize > 0 && pEnd[-1] == '\n' )
+        pEnd--, nSize--;
+    if ( nSize > 0 && pEnd[-1] == '\r' )
+        pEnd--, nSize--;
+    return nSize > 0 && pEnd[-1] == '.' && (nSize == 1 || pEnd[-2] == '\n');
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the client runs under the user of the daemon.]
+
+  Description [Platforms without a way to get the peer credentials
+  rely on the permissions of the socket file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_DmnClientIsTrusted( int Sock )
+{
+#if defined(SO_PEERCRED)
+    struct ucred Cred;
+    socklen_t nSize = sizeof(Cred);
+    if ( getsockopt( Sock, SOL_SOCKET, SO_PEERCRED, &Cred, &nSize ) == -1 )
+        return 0;
+    return Cred.uid == geteuid();
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
+    uid_t Uid; gid_t Gid;
+    if ( getpeereid( Sock, &Uid, &Gid ) == -1 )
+        return 0;
+    return Uid == geteuid();
+#else
+    return 1;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Serves one client connection.]
+
+  Description [Reads the job from the socket, executes it with the
+  standard output and error streams redirected to the socket, and
+  reports the status. The job is dropped if the client does not send
+  it completely before the timeout.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_DmnServeJob( Abc_Dmn_t * p, int Sock )
+{
+    Vec_Str_t * vJob = Vec_StrAlloc( 1000 );
+    struct timeval TimeOut = { ABC_DMN_TIMEOUT, 0 };
+    char Buffer[4096], * pLine, * pNext;
+    int nRead, fStdOut, fStdErr, fStatus = 0;
+    abctime clk = Abc_Clock();
+    // a client that stops reading or writing cannot block the daemon
+    setsockopt( Sock, SOL_SOCKET, SO_RCVTIMEO, &TimeOut, sizeof(TimeOut) );
+    setsockopt( Sock, SOL_SOCKET, SO_SNDTIMEO, &TimeOut, sizeof(TimeOut) );
+    // read the job until the end of the stream or the terminating line
+    while ( (nRead = read( Sock, Buffer, sizeof(Buffer) )) > 0 || (nRead == -1 && errno == EINTR) )
+    {
+        if ( nRead == -1 )
+            continue;
+        Vec_StrPushBuffer( vJob, Buffer, nRead );
+        if ( Abc_DmnJobIsComplete( vJob ) )
+            break;
+    }
+    if ( nRead == -1 )
+    {
+        if ( p->fVerbose )
+            printf( "The job was not received %s.\n", (errno == EAGAIN || errno == EWOULDBLOCK) ? "before the timeout" : "completely" );
+        Vec_StrFree( vJob );
+        return;
+    }
+    Vec_StrPush( vJob, '\0' );
+    // redirect the output
+    fflush( stdout );
+    fflush( stderr );
+    fStdOut = dup( 1 );
+    fStdErr = dup( 2 );
+    dup2( Sock, 1 );
+    dup2( Sock, 2 );
+    // start the job with empty design space
+    Abc_FrameDeleteAllNetworks( p->pAbc );
+    Abc_FrameClearVerifStatus( p->pAbc );
+    for ( pLine = Vec_StrArray(vJob); pLine; pLine = pNext )
+    {
+        if ( (pNext = strchr(pLine, '\n')) )
+            *pNext++ = '\0';
+        if ( pLine[0] && pLine[strlen(pLine)-1] == '\r' )
+            pLine[strlen(pLine)-1] = '\0';
+        if ( !strcmp(pLine, ".") )
+            break;
+        fStatus = Cmd_CommandExecute( p->pAbc, pLine );
+        fflush( stdout );
+        if ( fStatus )
+            break;
+    }
+    printf( "@status %d\n", fStatus );
+    // restore the output
+    fflush( stdout );
+    fflush( stderr );
+    dup2( fStdOut, 1 );
+    dup2( fStdErr, 2 );
+    close( fStdOut );
+    close( fStdErr );
+    p->nJobs++;
+    if ( p->fVerbose )
+    {
+        printf( "Job %d finished with status %d.  ", p->nJobs, fStatus );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_StrFree( vJob );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the daemon.]
+
+  Description [Listens to the UNIX socket with the given path and serves
+  the jobs one at a time in the given frame until a job issues "@stop".
+  An existing file with this path is replaced only if it is a socket.
+  Returns 0 on normal termination and 1 if the socket cannot be set up.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_DaemonStart( Abc_Frame_t * pAbc, const char * pSocket, int fVerbose )
+{
+    struct sockaddr_un Addr;
+    struct stat Stat;
+    Abc_Dmn_t Dmn, * p = &Dmn;
+    mode_t Mask;
+    int Sock, Client, i, RetValue;
+    if ( strlen(pSocket) >= sizeof(Addr.sun_path) )
+    {
+        Abc_Print( -1, "The socket path \"%s\" is too long.\n", pSocket );
+        return 1;
+    }
+    memset( &Addr, 0, sizeof(Addr) );
+    Addr.sun_family = AF_UNIX;
+    strcpy( Addr.sun_path, pSocket );
+    Sock = socket( AF_UNIX, SOCK_STREAM, 0 );
+    if ( Sock == -1 )
+    {
+        Abc_Print( -1, "Cannot create the socket.\n" );
+        return 1;
+    }
+    // remove the socket left by an earlier run, but no other kind of file
+    if ( lstat( pSocket, &Stat ) == 0 )
+    {
+        if ( !S_ISSOCK(Stat.st_mode) )
+        {
+            Abc_Print( -1, "File \"%s\" exists and is not a socket.\n", pSocket );
+            close( Sock );
+            return 1;
+        }
+        unlink( pSocket );
+    }
+    // the socket is created accessible to the owner only
+    Mask = umask( 077 );
+    RetValue = bind( Sock, (struct sockaddr *)&Addr, sizeof(Addr) );
+    umask( Mask );
+    if ( RetValue == -1 || chmod( pSocket, 0600 ) == -1 || listen( Sock, 16 ) == -1 )
+    {
+        Abc_Print( -1, "Cannot listen to socket \"%s\".\n", pSocket );
+        close( Sock );
+        if ( RetValue == 0 )
+            unlink( pSocket );
+        return 1;
+    }
+    // the client may disconnect before reading the output
+    signal( SIGPIPE, SIG_IGN );
+    memset( p, 0, sizeof(Abc_Dmn_t) );
+    p->pAbc     = pAbc;
+    p->vNames   = Vec_PtrAlloc( 16 );
+    p->vNtks    = Vec_PtrAlloc( 16 );
+    p->vGias    = Vec_PtrAlloc( 16 );
+    p->fVerbose = fVerbose;
+    s_pDmn = p;
+    Cmd_CommandAdd( pAbc, "Daemon", "@save", Abc_DmnCommandHandle, 0 );
+    Cmd_CommandAdd( pAbc, "Daemon", "@load", Abc_DmnCommandHandle, 0 );
+    Cmd_CommandAdd( pAbc, "Daemon", "@free", Abc_DmnCommandHandle, 0 );
+    Cmd_CommandAdd( pAbc, "Daemon", "@list", Abc_DmnCommandHandle, 0 );
+    Cmd_CommandAdd( pAbc, "Daemon", "@stop", Abc_DmnCommandHandle, 0 );
+    if ( fVerbose )
+        printf( "ABC daemon is listening to socket \"%s\".\n", pSocket );
+    while ( !p->fStop )
+    {
+        Client = accept( Sock, NULL, NULL );
+        if ( Client == -1 )
+            continue;
+        if ( Abc_DmnClientIsTrusted( Client ) )
+            Abc_DmnServeJob( p, Client );
+        else if ( fVerbose )
+            printf( "Refused the connection of another user.\n" );
+        close( Client );
+    }
+    if ( fVerbose )
+        printf( "ABC daemon served %d jobs.\n", p->nJobs );
+    close( Sock );
+    unlink( pSocket );
+    for ( i = 0; i < Vec_PtrSize(p->vNames); i++ )
+        Abc_DmnHandleClean( p, i );
+    Vec_PtrFreeFree( p->vNames );
+    Vec_PtrFree( p->vNtks );
+    Vec_PtrFree( p->vGias );
+    s_pDmn = NULL;
+    return 0;
+}
+
+#else
+
+int Abc_DaemonStart( Abc_Frame_t * pAbc, const char * pSocket, int fVerbose )
+{
+    Abc_Print( -1, "The daemon mode is not supported on this platform.\n" );
+    return 1;
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -36,6 +36,11 @@ ABC_NAMESPACE_IMPL_START
 ////////////////////////////////////////////////////////////////////////
 
 static Abc_Frame_t * s_GlobalFrame = NULL;
+static ABC_THREAD_LOCAL Abc_Frame_t * s_ThreadFrame = NULL; // the private frame of the current thread
+static void * s_pManCnfNoFrame = NULL; // CNF manager used by applications that never start a frame
+
+// the frame seen by the current thread (private frame of a worker thread or the global frame)
+static inline Abc_Frame_t * Abc_FrameCurrent() { return s_ThreadFrame ? s_ThreadFrame : s_GlobalFrame; }
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -52,77 +57,79 @@ static Abc_Frame_t * s_GlobalFrame = NULL;
   SeeAlso     []
 
 ***********************************************************************/
-Vec_Ptr_t * Abc_FrameReadStore()                             { return s_GlobalFrame->vStore;       } 
-int         Abc_FrameReadStoreSize()                         { return Vec_PtrSize(s_GlobalFrame->vStore); }
-void *      Abc_FrameReadLibLut()                            { return s_GlobalFrame->pLibLut;      } 
-void *      Abc_FrameReadLibBox()                            { return s_GlobalFrame->pLibBox;      } 
-void *      Abc_FrameReadLibGen()                            { return s_GlobalFrame->pLibGen;      } 
-void *      Abc_FrameReadLibGen2()                           { return s_GlobalFrame->pLibGen2;     } 
-void *      Abc_FrameReadLibSuper()                          { return s_GlobalFrame->pLibSuper;    } 
-void *      Abc_FrameReadLibScl()                            { return s_GlobalFrame->pLibScl;      } 
+Vec_Ptr_t * Abc_FrameReadStore()                             { return Abc_FrameCurrent()->vStore;       } 
+int         Abc_FrameReadStoreSize()                         { return Vec_PtrSize(Abc_FrameCurrent()->vStore); }
+void *      Abc_FrameReadLibLut()                            { return Abc_FrameCurrent()->pLibLut;      } 
+void *      Abc_FrameReadLibBox()                            { return Abc_FrameCurrent()->pLibBox;      } 
+void *      Abc_FrameReadLibGen()                            { return Abc_FrameCurrent()->pLibGen;      } 
+void *      Abc_FrameReadLibGen2()                           { return Abc_FrameCurrent()->pLibGen2;     } 
+void *      Abc_FrameReadLibSuper()                          { return Abc_FrameCurrent()->pLibSuper;    } 
+void *      Abc_FrameReadLibScl()                            { return Abc_FrameCurrent()->pLibScl;      } 
 #ifdef ABC_USE_CUDD
-void *      Abc_FrameReadManDd()                             { if ( s_GlobalFrame->dd == NULL )      s_GlobalFrame->dd = Cudd_Init( 0, 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );  return s_GlobalFrame->dd;      } 
+void *      Abc_FrameReadManDd()                             { if ( Abc_FrameCurrent()->dd == NULL )      Abc_FrameCurrent()->dd = Cudd_Init( 0, 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );  return Abc_FrameCurrent()->dd;      } 
 #endif
-void *      Abc_FrameReadManDec()                            { if ( s_GlobalFrame->pManDec == NULL ) s_GlobalFrame->pManDec = Dec_ManStart();                                        return s_GlobalFrame->pManDec; } 
-void *      Abc_FrameReadManDsd()                            { return s_GlobalFrame->pManDsd;      } 
-void *      Abc_FrameReadManDsd2()                           { return s_GlobalFrame->pManDsd2;     }
-char *      Abc_FrameReadFlag( char * pFlag )                { return Cmd_FlagReadByName( s_GlobalFrame, pFlag );   }
-Vec_Ptr_t * Abc_FrameReadSignalNames()                       { return s_GlobalFrame->vSignalNames; }
-char *      Abc_FrameReadSpecName()                          { return s_GlobalFrame->pSpecName;    }
-
-int         Abc_FrameReadBmcFrames( Abc_Frame_t * p )        { return s_GlobalFrame->nFrames;      }               
-int         Abc_FrameReadProbStatus( Abc_Frame_t * p )       { return s_GlobalFrame->Status;       }               
-void *      Abc_FrameReadCex( Abc_Frame_t * p )              { return s_GlobalFrame->pCex;         }        
-Vec_Ptr_t * Abc_FrameReadCexVec( Abc_Frame_t * p )           { return s_GlobalFrame->vCexVec;      }        
-Vec_Int_t * Abc_FrameReadStatusVec( Abc_Frame_t * p )        { return s_GlobalFrame->vStatuses;    }        
-Vec_Ptr_t * Abc_FrameReadPoEquivs( Abc_Frame_t * p )         { return s_GlobalFrame->vPoEquivs;    }        
-Vec_Int_t * Abc_FrameReadPoStatuses( Abc_Frame_t * p )       { return s_GlobalFrame->vStatuses;    }        
-Vec_Int_t * Abc_FrameReadObjIds( Abc_Frame_t * p )           { return s_GlobalFrame->vAbcObjIds;   }        
-Abc_Nam_t * Abc_FrameReadJsonStrs( Abc_Frame_t * p )         { return s_GlobalFrame->pJsonStrs;    }     
-Vec_Wec_t * Abc_FrameReadJsonObjs( Abc_Frame_t * p )         { return s_GlobalFrame->vJsonObjs;    }   
+void *      Abc_FrameReadManDec()                            { if ( Abc_FrameCurrent()->pManDec == NULL ) Abc_FrameCurrent()->pManDec = Dec_ManStart();                                        return Abc_FrameCurrent()->pManDec; } 
+void *      Abc_FrameReadManDsd()                            { return Abc_FrameCurrent()->pManDsd;      } 
+void *      Abc_FrameReadManDsd2()                           { return Abc_FrameCurrent()->pManDsd2;     }
+void *      Abc_FrameReadManCnf()                            { return Abc_FrameCurrent() ? Abc_FrameCurrent()->pManCnf : s_pManCnfNoFrame; }
+char *      Abc_FrameReadFlag( char * pFlag )                { return Cmd_FlagReadByName( Abc_FrameCurrent(), pFlag );   }
+Vec_Ptr_t * Abc_FrameReadSignalNames()                       { return Abc_FrameCurrent()->vSignalNames; }
+char *      Abc_FrameReadSpecName()                          { return Abc_FrameCurrent()->pSpecName;    }
+
+int         Abc_FrameReadBmcFrames( Abc_Frame_t * p )        { return Abc_FrameCurrent()->nFrames;      }               
+int         Abc_FrameReadProbStatus( Abc_Frame_t * p )       { return Abc_FrameCurrent()->Status;       }               
+void *      Abc_FrameReadCex( Abc_Frame_t * p )              { return Abc_FrameCurrent()->pCex;         }        
+Vec_Ptr_t * Abc_FrameReadCexVec( Abc_Frame_t * p )           { return Abc_FrameCurrent()->vCexVec;      }        
+Vec_Int_t * Abc_FrameReadStatusVec( Abc_Frame_t * p )        { return Abc_FrameCurrent()->vStatuses;    }        
+Vec_Ptr_t * Abc_FrameReadPoEquivs( Abc_Frame_t * p )         { return Abc_FrameCurrent()->vPoEquivs;    }        
+Vec_Int_t * Abc_FrameReadPoStatuses( Abc_Frame_t * p )       { return Abc_FrameCurrent()->vStatuses;    }        
+Vec_Int_t * Abc_FrameReadObjIds( Abc_Frame_t * p )           { return Abc_FrameCurrent()->vAbcObjIds;   }        
+Abc_Nam_t * Abc_FrameReadJsonStrs( Abc_Frame_t * p )         { return Abc_FrameCurrent()->pJsonStrs;    }     
+Vec_Wec_t * Abc_FrameReadJsonObjs( Abc_Frame_t * p )         { return Abc_FrameCurrent()->vJsonObjs;    }   
        
-int         Abc_FrameReadCexPiNum( Abc_Frame_t * p )         { return s_GlobalFrame->pCex->nPis;   }               
-int         Abc_FrameReadCexRegNum( Abc_Frame_t * p )        { return s_GlobalFrame->pCex->nRegs;  }               
-int         Abc_FrameReadCexPo( Abc_Frame_t * p )            { return s_GlobalFrame->pCex->iPo;    }               
-int         Abc_FrameReadCexFrame( Abc_Frame_t * p )         { return s_GlobalFrame->pCex->iFrame; }               
-
-void        Abc_FrameInputNdr( Abc_Frame_t * pAbc, void * pData ) { Ndr_Delete(s_GlobalFrame->pNdr); s_GlobalFrame->pNdr = pData;                        }
-void *      Abc_FrameOutputNdr( Abc_Frame_t * pAbc )         { void * pData = s_GlobalFrame->pNdr; s_GlobalFrame->pNdr = NULL; return pData;             }  
-int *       Abc_FrameOutputNdrArray( Abc_Frame_t * pAbc )    { int * pArray = s_GlobalFrame->pNdrArray; s_GlobalFrame->pNdrArray = NULL; return pArray;  }
-
-void        Abc_FrameSetLibLut( void * pLib )                { s_GlobalFrame->pLibLut   = pLib;    } 
-void        Abc_FrameSetLibBox( void * pLib )                { s_GlobalFrame->pLibBox   = pLib;    } 
-void        Abc_FrameSetLibGen( void * pLib )                { s_GlobalFrame->pLibGen   = pLib;    } 
-void        Abc_FrameSetLibGen2( void * pLib )               { s_GlobalFrame->pLibGen2  = pLib;    } 
-void        Abc_FrameSetLibSuper( void * pLib )              { s_GlobalFrame->pLibSuper = pLib;    } 
-void        Abc_FrameSetFlag( char * pFlag, char * pValue )  { Cmd_FlagUpdateValue( s_GlobalFrame, pFlag, pValue );               } 
-void        Abc_FrameSetCex( Abc_Cex_t * pCex )              { ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->pCex = pCex;       }
-void        Abc_FrameSetNFrames( int nFrames )               { ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->nFrames = nFrames; }
-void        Abc_FrameSetStatus( int Status )                 { ABC_FREE( s_GlobalFrame->pCex ); s_GlobalFrame->Status = Status;   }
-void        Abc_FrameSetManDsd( void * pMan )                { if (s_GlobalFrame->pManDsd  && s_GlobalFrame->pManDsd  != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd,  0); s_GlobalFrame->pManDsd = pMan;  }
-void        Abc_FrameSetManDsd2( void * pMan )               { if (s_GlobalFrame->pManDsd2 && s_GlobalFrame->pManDsd2 != pMan) If_DsdManFree((If_DsdMan_t *)s_GlobalFrame->pManDsd2, 0); s_GlobalFrame->pManDsd2 = pMan; }
-void        Abc_FrameSetInv( Vec_Int_t * vInv )              { Vec_IntFreeP(&s_GlobalFrame->pAbcWlcInv); s_GlobalFrame->pAbcWlcInv = vInv; }
-void        Abc_FrameSetJsonStrs( Abc_Nam_t * pStrs )        { Abc_NamDeref( s_GlobalFrame->pJsonStrs ); s_GlobalFrame->pJsonStrs = pStrs; }
-void        Abc_FrameSetJsonObjs( Vec_Wec_t * vObjs )        { Vec_WecFreeP(&s_GlobalFrame->vJsonObjs ); s_GlobalFrame->vJsonObjs = vObjs; }
-void        Abc_FrameSetSignalNames( Vec_Ptr_t * vNames )    { if ( s_GlobalFrame->vSignalNames ) Vec_PtrFreeFree( s_GlobalFrame->vSignalNames ); s_GlobalFrame->vSignalNames = vNames; }
-void        Abc_FrameSetSpecName( char * pFileName )         { ABC_FREE( s_GlobalFrame->pSpecName ); s_GlobalFrame->pSpecName = pFileName; }
-
-int         Abc_FrameIsBatchMode()                           { return s_GlobalFrame ? s_GlobalFrame->fBatchMode : 0;              } 
-void        Abc_FrameSetBatchMode( int Mode )                { if ( s_GlobalFrame ) s_GlobalFrame->fBatchMode = Mode;             } 
-
-int         Abc_FrameIsBridgeMode()                          { return s_GlobalFrame ? s_GlobalFrame->fBridgeMode : 0;             } 
-void        Abc_FrameSetBridgeMode()                         { if ( s_GlobalFrame ) s_GlobalFrame->fBridgeMode = 1;               } 
-
-char *      Abc_FrameReadDrivingCell()                       { return s_GlobalFrame->pDrivingCell;    }              
-float       Abc_FrameReadMaxLoad()                           { return s_GlobalFrame->MaxLoad;         }      
-void        Abc_FrameSetDrivingCell( char * pName )          { ABC_FREE(s_GlobalFrame->pDrivingCell); s_GlobalFrame->pDrivingCell   = pName; }      
-void        Abc_FrameSetMaxLoad( float Load )                { s_GlobalFrame->MaxLoad = Load;         }      
+int         Abc_FrameReadCexPiNum( Abc_Frame_t * p )         { return Abc_FrameCurrent()->pCex->nPis;   }               
+int         Abc_FrameReadCexRegNum( Abc_Frame_t * p )        { return Abc_FrameCurrent()->pCex->nRegs;  }               
+int         Abc_FrameReadCexPo( Abc_Frame_t * p )            { return Abc_FrameCurrent()->pCex->iPo;    }               
+int         Abc_FrameReadCexFrame( Abc_Frame_t * p )         { return Abc_FrameCurrent()->pCex->iFrame; }               
+
+void        Abc_FrameInputNdr( Abc_Frame_t * pAbc, void * pData ) { Ndr_Delete(Abc_FrameCurrent()->pNdr); Abc_FrameCurrent()->pNdr = pData;                        }
+void *      Abc_FrameOutputNdr( Abc_Frame_t * pAbc )         { void * pData = Abc_FrameCurrent()->pNdr; Abc_FrameCurrent()->pNdr = NULL; return pData;             }  
+int *       Abc_FrameOutputNdrArray( Abc_Frame_t * pAbc )    { int * pArray = Abc_FrameCurrent()->pNdrArray; Abc_FrameCurrent()->pNdrArray = NULL; return pArray;  }
+
+void        Abc_FrameSetLibLut( void * pLib )                { Abc_FrameCurrent()->pLibLut   = pLib;    } 
+void        Abc_FrameSetLibBox( void * pLib )                { Abc_FrameCurrent()->pLibBox   = pLib;    } 
+void        Abc_FrameSetLibGen( void * pLib )                { Abc_FrameCurrent()->pLibGen   = pLib;    } 
+void        Abc_FrameSetLibGen2( void * pLib )               { Abc_FrameCurrent()->pLibGen2  = pLib;    } 
+void        Abc_FrameSetLibSuper( void * pLib )              { Abc_FrameCurrent()->pLibSuper = pLib;    } 
+void        Abc_FrameSetFlag( char * pFlag, char * pValue )  { Cmd_FlagUpdateValue( Abc_FrameCurrent(), pFlag, pValue );               } 
+void        Abc_FrameSetCex( Abc_Cex_t * pCex )              { ABC_FREE( Abc_FrameCurrent()->pCex ); Abc_FrameCurrent()->pCex = pCex;       }
+void        Abc_FrameSetNFrames( int nFrames )               { ABC_FREE( Abc_FrameCurrent()->pCex ); Abc_FrameCurrent()->nFrames = nFrames; }
+void        Abc_FrameSetStatus( int Status )                 { ABC_FREE( Abc_FrameCurrent()->pCex ); Abc_FrameCurrent()->Status = Status;   }
+void        Abc_FrameSetManDsd( void * pMan )                { if (Abc_FrameCurrent()->pManDsd  && Abc_FrameCurrent()->pManDsd  != pMan) If_DsdManFree((If_DsdMan_t *)Abc_FrameCurrent()->pManDsd,  0); Abc_FrameCurrent()->pManDsd = pMan;  }
+void        Abc_FrameSetManDsd2( void * pMan )               { if (Abc_FrameCurrent()->pManDsd2 && Abc_FrameCurrent()->pManDsd2 != pMan) If_DsdManFree((If_DsdMan_t *)Abc_FrameCurrent()->pManDsd2, 0); Abc_FrameCurrent()->pManDsd2 = pMan; }
+void        Abc_FrameSetManCnf( void * pMan )                { if ( Abc_FrameCurrent() ) Abc_FrameCurrent()->pManCnf = pMan; else s_pManCnfNoFrame = pMan; }
+void        Abc_FrameSetInv( Vec_Int_t * vInv )              { Vec_IntFreeP(&Abc_FrameCurrent()->pAbcWlcInv); Abc_FrameCurrent()->pAbcWlcInv = vInv; }
+void        Abc_FrameSetJsonStrs( Abc_Nam_t * pStrs )        { Abc_NamDeref( Abc_FrameCurrent()->pJsonStrs ); Abc_FrameCurrent()->pJsonStrs = pStrs; }
+void        Abc_FrameSetJsonObjs( Vec_Wec_t * vObjs )        { Vec_WecFreeP(&Abc_FrameCurrent()->vJsonObjs ); Abc_FrameCurrent()->vJsonObjs = vObjs; }
+void        Abc_FrameSetSignalNames( Vec_Ptr_t * vNames )    { if ( Abc_FrameCurrent()->vSignalNames ) Vec_PtrFreeFree( Abc_FrameCurrent()->vSignalNames ); Abc_FrameCurrent()->vSignalNames = vNames; }
+void        Abc_FrameSetSpecName( char * pFileName )         { ABC_FREE( Abc_FrameCurrent()->pSpecName ); Abc_FrameCurrent()->pSpecName = pFileName; }
+
+int         Abc_FrameIsBatchMode()                           { return Abc_FrameCurrent() ? Abc_FrameCurrent()->fBatchMode : 0;              } 
+void        Abc_FrameSetBatchMode( int Mode )                { if ( Abc_FrameCurrent() ) Abc_FrameCurrent()->fBatchMode = Mode;             } 
+
+int         Abc_FrameIsBridgeMode()                          { return Abc_FrameCurrent() ? Abc_FrameCurrent()->fBridgeMode : 0;             } 
+void        Abc_FrameSetBridgeMode()                         { if ( Abc_FrameCurrent() ) Abc_FrameCurrent()->fBridgeMode = 1;               } 
+
+char *      Abc_FrameReadDrivingCell()                       { return Abc_FrameCurrent()->pDrivingCell;    }              
+float       Abc_FrameReadMaxLoad()                           { return Abc_FrameCurrent()->MaxLoad;         }      
+void        Abc_FrameSetDrivingCell( char * pName )          { ABC_FREE(Abc_FrameCurrent()->pDrivingCell); Abc_FrameCurrent()->pDrivingCell   = pName; }      
+void        Abc_FrameSetMaxLoad( float Load )                { Abc_FrameCurrent()->MaxLoad = Load;         }      
 
 int *       Abc_FrameReadArrayMapping( Abc_Frame_t * pAbc )  { return pAbc->pArray;                                            }
-void        Abc_FrameSetArrayMapping( int * p )              { ABC_FREE( s_GlobalFrame->pArray ); s_GlobalFrame->pArray = p;   }      
+void        Abc_FrameSetArrayMapping( int * p )              { ABC_FREE( Abc_FrameCurrent()->pArray ); Abc_FrameCurrent()->pArray = p;   }      
 
 int *       Abc_FrameReadBoxes( Abc_Frame_t * pAbc )         { return pAbc->pBoxes;                                            }
-void        Abc_FrameSetBoxes( int * p )                     { ABC_FREE( s_GlobalFrame->pBoxes ); s_GlobalFrame->pBoxes = p;   }      
+void        Abc_FrameSetBoxes( int * p )                     { ABC_FREE( Abc_FrameCurrent()->pBoxes ); Abc_FrameCurrent()->pBoxes = p;   }      
 
 /**Function*************************************************************
 
@@ -208,6 +215,8 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
 //    extern void Ivy_TruthManStop();
 //    Abc_HManStop();
 //    undefine_cube_size();
+    // process-wide packages are stopped only with the global frame
+    if ( p == s_GlobalFrame )
     Rwt_ManGlobalStop();
 //    Ivy_TruthManStop();
     if ( p->vAbcObjIds)  Vec_IntFree( p->vAbcObjIds );
@@ -244,10 +253,10 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     ABC_FREE( p->pCex2 );
     ABC_FREE( p->pCex );
     Vec_IntFreeP( &p->pAbcWlcInv );
-    Abc_NamDeref( s_GlobalFrame->pJsonStrs );
-    Vec_WecFreeP( &s_GlobalFrame->vJsonObjs );  
-    Ndr_Delete( s_GlobalFrame->pNdr );
-    ABC_FREE( s_GlobalFrame->pNdrArray );
+    Abc_NamDeref( p->pJsonStrs );
+    Vec_WecFreeP( &p->vJsonObjs );  
+    Ndr_Delete( p->pNdr );
+    ABC_FREE( p->pNdrArray );
 
     Gia_ManStopP( &p->pGiaMiniAig );
     Gia_ManStopP( &p->pGiaMiniLut );
@@ -257,8 +266,11 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     ABC_FREE( p->pBoxes );
     
 
+    if ( s_ThreadFrame == p )
+        s_ThreadFrame = NULL;
+    if ( s_GlobalFrame == p )
+        s_GlobalFrame = NULL;
     ABC_FREE( p );
-    s_GlobalFrame = NULL;
 }
 
 
@@ -341,6 +353,9 @@ Abc_Ntk_t * Abc_FrameReadNtk( Abc_Frame_t * p )
 ***********************************************************************/
 Gia_Man_t * Abc_FrameReadGia( Abc_Frame_t * p )
 {
+    // the callers outside of the command dispatcher expect the object array
+    if ( p->pGia && Gia_ManIsZipped(p->pGia) )
+        Gia_ManUnzip( p->pGia );
     return p->pGia;
 }
 
@@ -641,6 +656,8 @@ void Abc_FrameSetGlobalFrame( Abc_Frame_t * p )
 ***********************************************************************/
 Abc_Frame_t * Abc_FrameGetGlobalFrame()
 {
+    if ( s_ThreadFrame )
+        return s_ThreadFrame;
     if ( s_GlobalFrame == 0 )
     {
         // start the framework
@@ -664,7 +681,29 @@ Abc_Frame_t * Abc_FrameGetGlobalFrame()
 ***********************************************************************/
 Abc_Frame_t * Abc_FrameReadGlobalFrame()
 {
-    return s_GlobalFrame;
+    return Abc_FrameCurrent();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the private frame of the current thread.]
+
+  Description [While the private frame is set, all frame APIs called
+  from this thread (including Abc_FrameGetGlobalFrame) refer to it.
+  Setting it to NULL makes the thread use the global frame again.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameSetThreadFrame( Abc_Frame_t * p )
+{
+    s_ThreadFrame = p;
+}
+Abc_Frame_t * Abc_FrameReadThreadFrame()
+{
+    return s_ThreadFrame;
 }
 
 /**Function*************************************************************
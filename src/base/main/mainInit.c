@@ -20,6 +20,7 @@
 
 #include "base/abc/abc.h"
 #include "mainInt.h"
+#include "map/if/if.h"
 
 ABC_NAMESPACE_IMPL_START
  
@@ -67,6 +68,7 @@ extern void Glucose_Init( Abc_Frame_t *pAbc );
 extern void Glucose_End( Abc_Frame_t * pAbc );
 extern void Glucose2_Init( Abc_Frame_t *pAbc );
 extern void Glucose2_End( Abc_Frame_t * pAbc );
+extern void Cnf_ManFree();
 
 static Abc_FrameInitializer_t* s_InitializerStart = NULL;
 static Abc_FrameInitializer_t* s_InitializerEnd = NULL;
@@ -163,6 +165,84 @@ void Abc_FrameEnd( Abc_Frame_t * pAbc )
     Glucose_End( pAbc );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts a private frame for a worker thread.]
+
+  Description [The private frame has its own command tables, designs,
+  libraries, DSD managers and verification status. The thread using it 
+  should make it current by calling Abc_FrameSetThreadFrame(), which is 
+  done automatically by Cmd_CommandExecute(). The LUT library of the global
+  frame is copied into the private frame. The DAR rewriting library and 
+  the scratch buffers of the mapper and the DSD code are thread-local; 
+  each thread builds its own copies when they are first used.
+  The state shared by all frames is: the rewriting tables of the RWT
+  package (built once under a lock, read-only afterwards), the NPN cache
+  of the DAU package (one per process), the C library generator used 
+  through rand()/srand(), and the managers kept in file statics without
+  locking (giaMf.c, giaResub.c, ifDec16.c, extraUtilDsd.c, aigCanon.c,
+  cutPre22.c, abcAttach.c, abcExact.c, abcRec3.c, and the BDD-based
+  cascade synthesis). The commands using the latter should not be run 
+  in several frames at the same time. This list is limited to the state
+  known to be used by several threads; it does not imply that the other
+  code is thread-safe.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Frame_t * Abc_FramePrivateStart()
+{
+    Abc_Frame_t * pPrev = Abc_FrameReadThreadFrame();
+    Abc_Frame_t * pGlobal = Abc_FrameGetGlobalFrame();
+    Abc_Frame_t * pAbc = Abc_FrameAllocate();
+    Abc_FrameSetThreadFrame( pAbc );
+    Abc_FrameInit( pAbc );
+    Abc_FrameSetThreadFrame( pPrev );
+    if ( pGlobal->pLibLut )
+    {
+        If_LibLutFree( (If_LibLut_t *)pAbc->pLibLut );
+        pAbc->pLibLut = If_LibLutDup( (If_LibLut_t *)pGlobal->pLibLut );
+    }
+    pAbc->fBatchMode = 1;
+    return pAbc;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the private frame of a worker thread.]
+
+  Description [Releases the data owned by the frame without stopping
+  the process-wide packages (compare with Abc_FrameEnd).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FramePrivateStop( Abc_Frame_t * pAbc )
+{
+    Abc_Frame_t * pPrev = Abc_FrameReadThreadFrame();
+    Abc_FrameInitializer_t* p;
+    Abc_FrameSetThreadFrame( pAbc );
+    for( p = s_InitializerEnd ; p ; p = p->prev )
+        if ( p->destroy )
+            p->destroy(pAbc);
+    Cmd_End( pAbc );
+    Cnf_ManFree();
+    If_End( pAbc );
+    Map_End( pAbc );
+    Mio_End( pAbc );
+    Scl_End( pAbc );
+    Wlc_End( pAbc );
+    Bac_End( pAbc );
+    Cba_End( pAbc );
+    Pla_End( pAbc );
+    Abc_FrameDeallocate( pAbc );
+    Abc_FrameSetThreadFrame( pPrev == pAbc ? NULL : pPrev );
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
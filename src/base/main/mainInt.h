@@ -94,6 +94,7 @@ struct Abc_Frame_t_
     Vec_Ptr_t *     vStore;        // networks to be used by choice
     // decomposition package    
     void *          pManDec;       // decomposition manager
+    void *          pManCnf;       // CNF manager (see Cnf_ManRead)
     void *          pManDsd;       // decomposition manager
     void *          pManDsd2;      // decomposition manager
     // libraries for mapping
@@ -202,6 +203,8 @@ extern ABC_DLL void            Abc_FrameAddInitializer( Abc_FrameInitializer_t*
 /*=== mvFrame.c =====================================================*/
 extern ABC_DLL Abc_Frame_t *   Abc_FrameAllocate();
 extern ABC_DLL void            Abc_FrameDeallocate( Abc_Frame_t * p );
+/*=== mainDaemon.c ==================================================*/
+extern ABC_DLL int             Abc_DaemonStart( Abc_Frame_t * pAbc, const char * pSocket, int fVerbose );
 /*=== mvUtils.c =====================================================*/
 extern ABC_DLL char *          Abc_UtilsGetVersion( Abc_Frame_t * pAbc );
 extern ABC_DLL char *          Abc_UtilsGetUsersInput( Abc_Frame_t * pAbc );
@@ -89,6 +89,7 @@ int Abc_RealMain( int argc, char * argv[] )
     Vec_Str_t* sCommandUsr = Vec_StrAlloc(1000);
     char sCommandTmp[ABC_MAX_STR], sReadCmd[1000], sWriteCmd[1000];
     const char * sOutFile, * sInFile;
+    const char * sDaemon = NULL;
     char * sCommand;
     int  fStatus = 0;
     int c, fInitSource, fInitRead, fFinalWrite;
@@ -124,7 +125,7 @@ int Abc_RealMain( int argc, char * argv[] )
     sprintf( sWriteCmd, "write" );
 
     Extra_UtilGetoptReset();
-    while ((c = Extra_UtilGetopt(argc, argv, "dm:l:c:q:C:Q:S:hf:F:o:st:T:xb")) != EOF) {
+    while ((c = Extra_UtilGetopt(argc, argv, "dm:l:c:q:C:Q:S:hf:F:o:st:T:xbD:")) != EOF) {
         switch(c) {
 
             case 'd':                                          
@@ -271,6 +272,13 @@ int Abc_RealMain( int argc, char * argv[] )
                 Abc_FrameSetBridgeMode();
                 break;
 
+            case 'D':
+                sDaemon = globalUtilOptarg;
+                // keep the batch mode selected by other options (such as -q)
+                if ( fBatch == INTERACTIVE )
+                    fBatch = BATCH;
+                break;
+
             default:
                 goto usage;
         }
@@ -278,6 +286,13 @@ int Abc_RealMain( int argc, char * argv[] )
 
     Vec_StrPush(sCommandUsr, '\0');
 
+    // the daemon never returns to the interactive mode
+    if ( sDaemon && (fBatch == BATCH_THEN_INTERACTIVE || fBatch == BATCH_QUIET_THEN_INTERACTIVE || fBatch == BATCH_SMT) )
+    {
+        fprintf( pAbc->Err, "The daemon mode (-D) cannot be combined with -C, -Q, or -S.\n" );
+        goto usage;
+    }
+
     if ( fBatch == BATCH_SMT )
     {
         Wlc_StdinProcessSmt( pAbc, Vec_StrArray(sCommandUsr) );
@@ -335,6 +350,10 @@ int Abc_RealMain( int argc, char * argv[] )
             }
         }
 
+        // keep the initialized frame serving the jobs
+        if ( sDaemon && fStatus == 0 )
+            fStatus = Abc_DaemonStart( pAbc, sDaemon, 1 );
+
         if (fBatch == BATCH_THEN_INTERACTIVE || fBatch == BATCH_QUIET_THEN_INTERACTIVE){
             fBatch = INTERACTIVE;
             pAbc->fBatchMode = 0;
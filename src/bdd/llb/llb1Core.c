@@ -55,6 +55,7 @@ void Llb_ManSetDefaultParams( Gia_ParLlb_t * p )
     p->nVolumeMax    =      100;  // max volume
     p->nVolumeMin    =       30;  // min volume
     p->nPartValue    =        5;  // partitioning value
+    p->nProcs        =        1;  // image computation threads
     p->fBackward     =        0;  // forward by default
     p->fReorder      =        1;
     p->fIndConstr    =        0;
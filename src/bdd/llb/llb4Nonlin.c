@@ -44,6 +44,7 @@ struct Llb_Mnx_t_
     DdNode *        bNext;          // to states
     Vec_Ptr_t *     vRings;         // onion rings in ddR
     Vec_Ptr_t *     vRoots;         // BDDs for partitions
+    Llb_Par_t *     pPar;           // parallel image computation
 
     // structural info
     Vec_Int_t *     vOrder;         // for each object ID, its BDD variable number or -1
@@ -770,7 +771,10 @@ int Llb_Nonlin4Reachability( Llb_Mnx_t * p )
 
         // compute the next states
         clkTemp = Abc_Clock();
-        p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
+        if ( p->pPar )
+            p->bNext = Llb_Nonlin4ParImage( p->pPar, p->bCurrent );
+        else
+            p->bNext = Llb_Nonlin4Image( p->dd, p->vRoots, p->bCurrent, p->vVars2Q );
         if ( p->bNext == NULL )
         {
             if ( !p->pPars->fSilent )
@@ -973,6 +977,8 @@ Llb_Mnx_t * Llb_MnxStart( Aig_Man_t * pAig, Gia_ParLlb_t * pPars )
 
     if ( pPars->fReorder )
         Llb_Nonlin4Reorder( p->dd, 0, 1 );
+    if ( pPars->nProcs > 1 )
+        p->pPar = Llb_Nonlin4ParStart( p->dd, p->vRoots, p->vVars2Q, pPars->nProcs );
     return p;
 }
  
@@ -1001,6 +1007,7 @@ void Llb_MnxStop( Llb_Mnx_t * p )
         ABC_PRTP( "TOTAL    ", p->timeTotal, p->timeTotal );
         ABC_PRTP( "  reo    ", p->timeReo,   p->timeTotal );
     }
+    Llb_Nonlin4ParStop( p->pPar );
     // remove BDDs
     if ( p->bBad )
         Cudd_RecursiveDeref( p->dd, p->bBad );
@@ -0,0 +1,398 @@
+/**CFile****************************************************************
+
+  FileName    [llb4Par.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [BDD based reachability.]
+
+  Synopsis    [Partitioned image computation using several threads.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: llb4Par.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "llbInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define LLB_PAR_THR_MAX   64         // the largest number of threads
+
+typedef struct Llb_ParTh_t_ Llb_ParTh_t;
+struct Llb_ParTh_t_
+{
+    DdManager *     dd;              // the BDD manager of this thread
+    Vec_Ptr_t *     vParts;          // the partitions of the transition relation
+    Vec_Int_t *     vVars2Q;         // 1 if variable is quantifiable; 0 othervise
+    Vec_Ptr_t *     vStates;         // the pieces of the state set given to this thread
+    DdNode *        bImage;          // the partial image
+    Llb_ParTh_t *   pSrc;            // the thread whose image is added to this one
+    abctime         nTimeLeft;       // the runtime left (0 = no limit)
+    int             fFailed;         // the computation has timed out
+};
+
+struct Llb_Par_t_
+{
+    DdManager *     dd;              // the main BDD manager
+    int             nProcs;          // the number of threads
+    int             nReorders;       // the number of reorderings of dd when the order was copied
+    int *           pPerm;           // the variable order of dd
+    Llb_ParTh_t     Th[LLB_PAR_THR_MAX];
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the variable order of the main manager.]
+
+  Description [The worker managers do not use dynamic reordering
+  because the CUDD reordering code keeps its state in static variables.
+  Instead, they follow the order found in the main manager.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParSyncOrder( Llb_Par_t * p )
+{
+    int i;
+    if ( p->nReorders == Cudd_ReadReorderings(p->dd) )
+        return;
+    p->nReorders = Cudd_ReadReorderings(p->dd);
+    for ( i = 0; i < Cudd_ReadSize(p->dd); i++ )
+        p->pPerm[i] = Cudd_ReadInvPerm( p->dd, i );
+    for ( i = 0; i < p->nProcs; i++ )
+        Cudd_ShuffleHeap( p->Th[i].dd, p->pPerm );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the parallel image computation.]
+
+  Description [Each thread gets its own BDD manager with a copy
+  of the partitions. Returns NULL when threads are not available.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Llb_Par_t * Llb_Nonlin4ParStart( DdManager * dd, Vec_Ptr_t * vParts, Vec_Int_t * vVars2Q, int nProcs )
+{
+#ifdef ABC_USE_PTHREADS
+    Llb_Par_t * p;
+    DdNode * bFunc, * bTemp;
+    int i, k;
+    if ( nProcs < 2 )
+        return NULL;
+    p = ABC_CALLOC( Llb_Par_t, 1 );
+    p->dd        = dd;
+    p->nProcs    = Abc_MinInt( nProcs, LLB_PAR_THR_MAX );
+    p->nReorders = -1;
+    p->pPerm     = ABC_ALLOC( int, Cudd_ReadSize(dd) );
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        p->Th[i].dd      = Cudd_Init( Cudd_ReadSize(dd), 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        p->Th[i].vVars2Q = vVars2Q;
+        p->Th[i].vStates = Vec_PtrAlloc( 4 );
+    }
+    Llb_Nonlin4ParSyncOrder( p );
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        p->Th[i].vParts = Vec_PtrAlloc( Vec_PtrSize(vParts) );
+        Vec_PtrForEachEntry( DdNode *, vParts, bFunc, k )
+        {
+            bTemp = Cudd_bddTransfer( dd, p->Th[i].dd, bFunc );  Cudd_Ref( bTemp );
+            Vec_PtrPush( p->Th[i].vParts, bTemp );
+        }
+    }
+    return p;
+#else
+    return NULL;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the parallel image computation.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParStop( Llb_Par_t * p )
+{
+    int i;
+    if ( p == NULL )
+        return;
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        Llb_Nonlin4Deref( p->Th[i].dd, p->Th[i].vParts );
+        Vec_PtrFree( p->Th[i].vStates );
+        Extra_StopManager( p->Th[i].dd );
+    }
+    ABC_FREE( p->pPerm );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image of the state pieces of one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParImageOne( Llb_ParTh_t * pTh )
+{
+    DdNode * bState, * bNext, * bTemp;
+    int i;
+    pTh->dd->TimeStop = pTh->nTimeLeft ? Abc_Clock() + pTh->nTimeLeft : 0;
+    pTh->bImage = Cudd_ReadLogicZero( pTh->dd );  Cudd_Ref( pTh->bImage );
+    Vec_PtrForEachEntry( DdNode *, pTh->vStates, bState, i )
+    {
+        bNext = pTh->fFailed ? NULL : Llb_Nonlin4Image( pTh->dd, pTh->vParts, bState, pTh->vVars2Q );
+        if ( bNext == NULL )
+            pTh->fFailed = 1;
+        else
+        {
+            Cudd_Ref( bNext );
+            pTh->bImage = Cudd_bddOr( pTh->dd, bTemp = pTh->bImage, bNext );
+            if ( pTh->bImage == NULL )
+                pTh->fFailed = 1, pTh->bImage = bTemp;
+            else
+            {
+                Cudd_Ref( pTh->bImage );
+                Cudd_RecursiveDeref( pTh->dd, bTemp );
+            }
+            Cudd_RecursiveDeref( pTh->dd, bNext );
+        }
+        Cudd_RecursiveDeref( pTh->dd, bState );
+    }
+    Vec_PtrClear( pTh->vStates );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the partial image of another thread.]
+
+  Description [The other thread's manager is idle and is only read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ParReduceOne( Llb_ParTh_t * pTh )
+{
+    Llb_ParTh_t * pSrc = pTh->pSrc;
+    DdNode * bPart, * bTemp;
+    pTh->dd->TimeStop = pTh->nTimeLeft ? Abc_Clock() + pTh->nTimeLeft : 0;
+    pSrc->dd->TimeStop = 0;
+    bPart = (pTh->fFailed || pSrc->fFailed) ? NULL : Cudd_bddTransfer( pSrc->dd, pTh->dd, pSrc->bImage );
+    if ( bPart == NULL )
+        pTh->fFailed = 1;
+    else
+    {
+        Cudd_Ref( bPart );
+        pTh->bImage = Cudd_bddOr( pTh->dd, bTemp = pTh->bImage, bPart );
+        if ( pTh->bImage == NULL )
+            pTh->fFailed = 1, pTh->bImage = bTemp;
+        else
+        {
+            Cudd_Ref( pTh->bImage );
+            Cudd_RecursiveDeref( pTh->dd, bTemp );
+        }
+        Cudd_RecursiveDeref( pTh->dd, bPart );
+    }
+    Cudd_RecursiveDeref( pSrc->dd, pSrc->bImage );
+    pSrc->bImage = NULL;
+}
+
+#ifdef ABC_USE_PTHREADS
+void * Llb_Nonlin4ParImageThread( void * pArg )
+{
+    Llb_ParTh_t * pTh = (Llb_ParTh_t *)pArg;
+    if ( pTh->pSrc )
+        Llb_Nonlin4ParReduceOne( pTh );
+    else
+        Llb_Nonlin4ParImageOne( pTh );
+    return NULL;
+}
+void Llb_Nonlin4ParRun( Llb_ParTh_t ** ppThs, int nThs )
+{
+    pthread_t WorkerThread[LLB_PAR_THR_MAX];
+    int i, status;
+    for ( i = 1; i < nThs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Llb_Nonlin4ParImageThread, (void *)ppThs[i] );  assert( status == 0 );
+    }
+    Llb_Nonlin4ParImageThread( ppThs[0] );
+    for ( i = 1; i < nThs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image using several threads.]
+
+  Description [The state set is split into disjoint cubes over its top
+  variables. The images of the pieces are computed by the threads
+  in their own managers and then combined in a reduction tree, in which
+  each round ORs pairs of partial images. Returns the image in the main
+  manager (not referenced) or NULL if the time limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_Nonlin4ParImage( Llb_Par_t * p, DdNode * bCurrent )
+{
+#ifdef ABC_USE_PTHREADS
+    Llb_ParTh_t * ppThs[LLB_PAR_THR_MAX];
+    DdManager * dd = p->dd;
+    DdNode * bCube, * bPiece, * bTemp, * bRes = NULL;
+    int pVars[32], * pSupp, nSupp, nSplit, nPieces = 0, nThs, i, k, s, fFailed = 0;
+    abctime nTimeLeft = dd->TimeStop ? dd->TimeStop - Abc_Clock() : 0;
+    if ( dd->TimeStop && nTimeLeft <= 0 )
+        return NULL;
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        p->Th[i].dd->TimeStop = 0;
+        p->Th[i].nTimeLeft = nTimeLeft;
+        p->Th[i].fFailed   = 0;
+        p->Th[i].pSrc      = NULL;
+        p->Th[i].bImage    = NULL;
+    }
+    Llb_Nonlin4ParSyncOrder( p );
+    // select the splitting variables among the top variables of the state set
+    pSupp = Cudd_SupportIndex( dd, bCurrent );
+    for ( i = nSupp = 0; i < Cudd_ReadSize(dd); i++ )
+        nSupp += pSupp[i];
+    for ( nSplit = 0; (1 << nSplit) < p->nProcs && nSplit < nSupp; nSplit++ );
+    for ( i = k = 0; i < Cudd_ReadSize(dd) && k < nSplit; i++ )
+        if ( pSupp[Cudd_ReadInvPerm(dd, i)] )
+            pVars[k++] = Cudd_ReadInvPerm(dd, i);
+    ABC_FREE( pSupp );
+    assert( k == nSplit );
+    // transfer the pieces into the threads' managers
+    for ( i = 0; i < (1 << nSplit) && !fFailed; i++ )
+    {
+        bCube = Cudd_ReadOne( dd );  Cudd_Ref( bCube );
+        for ( k = 0; k < nSplit; k++ )
+        {
+            bCube = Cudd_bddAnd( dd, bTemp = bCube, Cudd_NotCond(Cudd_bddIthVar(dd, pVars[k]), !((i >> k) & 1)) );  Cudd_Ref( bCube );
+            Cudd_RecursiveDeref( dd, bTemp );
+        }
+        bPiece = Cudd_bddAnd( dd, bCurrent, bCube );
+        if ( bPiece == NULL )
+            fFailed = 1;
+        else if ( bPiece != Cudd_ReadLogicZero(dd) )
+        {
+            Cudd_Ref( bPiece );
+            bTemp = Cudd_bddTransfer( dd, p->Th[nPieces % p->nProcs].dd, bPiece );
+            if ( bTemp == NULL )
+                fFailed = 1;
+            else
+            {
+                Cudd_Ref( bTemp );
+                Vec_PtrPush( p->Th[nPieces++ % p->nProcs].vStates, bTemp );
+            }
+            Cudd_RecursiveDeref( dd, bPiece );
+        }
+        Cudd_RecursiveDeref( dd, bCube );
+    }
+    // compute the partial images
+    nThs = Abc_MinInt( nPieces, p->nProcs );
+    for ( i = 0; i < nThs; i++ )
+        ppThs[i] = p->Th + i;
+    if ( !fFailed )
+        Llb_Nonlin4ParRun( ppThs, nThs );
+    for ( i = 0; i < nThs; i++ )
+        fFailed |= p->Th[i].fFailed;
+    // combine the partial images
+    for ( s = 1; !fFailed && s < nThs; s <<= 1 )
+    {
+        for ( i = k = 0; i + s < nThs; i += 2 * s, k++ )
+        {
+            ppThs[k] = p->Th + i;
+            ppThs[k]->pSrc = p->Th + i + s;
+        }
+        Llb_Nonlin4ParRun( ppThs, k );
+        for ( i = 0; i < k; i++ )
+            ppThs[i]->pSrc = NULL;
+    }
+    // transfer the result into the main manager
+    for ( i = 0; i < nThs; i++ )
+        fFailed |= p->Th[i].fFailed;
+    if ( !fFailed && nThs > 0 )
+    {
+        p->Th[0].dd->TimeStop = 0;
+        bRes = Cudd_bddTransfer( p->Th[0].dd, dd, p->Th[0].bImage );
+        if ( bRes )
+            Cudd_Ref( bRes );
+    }
+    else if ( !fFailed )
+    {
+        bRes = Cudd_ReadLogicZero( dd );  Cudd_Ref( bRes );
+    }
+    // cleanup
+    for ( i = 0; i < p->nProcs; i++ )
+    {
+        Vec_PtrForEachEntry( DdNode *, p->Th[i].vStates, bTemp, k )
+            Cudd_RecursiveDeref( p->Th[i].dd, bTemp );
+        Vec_PtrClear( p->Th[i].vStates );
+        if ( p->Th[i].bImage )
+            Cudd_RecursiveDeref( p->Th[i].dd, p->Th[i].bImage );
+        p->Th[i].bImage = NULL;
+        p->Th[i].dd->TimeStop = 0;
+    }
+    if ( bRes )
+        Cudd_Deref( bRes );
+    return bRes;
+#else
+    assert( 0 );
+    return NULL;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -112,6 +112,7 @@ struct If_Par_t_
     int                nStructType;   // type of the structure
     int                nAndDelay;     // delay of AND-gate in LUT library units
     int                nAndArea;      // area of AND-gate in LUT library units
+    int                nProcs;        // the number of threads used for cut enumeration
     int                fPreprocess;   // preprossing
     int                fArea;         // area-oriented mapping
     int                fFancy;        // a fancy feature
@@ -243,14 +244,15 @@ struct If_Man_t_
     If_Set_t *         pMemCi;        // memory for CI cutsets
     If_Set_t *         pMemAnd;       // memory for AND cutsets
     If_Set_t *         pFreeList;     // the list of free cutsets
+    Vec_Ptr_t *        vMemSetsExtra; // additional memory for AND cutsets
     int                nSmallSupp;    // the small support
     int                nCutsTotal;
     int                nCutsUseless[32];
     int                nCutsCount[32];
-    int                nCutsCountAll;
-    int                nCutsUselessAll;
     int                nCuts5, nCuts5a;
     If_DsdMan_t *      pIfDsdMan;     // DSD manager
+    void *             pTtMutex;      // serializes updates of truth tables by several threads
+    int                nTtDsdsDone;   // the number of truth tables with known DSDs
     Vec_Mem_t *        vTtMem[IF_MAX_FUNC_LUTSIZE+1];   // truth table memory and hash table
     Vec_Wec_t *        vTtIsops[IF_MAX_FUNC_LUTSIZE+1]; // mapping of truth table into DSD
     Vec_Int_t *        vTtDsds[IF_MAX_FUNC_LUTSIZE+1];  // mapping of truth table into DSD
@@ -574,6 +576,8 @@ extern void            If_DsdManCleanMarks( If_DsdMan_t * p, int fVerbose );
 extern void            If_DsdManInvertMarks( If_DsdMan_t * p, int fVerbose );
 extern If_DsdMan_t *   If_DsdManFilter( If_DsdMan_t * p, int Limit );
 extern int             If_DsdManCompute( If_DsdMan_t * p, word * pTruth, int nLeaves, unsigned char * pPerm, char * pLutStruct );
+extern void            If_DsdManSetConcurrent( If_DsdMan_t * p, int fConcurrent );
+extern void            If_DsdManReserve( If_DsdMan_t * p, int nObjs );
 extern char *          If_DsdManFileName( If_DsdMan_t * p );
 extern int             If_DsdManVarNum( If_DsdMan_t * p );
 extern int             If_DsdManObjNum( If_DsdMan_t * p );
@@ -630,11 +634,14 @@ extern If_Set_t *      If_ManSetupNodeCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManDerefNodeCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManDerefChoiceCutSet( If_Man_t * p, If_Obj_t * pObj );
 extern void            If_ManSetupSetAll( If_Man_t * p, int nCrossCut );
+extern void            If_ManSetupSetExtra( If_Man_t * p, int nCutSets );
 /*=== ifMap.c =============================================================*/
 extern int *           If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut );
 extern void            If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst );
 extern void            If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess );
 extern int             If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPreprocess, int fFirst, char * pLabel );
+extern void            If_ManTtLock( If_Man_t * p );
+extern void            If_ManTtUnlock( If_Man_t * p );
 /*=== ifReduce.c ==========================================================*/
 extern void            If_ManImproveMapping( If_Man_t * p );
 /*=== ifSat.c ==========================================================*/
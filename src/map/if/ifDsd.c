@@ -25,6 +25,14 @@
 #include "sat/bsat/satSolver.h"
 #include "aig/gia/gia.h"
 #include "bool/kit/kit.h"
+#include "misc/util/utilPth.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -108,8 +116,17 @@ struct If_DsdMan_t_
     abctime        timeCheck;      // statistics
     abctime        timeCheck2;     // statistics
     abctime        timeVerify;     // statistics
+    char *         pMap;           // contents of the loaded file
+    int            nMapSize;       // the size of the loaded file
+    int            fMapped;        // the file is memory-mapped
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t * pMutex;      // serializes the access when shared by several threads
+#endif
 };
 
+// the number of functions, for which the DSD failed verification (in all managers)
+static volatile int         s_nDsdVerifyFails = 0;
+
 static inline int           If_DsdObjWordNum( int nFans )                                    { return sizeof(If_DsdObj_t) / 8 + nFans / 2 + ((nFans & 1) > 0);              }
 static inline int           If_DsdObjTruthId( If_DsdMan_t * p, If_DsdObj_t * pObj )          { return (pObj->Type == IF_DSD_PRIME && pObj->nFans > 2) ? Vec_IntEntry(&p->vTruths, pObj->Id) : -1;     }
 static inline word *        If_DsdObjTruth( If_DsdMan_t * p, If_DsdObj_t * pObj )            { return Vec_MemReadEntry(p->vTtMem[pObj->nFans], If_DsdObjTruthId(p, pObj));  }
@@ -136,6 +153,14 @@ static inline int           If_DsdVecObjMark( Vec_Ptr_t * p, int iObj )
 static inline void          If_DsdVecObjSetMark( Vec_Ptr_t * p, int iObj )             { If_DsdVecObj( p, iObj )->fMark = 1;                                                }
 static inline void          If_DsdVecObjClearMark( Vec_Ptr_t * p, int iObj )           { If_DsdVecObj( p, iObj )->fMark = 0;                                                }
 
+#ifdef ABC_USE_PTHREADS
+static inline void          If_DsdManLock( If_DsdMan_t * p )                           { if ( p->pMutex ) pthread_mutex_lock( p->pMutex );                                  }
+static inline void          If_DsdManUnlock( If_DsdMan_t * p )                         { if ( p->pMutex ) pthread_mutex_unlock( p->pMutex );                                }
+#else
+static inline void          If_DsdManLock( If_DsdMan_t * p )                           {                                                                                    }
+static inline void          If_DsdManUnlock( If_DsdMan_t * p )                         {                                                                                    }
+#endif
+
 #define If_DsdVecForEachObj( vVec, pObj, i )                \
     Vec_PtrForEachEntry( If_DsdObj_t *, vVec, pObj, i )
 #define If_DsdVecForEachObjStart( vVec, pObj, i, Start )    \
@@ -150,6 +175,7 @@ static inline void          If_DsdVecObjClearMark( Vec_Ptr_t * p, int iObj )
     for ( i = 0; (i < If_DsdObjFaninNum(pObj)) && ((iLit) = If_DsdObjFaninLit(pObj, i)); i++ )
 
 extern int Kit_TruthToGia( Gia_Man_t * pMan, unsigned * pTruth, int nVars, Vec_Int_t * vMemory, Vec_Int_t * vLeaves, int fHash );
+static void If_DsdManUnmapFile( If_DsdMan_t * p );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -221,6 +247,54 @@ char * If_DsdManGetCellStr( If_DsdMan_t * p )
     return p->pCellStr;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the DSD manager to be shared by several threads.]
+
+  Description [When the concurrent mode is on, computing DSDs of new
+  functions is serialized by a mutex. The attributes of the existing
+  nodes are read without locking, which requires the object array to be
+  reserved (If_DsdManReserve) for the nodes added in the meantime.
+  The same manager can then be used by the worker threads of the mapper.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_DsdManSetConcurrent( If_DsdMan_t * p, int fConcurrent )
+{
+#ifdef ABC_USE_PTHREADS
+    if ( fConcurrent && p->pMutex == NULL )
+    {
+        p->pMutex = ABC_ALLOC( pthread_mutex_t, 1 );
+        pthread_mutex_init( p->pMutex, NULL );
+    }
+    else if ( !fConcurrent && p->pMutex != NULL )
+    {
+        pthread_mutex_destroy( p->pMutex );
+        ABC_FREE( p->pMutex );
+    }
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reserves the object array for nObjs new nodes.]
+
+  Description [Until this number of nodes is added, the object array is
+  not reallocated, so the nodes can be read while others are added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_DsdManReserve( If_DsdMan_t * p, int nObjs )
+{
+    Vec_PtrGrow( &p->vObjs, Vec_PtrSize(&p->vObjs) + nObjs );
+}
+
 /**Function*************************************************************
 
   Synopsis    [DSD manager.]
@@ -234,7 +308,7 @@ char * If_DsdManGetCellStr( If_DsdMan_t * p )
 ***********************************************************************/
 static inline word ** If_ManDsdTtElems()
 {
-    static word TtElems[DAU_MAX_VAR+1][DAU_MAX_WORD], * pTtElems[DAU_MAX_VAR+1] = {NULL};
+    static ABC_THREAD_LOCAL word TtElems[DAU_MAX_VAR+1][DAU_MAX_WORD], * pTtElems[DAU_MAX_VAR+1] = {NULL};
     if ( pTtElems[0] == NULL )
     {
         int v;
@@ -365,6 +439,8 @@ void If_DsdManFree( If_DsdMan_t * p, int fVerbose )
     Gia_ManStopP( &p->pTtGia );
     Vec_IntFreeP( &p->vCover );
     If_ManSatUnbuild( p->pSat );
+    If_DsdManSetConcurrent( p, 0 );
+    If_DsdManUnmapFile( p );
     ABC_FREE( p->pCellStr );
     ABC_FREE( p->pStore );
     ABC_FREE( p->pBins );
@@ -1035,6 +1111,93 @@ int If_DsdObjFindOrAdd( If_DsdMan_t * p, int Type, int * pLits, int nLits, word
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Maps the DSD manager file into memory.]
+
+  Description [The pages are mapped privately and writable, so that the
+  nodes can be used in place and their marks and counters updated without
+  touching the file. Falls back to reading the file if mapping is not 
+  available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * If_DsdManMapFile( char * pFileName, int * pnMapSize, int * pfMapped )
+{
+    char * pContents;
+    FILE * pFile;
+    int nFileSize;
+#ifndef _WIN32
+    struct stat Stat;
+    int Fd = open( pFileName, O_RDONLY );
+    if ( Fd == -1 )
+        return NULL;
+    if ( fstat( Fd, &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size >= 16 && Stat.st_size <= 0x7FFFFFF8 )
+    {
+        pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, Fd, 0 );
+        if ( pContents != (char *)MAP_FAILED )
+        {
+            close( Fd );
+            *pnMapSize = (int)Stat.st_size;
+            *pfMapped = 1;
+            return pContents;
+        }
+    }
+    close( Fd );
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = (int)ftell( pFile );
+    rewind( pFile );
+    if ( nFileSize < 16 )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    pContents = ABC_ALLOC( char, nFileSize );
+    *pnMapSize = (int)fread( pContents, 1, (size_t)nFileSize, pFile );
+    *pfMapped = 0;
+    fclose( pFile );
+    return pContents;
+}
+static void If_DsdManUnmapData( char * pMap, int nMapSize, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+        munmap( pMap, (size_t)nMapSize );
+    else
+#endif
+        ABC_FREE( pMap );
+}
+static void If_DsdManUnmapFile( If_DsdMan_t * p )
+{
+    if ( p->pMap == NULL )
+        return;
+    If_DsdManUnmapData( p->pMap, p->nMapSize, p->fMapped );
+    p->pMap = NULL;
+}
+static inline char * If_DsdManLoadData( char ** ppCur, char * pEnd, int nBytes )
+{
+    char * pData = *ppCur;
+    if ( nBytes < 0 || nBytes > pEnd - pData )
+        return NULL;
+    *ppCur += nBytes;
+    return pData;
+}
+static inline int If_DsdManLoadInt( char ** ppCur, char * pEnd, int * pNum )
+{
+    char * pData = If_DsdManLoadData( ppCur, pEnd, 4 );
+    if ( pData == NULL )
+        return 0;
+    memcpy( pNum, pData, 4 );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Saving/loading DSD manager.]
@@ -1108,31 +1271,39 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
     If_DsdMan_t * p;
     If_DsdObj_t * pObj; 
     Vec_Int_t * vSets;
-    char pBuffer[10];
     unsigned * pSpot;
     word * pTruth;
-    int i, v, Num, Num2, RetValue;
-    FILE * pFile = fopen( pFileName, "rb" );
-    if ( pFile == NULL )
+    char * pMap, * pCur, * pEnd, * pData;
+    int i, k, v, Num, Num2, nMapSize, fMapped;
+    pMap = If_DsdManMapFile( pFileName, &nMapSize, &fMapped );
+    if ( pMap == NULL )
     {
         printf( "Reading DSD manager file \"%s\" has failed.\n", pFileName );
         return NULL;
     }
-    RetValue = fread( pBuffer, 4, 1, pFile );
-    if ( strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
+    pCur = pMap;
+    pEnd = pMap + nMapSize;
+    pData = If_DsdManLoadData( &pCur, pEnd, 4 );
+    if ( pData == NULL || strncmp(pData, DSD_VERSION, strlen(DSD_VERSION)) || !If_DsdManLoadInt(&pCur, pEnd, &Num) || Num < 0 || Num > DAU_MAX_VAR )
     {
         printf( "Unrecognized format of file \"%s\".\n", pFileName );
+        If_DsdManUnmapData( pMap, nMapSize, fMapped );
         return NULL;
     }
-    RetValue = fread( &Num, 4, 1, pFile );
     p = If_DsdManAlloc( Num, 0 );
     ABC_FREE( p->pStore );
-    p->pStore = Abc_UtilStrsav( pFileName );
-    RetValue = fread( &Num, 4, 1, pFile );
+    p->pStore   = Abc_UtilStrsav( pFileName );
+    // the nodes are used in place, so the file contents is kept until the manager is freed
+    p->pMap     = pMap;
+    p->nMapSize = nMapSize;
+    p->fMapped  = fMapped;
+    if ( !If_DsdManLoadInt(&pCur, pEnd, &Num) || Num < 0 || Num > DAU_MAX_VAR )
+        goto finish;
     p->LutSize = Num;
     p->pSat  = If_ManSatBuildXY( p->LutSize );
-    RetValue = fread( &Num, 4, 1, pFile );
-    assert( Num >= 2 );
+    // each node takes at least one word, which bounds the node count
+    if ( !If_DsdManLoadInt(&pCur, pEnd, &Num) || Num < 2 || Num - 2 > (pEnd - pCur) / (int)sizeof(word) )
+        goto finish;
     Vec_PtrFillExtra( &p->vObjs, Num, NULL );
     Vec_IntFill( &p->vNexts, Num, 0 );
     Vec_IntFill( &p->vTruths, Num, -1 );
@@ -1141,17 +1312,27 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
     memset( p->pBins, 0, sizeof(unsigned) * p->nBins );
     for ( i = 2; i < Vec_PtrSize(&p->vObjs); i++ )
     {
-        RetValue = fread( &Num, 4, 1, pFile );
-        pObj = (If_DsdObj_t *)Mem_FlexEntryFetch( p->pMem, sizeof(word) * Num );
-        RetValue = fread( pObj, sizeof(word)*Num, 1, pFile );
+        // the header is checked before the fanins are read
+        if ( !If_DsdManLoadInt(&pCur, pEnd, &Num) || Num < (int)(sizeof(If_DsdObj_t) / 8) || Num > If_DsdObjWordNum(DAU_MAX_VAR) )
+            goto finish;
+        pObj = (If_DsdObj_t *)If_DsdManLoadData( &pCur, pEnd, sizeof(word) * Num );
+        if ( pObj == NULL || Num != If_DsdObjWordNum(pObj->nFans) || (int)pObj->Id != i )
+            goto finish;
+        if ( pObj->Type < IF_DSD_AND || pObj->Type > IF_DSD_PRIME || (int)pObj->nFans > p->nVars || (int)pObj->nSupp > p->nVars )
+            goto finish;
+        for ( k = 0; k < (int)pObj->nFans; k++ )
+            if ( pObj->pFans[k] >= (unsigned)Abc_Var2Lit(i, 0) )
+                goto finish;
         Vec_PtrWriteEntry( &p->vObjs, i, pObj );
         if ( pObj->Type == IF_DSD_PRIME )
         {
-            RetValue = fread( &Num, 4, 1, pFile );
+            if ( !If_DsdManLoadInt(&pCur, pEnd, &Num) || Num < -1 )
+                goto finish;
             Vec_IntWriteEntry( &p->vTruths, i, Num );
         }
         pSpot = If_DsdObjHashLookup( p, pObj->Type, (int *)pObj->pFans, pObj->nFans, If_DsdObjTruthId(p, pObj) );
-        assert( *pSpot == 0 );
+        if ( *pSpot != 0 ) // duplicated node
+            goto finish;
         *pSpot = pObj->Id;
     }
     assert( p->nUniqueMisses == Vec_PtrSize(&p->vObjs) - 2 );
@@ -1160,43 +1341,62 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
     for ( v = 3; v <= p->nVars; v++ )
     {
         int nBytes = sizeof(word)*Vec_MemEntrySize(p->vTtMem[v]);
-        RetValue = fread( &Num, 4, 1, pFile );
+        if ( !If_DsdManLoadInt(&pCur, pEnd, &Num) || Num < 0 )
+            break;
         for ( i = 0; i < Num; i++ )
         {
-            RetValue = fread( pTruth, nBytes, 1, pFile );
+            if ( (pData = If_DsdManLoadData(&pCur, pEnd, nBytes)) == NULL )
+                break;
+            memcpy( pTruth, pData, (size_t)nBytes );
             Vec_MemHashInsert( p->vTtMem[v], pTruth );
         }
-        assert( Num == Vec_MemEntryNum(p->vTtMem[v]) );
-        RetValue = fread( &Num2, 4, 1, pFile );
+        // the truth tables are unique and each has its decompositions
+        if ( i < Num || Num != Vec_MemEntryNum(p->vTtMem[v]) )
+            break;
+        if ( !If_DsdManLoadInt(&pCur, pEnd, &Num2) || Num2 != Num )
+            break;
         for ( i = 0; i < Num2; i++ )
         {
-            RetValue = fread( &Num, 4, 1, pFile );
+            if ( !If_DsdManLoadInt(&pCur, pEnd, &Num) || Num < 0 || Num > (pEnd - pCur) / (int)sizeof(int) )
+                break;
+            if ( (pData = If_DsdManLoadData(&pCur, pEnd, sizeof(int) * Num)) == NULL )
+                break;
             vSets = Vec_IntAlloc( Num );
-            RetValue = fread( Vec_IntArray(vSets), sizeof(int)*Num, 1, pFile );
+            memcpy( Vec_IntArray(vSets), pData, sizeof(int) * Num );
             vSets->nSize = Num;
             Vec_PtrPush( p->vTtDecs[v], vSets );
         }
+        if ( i < Num2 )
+            break;
         assert( Num2 == Vec_PtrSize(p->vTtDecs[v]) ); 
     }
     ABC_FREE( pTruth );
-    RetValue = fread( &Num, 4, 1, pFile );
-    p->nConfigWords = Num;
-    RetValue = fread( &Num, 4, 1, pFile );
-    p->nTtBits = Num;
-    RetValue = fread( &Num, 4, 1, pFile );
-    if ( RetValue && Num )
+    if ( v <= p->nVars )
+        goto finish;
+    // the truth tables of prime nodes should be among those loaded
+    If_DsdVecForEachObj( &p->vObjs, pObj, i )
+        if ( pObj->Type == IF_DSD_PRIME && pObj->nFans > 2 && (If_DsdObjTruthId(p, pObj) < 0 || If_DsdObjTruthId(p, pObj) >= Vec_MemEntryNum(p->vTtMem[pObj->nFans])) )
+            goto finish;
+    // the remaining fields are optional
+    if ( If_DsdManLoadInt(&pCur, pEnd, &Num) )
+        p->nConfigWords = Num;
+    if ( If_DsdManLoadInt(&pCur, pEnd, &Num) )
+        p->nTtBits = Num;
+    if ( If_DsdManLoadInt(&pCur, pEnd, &Num) && Num > 0 && Num <= (pEnd - pCur) / (int)sizeof(word) && (pData = If_DsdManLoadData(&pCur, pEnd, sizeof(word) * Num)) != NULL )
     {
         p->vConfigs = Vec_WrdStart( Num );
-        RetValue = fread( Vec_WrdArray(p->vConfigs), sizeof(word)*Num, 1, pFile );
+        memcpy( Vec_WrdArray(p->vConfigs), pData, sizeof(word) * Num );
     }
-    RetValue = fread( &Num, 4, 1, pFile );
-    if ( RetValue && Num )
+    if ( If_DsdManLoadInt(&pCur, pEnd, &Num) && Num > 0 && (pData = If_DsdManLoadData(&pCur, pEnd, Num)) != NULL )
     {
         p->pCellStr = ABC_CALLOC( char, Num + 1 );
-        RetValue = fread( p->pCellStr, sizeof(char)*Num, 1, pFile );
+        memcpy( p->pCellStr, pData, (size_t)Num );
     }
-    fclose( pFile );
     return p;
+finish:
+    printf( "File \"%s\" is truncated or corrupted.\n", pFileName );
+    If_DsdManFree( p, 0 );
+    return NULL;
 }
 void If_DsdManMerge( If_DsdMan_t * p, If_DsdMan_t * pNew )
 {
@@ -2053,7 +2253,10 @@ unsigned If_DsdManCheckXYZ( If_DsdMan_t * p, int iDsd, int LutSize, int fDerive,
 
   Synopsis    [Add the function to the DSD manager.]
 
-  Description []
+  Description [Can be called by several threads if the manager is in
+  the concurrent mode (see If_DsdManSetConcurrent). Returns -1 if the
+  DSD computed for the function fails verification; in this case, the
+  result should not be used or cached by the caller.]
                
   SideEffects []
 
@@ -2068,6 +2271,7 @@ int If_DsdManCompute( If_DsdMan_t * p, word * pTruth, int nLeaves, unsigned char
     int nWords = Abc_TtWordNum(nLeaves);
 //    abctime clk = 0;
     assert( nLeaves <= DAU_MAX_VAR );
+    If_DsdManLock( p );
     Abc_TtCopy( pCopy, pTruth, nWords, 0 );
 //clk = Abc_Clock();
     nSizeNonDec = Dau_DsdDecompose( pCopy, nLeaves, 0, 1, pDsd );
@@ -2093,12 +2297,32 @@ int If_DsdManCompute( If_DsdMan_t * p, word * pTruth, int nLeaves, unsigned char
         Dau_DsdPrintFromTruth( pRes, nLeaves );
         If_DsdManPrintOne( stdout, p, Abc_Lit2Var(iDsd), pPerm, 1 );
         printf( "\n" );
+        ABC_FETCH_ADD( &s_nDsdVerifyFails, 1 );
+        If_DsdManUnlock( p );
+        return -1;
     }
     If_DsdVecObjIncRef( &p->vObjs, Abc_Lit2Var(iDsd) );
     assert( If_DsdVecLitSuppSize(&p->vObjs, iDsd) == nLeaves );
+    If_DsdManUnlock( p );
     return iDsd;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of DSDs that failed verification.]
+
+  Description [The counter is shared by all DSD managers of the process.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_DsdManVerifyFailures()
+{
+    return s_nDsdVerifyFails;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Checks existence of decomposition.]
@@ -212,7 +212,7 @@ void If_ManRestart( If_Man_t * p )
 void If_ManStop( If_Man_t * p )
 {
     extern void If_ManCacheAnalize( If_Man_t * p );
-    int i;
+    int i, nCutsUselessAll = 0, nCutsCountAll = 0;
     if ( p->pPars->fVerbose && p->vCutData )
         If_ManCacheAnalize( p );
     if ( p->pPars->fVerbose && p->pPars->fTruth )
@@ -234,12 +234,17 @@ void If_ManStop( If_Man_t * p )
             Abc_PrintTime( 1, "Canon     ", p->timeCache[3] );
         }
     }
-    if ( p->pPars->fVerbose && p->nCutsUselessAll )
+    for ( i = 0; i < 32; i++ )
+    {
+        nCutsUselessAll += p->nCutsUseless[i];
+        nCutsCountAll   += p->nCutsCount[i];
+    }
+    if ( p->pPars->fVerbose && nCutsUselessAll )
     {
         for ( i = 0; i <= 16; i++ )
             if ( p->nCutsUseless[i] )
                 Abc_Print( 1, "Useless cuts %2d  = %9d  (out of %9d)  (%6.2f %%)\n", i, p->nCutsUseless[i], p->nCutsCount[i], 100.0*p->nCutsUseless[i]/Abc_MaxInt(p->nCutsCount[i],1) );
-        Abc_Print( 1, "Useless cuts all = %9d  (out of %9d)  (%6.2f %%)\n", p->nCutsUselessAll, p->nCutsCountAll, 100.0*p->nCutsUselessAll/Abc_MaxInt(p->nCutsCountAll,1) );
+        Abc_Print( 1, "Useless cuts all = %9d  (out of %9d)  (%6.2f %%)\n", nCutsUselessAll, nCutsCountAll, 100.0*nCutsUselessAll/Abc_MaxInt(nCutsCountAll,1) );
     }
 //    if ( p->pPars->fVerbose && p->nCuts5 )
 //        Abc_Print( 1, "Statistics about 5-cuts: Total = %d  Non-decomposable = %d (%.2f %%)\n", p->nCuts5, p->nCuts5-p->nCuts5a, 100.0*(p->nCuts5-p->nCuts5a)/p->nCuts5 );
@@ -291,6 +296,8 @@ void If_ManStop( If_Man_t * p )
     }
     ABC_FREE( p->pMemCi );
     ABC_FREE( p->pMemAnd );
+    if ( p->vMemSetsExtra )
+        Vec_PtrFreeFree( p->vMemSetsExtra );
     ABC_FREE( p->puTemp[0] );
     ABC_FREE( p->puTempW );
     // free pars memory
@@ -716,6 +723,38 @@ void If_ManSetupSetAll( If_Man_t * p, int nCrossCut )
 
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds more cutsets to the free list.]
+
+  Description [Used when several nodes are processed at the same time,
+  so that the number of live cutsets can exceed the cross cut.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManSetupSetExtra( If_Man_t * p, int nCutSets )
+{
+    If_Set_t * pCutSet, * pMem;
+    int i;
+    pMem = pCutSet = (If_Set_t *)ABC_ALLOC( char, nCutSets * p->nSetBytes );
+    for ( i = 0; i < nCutSets; i++ )
+    {
+        If_ManSetupSet( p, pCutSet );
+        if ( i == nCutSets - 1 )
+            pCutSet->pNext = p->pFreeList;
+        else
+            pCutSet->pNext = (If_Set_t *)( (char *)pCutSet + p->nSetBytes );
+        pCutSet = pCutSet->pNext;
+    }
+    p->pFreeList = pMem;
+    if ( p->vMemSetsExtra == NULL )
+        p->vMemSetsExtra = Vec_PtrAlloc( 16 );
+    Vec_PtrPush( p->vMemSetsExtra, pMem );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,18 @@
 
 #include "if.h"
 #include "misc/extra/extra.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -152,20 +164,22 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
   Synopsis    [Finds the best cut for the given node.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Mapping modes: delay (0), area flow (1), area (2).
+  The cuts filtered by the cost functions are counted in pCutsUseless
+  and pCutsCount by their size, which are the counters of the manager,
+  or those of the thread in the concurrent mapping round.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+static inline int If_ObjPerformMappingAndInt( If_Man_t * p, If_Obj_t * pObj, If_Set_t * pCutSet, int Mode, int fPreprocess, int fFirst, int * pCutsUseless, int * pCutsCount )
 {
-    If_Set_t * pCutSet;
     If_Cut_t * pCut0, * pCut1, * pCut;
     If_Cut_t * pCut0R, * pCut1R;
-    int fFunc0R, fFunc1R;
-    int i, k, v, iCutDsd, fChange;
+    int fFunc0R, fFunc1R, nCutsMerged = 0;
+    int i, k, v, iCutDsd = -1, fChange;
     int fSave0 = p->pPars->fDelayOpt || p->pPars->fDelayOptLut || p->pPars->fDsdBalance || p->pPars->fUserRecLib || p->pPars->fUserSesLib || 
         p->pPars->fUseDsdTune || p->pPars->fUseCofVars || p->pPars->fUseAndVars || p->pPars->fUse34Spec || p->pPars->pLutStruct || p->pPars->pFuncCell2;
     int fUseAndCut = (p->pPars->nAndDelay > 0) || (p->pPars->nAndArea > 0);
@@ -181,9 +195,6 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaDeref( p, If_ObjCutBest(pObj) );
 
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
-
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
     if ( !fFirst )
@@ -266,8 +277,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         }
         if ( pObj->fSpec && pCut->nLeaves == (unsigned)p->pPars->nLutSize )
             continue;
-        p->nCutsMerged++;
-        p->nCutsTotal++;
+        nCutsMerged++;
         // check if this cut is contained in any of the available cuts
         if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, fSave0 ) )
             continue;
@@ -282,13 +292,13 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         {
 //            int nShared = pCut0->nLeaves + pCut1->nLeaves - pCut->nLeaves;
             abctime clk = 0;
-            if ( p->pPars->fVerbose )
+            if ( p->pPars->fVerbose && !p->pTtMutex )
                 clk = Abc_Clock();
             if ( p->pPars->fUseTtPerm )
                 fChange = If_CutComputeTruthPerm( p, pCut, pCut0R, pCut1R, fFunc0R, fFunc1R );
             else
                 fChange = If_CutComputeTruth( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1 );
-            if ( p->pPars->fVerbose )
+            if ( p->pPars->fVerbose && !p->pTtMutex )
                 p->timeCache[4] += Abc_Clock() - clk;
             if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0 ) )
                 continue;
@@ -298,18 +308,40 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             {
                 extern void If_ManCacheRecord( If_Man_t * p, int iDsd0, int iDsd1, int nShared, int iDsd );
                 int truthId = Abc_Lit2Var(pCut->iCutFunc);
-                if ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) || Vec_IntEntry(p->vTtDsds[pCut->nLeaves], truthId) == -1 )
+                // in the concurrent round, the entries are reserved (If_ManReserveTruths) 
+                // and an entry is written once, after its permutation
+                assert( !p->pTtMutex || truthId < Vec_IntSize(p->vTtDsds[pCut->nLeaves]) );
+                iCutDsd = truthId < Vec_IntSize(p->vTtDsds[pCut->nLeaves]) ? Vec_IntEntry(p->vTtDsds[pCut->nLeaves], truthId) : -1;
+                if ( iCutDsd == -1 )
                 {
-                    while ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) )
+                    If_ManTtLock( p );
+                    iCutDsd = truthId < Vec_IntSize(p->vTtDsds[pCut->nLeaves]) ? Vec_IntEntry(p->vTtDsds[pCut->nLeaves], truthId) : -1;
+                    if ( iCutDsd == -1 )
                     {
-                        Vec_IntPush( p->vTtDsds[pCut->nLeaves], -1 );
-                        for ( v = 0; v < Abc_MaxInt(6, pCut->nLeaves); v++ )
-                            Vec_StrPush( p->vTtPerms[pCut->nLeaves], IF_BIG_CHAR );
+                        while ( truthId >= Vec_IntSize(p->vTtDsds[pCut->nLeaves]) )
+                        {
+                            Vec_IntPush( p->vTtDsds[pCut->nLeaves], -1 );
+                            for ( v = 0; v < Abc_MaxInt(6, pCut->nLeaves); v++ )
+                                Vec_StrPush( p->vTtPerms[pCut->nLeaves], IF_BIG_CHAR );
+                        }
+                        iCutDsd = If_DsdManCompute( p->pIfDsdMan, If_CutTruthWR(p, pCut), pCut->nLeaves, (unsigned char *)If_CutDsdPerm(p, pCut), p->pPars->pLutStruct );
+                        // the DSD that failed verification is not recorded
+                        if ( iCutDsd != -1 )
+                        {
+                            ABC_FENCE();
+                            Vec_IntWriteEntry( p->vTtDsds[pCut->nLeaves], truthId, iCutDsd );
+                            p->nTtDsdsDone++;
+                        }
                     }
-                    iCutDsd = If_DsdManCompute( p->pIfDsdMan, If_CutTruthWR(p, pCut), pCut->nLeaves, (unsigned char *)If_CutDsdPerm(p, pCut), p->pPars->pLutStruct );
-                    Vec_IntWriteEntry( p->vTtDsds[pCut->nLeaves], truthId, iCutDsd );
+                    If_ManTtUnlock( p );
+                    // skip the cut without a valid DSD
+                    if ( iCutDsd == -1 )
+                        continue;
                 }
-                assert( If_DsdManSuppSize(p->pIfDsdMan, If_CutDsdLit(p, pCut)) == (int)pCut->nLeaves );
+                else if ( p->pTtMutex )
+                    ABC_FENCE();
+                iCutDsd = Abc_LitNotCond( iCutDsd, Abc_LitIsCompl(pCut->iCutFunc) );
+                assert( If_DsdManSuppSize(p->pIfDsdMan, iCutDsd) == (int)pCut->nLeaves );
                 //If_ManCacheRecord( p, If_CutDsdLit(p, pCut0), If_CutDsdLit(p, pCut1), nShared, If_CutDsdLit(p, pCut) );
             }
             // run user functions
@@ -319,15 +351,13 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                 assert( p->pPars->fUseTtPerm == 0 );
                 assert( pCut->nLimit >= 4 && pCut->nLimit <= 16 );
                 if ( p->pPars->fUseDsd )
-                    pCut->fUseless = If_DsdManCheckDec( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
+                    pCut->fUseless = If_DsdManCheckDec( p->pIfDsdMan, iCutDsd );
                 else if ( p->pPars->pFuncCell2 )
                     pCut->fUseless = !p->pPars->pFuncCell2( p, (word *)If_CutTruthW(p, pCut), pCut->nLeaves, NULL, NULL );
                 else
                     pCut->fUseless = !p->pPars->pFuncCell( p, If_CutTruth(p, pCut), Abc_MaxInt(6, pCut->nLeaves), pCut->nLeaves, p->pPars->pLutStruct );
-                p->nCutsUselessAll += pCut->fUseless;
-                p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
-                p->nCutsCountAll++;
-                p->nCutsCount[pCut->nLeaves]++;
+                pCutsUseless[pCut->nLeaves] += pCut->fUseless;
+                pCutsCount[pCut->nLeaves]++;
                 // skip 5-input cuts, which cannot be decomposed
                 if ( (p->pPars->fEnableCheck75 || p->pPars->fEnableCheck75u) && pCut->nLeaves == 5 && pCut->nLimit == 5 )
                 {
@@ -354,11 +384,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
             }
             else if ( p->pPars->fUseDsdTune )
             {
-                pCut->fUseless = If_DsdManReadMark( p->pIfDsdMan, If_CutDsdLit(p, pCut) );
-                p->nCutsUselessAll += pCut->fUseless;
-                p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
-                p->nCutsCountAll++;
-                p->nCutsCount[pCut->nLeaves]++;
+                pCut->fUseless = If_DsdManReadMark( p->pIfDsdMan, iCutDsd );
+                pCutsUseless[pCut->nLeaves] += pCut->fUseless;
+                pCutsCount[pCut->nLeaves]++;
             }
             else if ( p->pPars->fUse34Spec )
             {
@@ -385,10 +413,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                     iDecMask = Vec_IntEntry(p->vTtDecs[pCut->nLeaves], truthId);
                     assert( iDecMask >= 0 );
                     pCut->fUseless = (int)(iDecMask == 0 && (int)pCut->nLeaves > p->pPars->nLutSize / 2);
-                    p->nCutsUselessAll += pCut->fUseless;
-                    p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
-                    p->nCutsCountAll++;
-                    p->nCutsCount[pCut->nLeaves]++;
+                    pCutsUseless[pCut->nLeaves] += pCut->fUseless;
+                    pCutsCount[pCut->nLeaves]++;
                 }
                 if ( p->pPars->fUseCofVars && (!p->pPars->fUseAndVars || pCut->fUseless) )
                 {
@@ -403,10 +429,8 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                     iCofVar = Vec_StrEntry(p->vTtVars[pCut->nLeaves], truthId);
                     assert( iCofVar >= 0 && iCofVar <= (int)pCut->nLeaves );
                     pCut->fUseless = (int)(iCofVar == (int)pCut->nLeaves && pCut->nLeaves > 0);
-                    p->nCutsUselessAll += pCut->fUseless;
-                    p->nCutsUseless[pCut->nLeaves] += pCut->fUseless;
-                    p->nCutsCountAll++;
-                    p->nCutsCount[pCut->nLeaves]++;
+                    pCutsUseless[pCut->nLeaves] += pCut->fUseless;
+                    pCutsCount[pCut->nLeaves]++;
                 }
             }
         }
@@ -487,6 +511,13 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     if ( p->pPars->pFuncUser )
         If_ObjForEachCut( pObj, pCut, i )
             p->pPars->pFuncUser( p, pObj, pCut );
+    return nCutsMerged;
+}
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    int nCutsMerged = If_ObjPerformMappingAndInt( p, pObj, If_ManSetupNodeCutSet(p, pObj), Mode, fPreprocess, fFirst, p->nCutsUseless, p->nCutsCount );
+    p->nCutsMerged += nCutsMerged;
+    p->nCutsTotal  += nCutsMerged;
     // free the cuts
     If_ManDerefNodeCutSet( p, pObj );
 }
@@ -576,6 +607,279 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the mapping round can be performed by several threads.]
+
+  Description [Concurrent processing of the nodes on the same level is
+  used only when the result of a node depends on nothing but the cuts of 
+  its fanins: the delay-oriented round (no reference counting), without 
+  timing manager, choices and user-specified cost functions. Truth tables
+  are supported when the cuts are filtered using the DSD manager, whose
+  updates are serialized. Without pthreads, the round is always serial.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingCanPar( If_Man_t * p, int Mode )
+{
+    If_Par_t * pPars = p->pPars;
+#ifndef ABC_USE_PTHREADS
+    return 0;
+#endif
+    if ( pPars->nProcs <= 1 || Mode != 0 || p->pManTim != NULL || p->nChoices > 0 )
+        return 0;
+    if ( pPars->fUseTtPerm || pPars->fPower || pPars->nGateSize > 0 )
+        return 0;
+    if ( pPars->fDelayOpt || pPars->fDelayOptLut || pPars->fDsdBalance || pPars->fUserRecLib || pPars->fUserSesLib )
+        return 0;
+    if ( pPars->pFuncCost || pPars->pFuncUser || pPars->pFuncCell2 )
+        return 0;
+    // truth tables are allowed if the cuts are filtered using the DSD manager
+    if ( pPars->fTruth && !pPars->fUseDsd )
+        return 0;
+    if ( pPars->fUseCofVars || pPars->fUseAndVars || pPars->fUse34Spec || pPars->fEnableCheck75 || pPars->fEnableCheck75u )
+        return 0;
+    if ( pPars->pFuncCell && !pPars->fUseDsd )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Serializes updates of the truth tables and their DSDs.]
+
+  Description [Does nothing unless the mapping round is performed by 
+  several threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+void If_ManTtLock( If_Man_t * p )   {}
+void If_ManTtUnlock( If_Man_t * p ) {}
+#else // pthreads are used
+void If_ManTtLock( If_Man_t * p )
+{
+    if ( p->pTtMutex )
+        pthread_mutex_lock( (pthread_mutex_t *)p->pTtMutex );
+}
+void If_ManTtUnlock( If_Man_t * p )
+{
+    if ( p->pTtMutex )
+        pthread_mutex_unlock( (pthread_mutex_t *)p->pTtMutex );
+}
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Makes sure the truth table data does not move.]
+
+  Description [The truth tables of the fanin cuts, their DSDs and the 
+  nodes of the DSD manager are read without locking, while other threads
+  may add new truth tables and DSDs. The page table of the truth table
+  store and the arrays of DSDs are reserved for the largest number of 
+  truth tables that can be added when processing the given nodes. 
+  The object array of the DSD manager is reserved for the DSDs of all
+  truth tables, whose DSDs are not known.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManReserveTruths( If_Man_t * p, Vec_Ptr_t * vNodes )
+{
+    If_Obj_t * pObj;
+    int i, v, nTruths = 0, nOpen = 0;
+    Vec_PtrForEachEntry( If_Obj_t *, vNodes, pObj, i )
+        nTruths += pObj->pFanin0->pCutSet->nCuts * pObj->pFanin1->pCutSet->nCuts;
+    for ( v = 6; v <= Abc_MaxInt(6, p->pPars->nLutSize); v++ )
+    {
+        int nEntries = Vec_MemEntryNum(p->vTtMem[v]) + nTruths;
+        Vec_MemReserve( p->vTtMem[v], nEntries );
+        if ( p->vTtDsds[v] == NULL )
+            continue;
+        Vec_IntFillExtra( p->vTtDsds[v], nEntries, -1 );
+        Vec_StrFillExtra( p->vTtPerms[v], nEntries * v, IF_BIG_CHAR );
+        nOpen += Vec_IntSize(p->vTtDsds[v]);
+    }
+    // each new DSD adds at most one node for each of its inputs
+    if ( p->pIfDsdMan )
+        If_DsdManReserve( p->pIfDsdMan, Abc_MaxInt(nOpen - p->nTtDsdsDone, 0) * Abc_MaxInt(6, p->pPars->nLutSize) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass using several threads.]
+
+  Description [The nodes are processed level by level. The cutsets of
+  the nodes on the current level are allocated before the level is started
+  and the cutsets of the fanins are recycled after the level is finished, 
+  in the same order as in the serial pass, so the result is identical.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst ) { assert( 0 ); }
+
+#else // pthreads are used
+
+#define IF_THR_MAX   64
+#define IF_THR_MIN  256  // the smallest level processed by threads
+typedef struct If_MapThData_t_
+{
+    If_Man_t *    p;
+    Vec_Ptr_t *   vNodes;
+    int           iStart;
+    int           iStop;
+    int           Mode;
+    int           fPreprocess;
+    int           fFirst;
+    int           nCutsMerged;
+    int           nCutsUseless[32];
+    int           nCutsCount[32];
+    volatile int  fWorking;
+} If_MapThData_t;
+void * If_MapWorkerThread( void * pArg )
+{
+    If_MapThData_t * pThData = (If_MapThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    If_Obj_t * pObj; int i;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        ABC_FENCE();
+        assert( pThData->fWorking );
+        if ( pThData->vNodes == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Vec_PtrForEachEntryStartStop( If_Obj_t *, pThData->vNodes, pObj, i, pThData->iStart, pThData->iStop )
+            pThData->nCutsMerged += If_ObjPerformMappingAndInt( pThData->p, pObj, pObj->pCutSet, pThData->Mode, pThData->fPreprocess, pThData->fFirst, pThData->nCutsUseless, pThData->nCutsCount );
+        ABC_FENCE();
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    If_MapThData_t ThData[IF_THR_MAX];
+    pthread_t WorkerThread[IF_THR_MAX];
+    Vec_Vec_t * vLevels = Vec_VecStart( p->nLevelMax + 1 );
+    Vec_Ptr_t * vLevel;
+    If_Obj_t * pObj;
+    int nProcs = Abc_MinInt( p->pPars->nProcs, IF_THR_MAX );
+    int i, k, status, nCutsMerged = 0;
+    If_ManForEachNode( p, pObj, i )
+        Vec_VecPush( vLevels, pObj->Level, pObj );
+    // prepare to share the truth tables and the DSD manager
+    if ( p->pPars->fTruth )
+    {
+        p->pTtMutex = ABC_ALLOC( pthread_mutex_t, 1 );
+        pthread_mutex_init( (pthread_mutex_t *)p->pTtMutex, NULL );
+        if ( p->pIfDsdMan )
+            If_DsdManSetConcurrent( p->pIfDsdMan, 1 );
+    }
+    // start threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p           = p;
+        ThData[i].vNodes      = NULL;
+        ThData[i].iStart      = 0;
+        ThData[i].iStop       = 0;
+        ThData[i].Mode        = Mode;
+        ThData[i].fPreprocess = fPreprocess;
+        ThData[i].fFirst      = fFirst;
+        ThData[i].nCutsMerged = 0;
+        memset( ThData[i].nCutsUseless, 0, sizeof(ThData[i].nCutsUseless) );
+        memset( ThData[i].nCutsCount, 0, sizeof(ThData[i].nCutsCount) );
+        ThData[i].fWorking    = 0;
+        status = pthread_create( WorkerThread + i, NULL, If_MapWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // process the levels
+    Vec_VecForEachLevel( vLevels, vLevel, k )
+    {
+        int nNodes = Vec_PtrSize(vLevel), nChunk;
+        if ( nNodes == 0 )
+            continue;
+        // prepare the cutsets
+        Vec_PtrForEachEntry( If_Obj_t *, vLevel, pObj, i )
+        {
+            if ( p->pFreeList == NULL )
+                If_ManSetupSetExtra( p, Abc_MaxInt(1024, nNodes - i) );
+            If_ManSetupNodeCutSet( p, pObj );
+        }
+        // compute the cuts
+        if ( nNodes < IF_THR_MIN )
+        {
+            Vec_PtrForEachEntry( If_Obj_t *, vLevel, pObj, i )
+                nCutsMerged += If_ObjPerformMappingAndInt( p, pObj, pObj->pCutSet, Mode, fPreprocess, fFirst, p->nCutsUseless, p->nCutsCount );
+        }
+        else
+        {
+            if ( p->pTtMutex )
+                If_ManReserveTruths( p, vLevel );
+            nChunk = (nNodes + nProcs - 1) / nProcs;
+            for ( i = 0; i < nProcs; i++ )
+            {
+                ThData[i].vNodes   = vLevel;
+                ThData[i].iStart   = Abc_MinInt( i * nChunk, nNodes );
+                ThData[i].iStop    = Abc_MinInt( (i + 1) * nChunk, nNodes );
+                ABC_FENCE();
+                ThData[i].fWorking = 1;
+            }
+            for ( i = 0; i < nProcs; i++ )
+                while ( ThData[i].fWorking );
+            ABC_FENCE();
+        }
+        // recycle the cutsets
+        Vec_PtrForEachEntry( If_Obj_t *, vLevel, pObj, i )
+            If_ManDerefNodeCutSet( p, pObj );
+    }
+    // stop threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        assert( !ThData[i].fWorking );
+        nCutsMerged += ThData[i].nCutsMerged;
+        ThData[i].vNodes   = NULL;
+        ABC_FENCE();
+        ThData[i].fWorking = 1;
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        for ( k = 0; k < 32; k++ )
+        {
+            p->nCutsUseless[k] += ThData[i].nCutsUseless[k];
+            p->nCutsCount[k]   += ThData[i].nCutsCount[k];
+        }
+    }
+    if ( p->pTtMutex )
+    {
+        if ( p->pIfDsdMan )
+            If_DsdManSetConcurrent( p->pIfDsdMan, 0 );
+        pthread_mutex_destroy( (pthread_mutex_t *)p->pTtMutex );
+        ABC_FREE( p->pTtMutex );
+    }
+    p->nCutsMerged += nCutsMerged;
+    p->nCutsTotal  += nCutsMerged;
+    Vec_VecFree( vLevels );
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -642,6 +946,8 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( If_ManPerformMappingCanPar(p, Mode) )
+        If_ManPerformMappingRoundPar( p, Mode, fPreprocess, fFirst );
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
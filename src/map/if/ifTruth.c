@@ -89,7 +89,9 @@ void If_CutRotatePins( If_Man_t * p, If_Cut_t * pCut )
 
   Synopsis    [Truth table computation.]
 
-  Description []
+  Description [The intermediate truth tables are kept in each thread,
+  so that the cuts of different nodes can be processed concurrently.
+  Adding the result to the truth table store is serialized.]
                
   SideEffects []
 
@@ -98,12 +100,13 @@ void If_CutRotatePins( If_Man_t * p, If_Cut_t * pCut )
 ***********************************************************************/
 int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_t * pCut1, int fCompl0, int fCompl1 )
 {
+    static ABC_THREAD_LOCAL word pTemp[3][1 << (IF_MAX_FUNC_LUTSIZE-6)];
     int fCompl, truthId, nLeavesNew, PrevSize, RetValue = 0;
     word * pTruth0s = Vec_MemReadEntry( p->vTtMem[pCut0->nLeaves], Abc_Lit2Var(pCut0->iCutFunc) );
     word * pTruth1s = Vec_MemReadEntry( p->vTtMem[pCut1->nLeaves], Abc_Lit2Var(pCut1->iCutFunc) );
-    word * pTruth0  = (word *)p->puTemp[0];
-    word * pTruth1  = (word *)p->puTemp[1];
-    word * pTruth   = (word *)p->puTemp[2];
+    word * pTruth0  = pTemp[0];
+    word * pTruth1  = pTemp[1];
+    word * pTruth   = pTemp[2];
     Abc_TtCopy( pTruth0, pTruth0s, p->nTruth6Words[pCut0->nLeaves], fCompl0 ^ pCut0->fCompl ^ Abc_LitIsCompl(pCut0->iCutFunc) );
     Abc_TtCopy( pTruth1, pTruth1s, p->nTruth6Words[pCut1->nLeaves], fCompl1 ^ pCut1->fCompl ^ Abc_LitIsCompl(pCut1->iCutFunc) );
     Abc_TtStretch6( pTruth0, pCut0->nLeaves, pCut->nLeaves );
@@ -122,8 +125,10 @@ int If_CutComputeTruth( If_Man_t * p, If_Cut_t * pCut, If_Cut_t * pCut0, If_Cut_
             RetValue      = 1;
         }
     }
+    If_ManTtLock( p );
     PrevSize       = Vec_MemEntryNum( p->vTtMem[pCut->nLeaves] );   
     truthId        = Vec_MemHashInsert( p->vTtMem[pCut->nLeaves], pTruth );
+    If_ManTtUnlock( p );
     pCut->iCutFunc = Abc_Var2Lit( truthId, fCompl );
     assert( (pTruth[0] & 1) == 0 );
 #ifdef IF_TRY_NEW
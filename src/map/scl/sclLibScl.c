@@ -26,6 +26,9 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclCon.h"
 
+#include <sys/types.h>
+#include <sys/stat.h>
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +36,12 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define ABC_SCL_CACHE_MAGIC    0x43534241  // "ABSC"
+#define ABC_SCL_CACHE_VERSION  2
+#define ABC_SCL_CACHE_HEADER   40          // bytes before the SCL payload
+#define ABC_SCL_CACHE_BLOCK    (1 << 16)   // bytes hashed in one read
+#define ABC_SCL_CACHE_DIR      "ABC_SCL_CACHE_DIR" // the cache directory variable
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -447,6 +456,201 @@ SC_Lib * Abc_SclReadFromFile( char * pFileName )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes the signature of the Liberty file.]
+
+  Description [The signature is the file size, the modification time,
+  and the FNV-1a hash of the complete file contents. Hashing is much
+  cheaper than parsing, and, unlike sampling the file or relying on
+  the time stamp, it cannot miss an edit of the same size that was
+  made within the time stamp resolution.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Abc_SclCacheHash( word Hash, unsigned char * pData, size_t nData )
+{
+    size_t k;
+    for ( k = 0; k < nData; k++ )
+        Hash = (Hash ^ pData[k]) * ABC_CONST(0x100000001b3);
+    return Hash;
+}
+static int Abc_SclCacheSignature( char * pFileName, word Sign[3] )
+{
+    struct stat Stat;
+    unsigned char * pBlock;
+    word Hash = ABC_CONST(0xcbf29ce484222325);
+    word nTotal = 0;
+    size_t nRead;
+    FILE * pFile;
+    if ( stat( pFileName, &Stat ) != 0 )
+        return 0;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return 0;
+    pBlock = ABC_ALLOC( unsigned char, ABC_SCL_CACHE_BLOCK );
+    while ( (nRead = fread( pBlock, 1, ABC_SCL_CACHE_BLOCK, pFile )) > 0 )
+    {
+        Hash = Abc_SclCacheHash( Hash, pBlock, nRead );
+        nTotal += nRead;
+    }
+    ABC_FREE( pBlock );
+    if ( ferror(pFile) || nTotal != (word)Stat.st_size )
+    {
+        fclose( pFile );
+        return 0;
+    }
+    fclose( pFile );
+    Sign[0] = nTotal;
+    Sign[1] = (word)Stat.st_mtime;
+    Sign[2] = Hash;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the cache file of the Liberty file.]
+
+  Description [The cache is kept in the directory given by the 
+  environment variable ABC_SCL_CACHE_DIR, if it is set, and next to
+  the Liberty file otherwise. In the cache directory, the name is
+  the base name of the library followed by the hash of its path, 
+  so that the libraries with the same name do not overwrite each 
+  other's cache.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_SclCacheFileName( char * pFileName )
+{
+    char * pCacheDir = getenv( ABC_SCL_CACHE_DIR );
+    char * pCacheName, * pBase;
+    word Hash;
+    if ( pCacheDir == NULL || pCacheDir[0] == 0 )
+    {
+        pCacheName = ABC_ALLOC( char, strlen(pFileName) + 6 );
+        sprintf( pCacheName, "%s.sclc", pFileName );
+        return pCacheName;
+    }
+    Hash  = Abc_SclCacheHash( ABC_CONST(0xcbf29ce484222325), (unsigned char *)pFileName, strlen(pFileName) );
+    pBase = Extra_FileNameWithoutPath( pFileName );
+    pCacheName = ABC_ALLOC( char, strlen(pCacheDir) + strlen(pBase) + 30 );
+    sprintf( pCacheName, "%s/%s-%016llx.sclc", pCacheDir, pBase, (unsigned long long)Hash );
+    return pCacheName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the library from the binary cache of the Liberty file.]
+
+  Description [Returns NULL if there is no cache or if the cache does 
+  not match the current contents of the Liberty file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclReadCache( char * pFileName )
+{
+    SC_Lib * p = NULL;
+    Vec_Str_t * vOut;
+    char * pCacheName;
+    FILE * pFile;
+    word Sign[3];
+    int i, Pos = 0, nFileSize, nPayload, fValid;
+    if ( !Abc_SclCacheSignature( pFileName, Sign ) )
+        return NULL;
+    pCacheName = Abc_SclCacheFileName( pFileName );
+    pFile = fopen( pCacheName, "rb" );
+    ABC_FREE( pCacheName );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );  
+    nFileSize = ftell( pFile );  
+    rewind( pFile ); 
+    if ( nFileSize <= ABC_SCL_CACHE_HEADER )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    vOut = Vec_StrAlloc( nFileSize );
+    vOut->nSize = (int)fread( Vec_StrArray(vOut), 1, nFileSize, pFile );
+    fclose( pFile );
+    // check the header
+    fValid = Vec_StrSize(vOut) == nFileSize;
+    fValid = fValid && Vec_StrGetI_ne(vOut, &Pos) == ABC_SCL_CACHE_MAGIC;
+    fValid = fValid && Vec_StrGetI_ne(vOut, &Pos) == ABC_SCL_CACHE_VERSION;
+    fValid = fValid && Vec_StrGetI_ne(vOut, &Pos) == ABC_SCL_CUR_VERSION;
+    for ( i = 0; fValid && i < 3; i++ )
+        fValid = Vec_StrGetW(vOut, &Pos) == Sign[i];
+    nPayload = fValid ? Vec_StrGetI_ne(vOut, &Pos) : 0;
+    fValid = fValid && nPayload == nFileSize - ABC_SCL_CACHE_HEADER;
+    assert( !fValid || Pos == ABC_SCL_CACHE_HEADER );
+    if ( fValid )
+    {
+        // shift the payload to the beginning and read the library
+        memmove( Vec_StrArray(vOut), Vec_StrArray(vOut) + Pos, nPayload );
+        Vec_StrShrink( vOut, nPayload );
+        p = Abc_SclReadFromStr( vOut );
+        if ( p != NULL )
+            p->pFileName = Abc_UtilStrsav( pFileName );
+        if ( p != NULL )
+            Abc_SclLibNormalize( p );
+    }
+    Vec_StrFree( vOut );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the binary cache of the Liberty file.]
+
+  Description [Failure to write the cache (for example, when the
+  directory of the library is read-only) is silently ignored.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclWriteCache( char * pFileName, Vec_Str_t * vStr )
+{
+    Vec_Str_t * vHead;
+    char * pCacheName;
+    FILE * pFile;
+    word Sign[3];
+    int i, fOk;
+    if ( !Abc_SclCacheSignature( pFileName, Sign ) )
+        return;
+    vHead = Vec_StrAlloc( ABC_SCL_CACHE_HEADER );
+    Vec_StrPutI_ne( vHead, ABC_SCL_CACHE_MAGIC );
+    Vec_StrPutI_ne( vHead, ABC_SCL_CACHE_VERSION );
+    Vec_StrPutI_ne( vHead, ABC_SCL_CUR_VERSION );
+    for ( i = 0; i < 3; i++ )
+        Vec_StrPutW( vHead, Sign[i] );
+    Vec_StrPutI_ne( vHead, Vec_StrSize(vStr) );
+    assert( Vec_StrSize(vHead) == ABC_SCL_CACHE_HEADER );
+    pCacheName = Abc_SclCacheFileName( pFileName );
+    pFile = fopen( pCacheName, "wb" );
+    if ( pFile != NULL )
+    {
+        fOk  = (int)fwrite( Vec_StrArray(vHead), 1, Vec_StrSize(vHead), pFile ) == Vec_StrSize(vHead);
+        fOk &= (int)fwrite( Vec_StrArray(vStr), 1, Vec_StrSize(vStr), pFile ) == Vec_StrSize(vStr);
+        fOk &= fclose( pFile ) == 0;
+        // do not leave a truncated cache behind
+        if ( !fOk )
+            remove( pCacheName );
+    }
+    ABC_FREE( pCacheName );
+    Vec_StrFree( vHead );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writing library into file.]
@@ -22,6 +22,23 @@
 #include "misc/st/st.h"
 #include "map/mio/mio.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -31,6 +48,8 @@ ABC_NAMESPACE_IMPL_START
 
 // #define ABC_MAX_LIB_STR_LEN 5000
 
+#define SCL_LIBERTY_THR_MAX 64    // the largest number of threads
+
 // entry types
 typedef enum { 
     SCL_LIBERTY_NONE = 0,        // 0:  unknown
@@ -42,8 +61,8 @@ typedef enum {
 typedef struct Scl_Pair_t_ Scl_Pair_t;
 struct Scl_Pair_t_
 {
-    int             Beg;          // item beginning
-    int             End;          // item end
+    size_t          Beg;          // item beginning
+    size_t          End;          // item end
 };
 
 typedef struct Scl_Item_t_ Scl_Item_t;
@@ -63,7 +82,8 @@ struct Scl_Tree_t_
 {
     char *          pFileName;    // input Liberty file name
     char *          pContents;    // file contents
-    int             nContents;    // file size
+    size_t          nContents;    // file size
+    size_t          nMapped;      // the size of the memory-mapped area (0 if the contents is allocated)
     int             nLines;       // line counter
     int             nItems;       // number of items
     int             nItermAlloc;  // number of items allocated
@@ -75,7 +95,7 @@ struct Scl_Tree_t_
 
 static inline Scl_Item_t *  Scl_LibertyRoot( Scl_Tree_t * p )                                      { return p->pItems;                                                 }
 static inline Scl_Item_t *  Scl_LibertyItem( Scl_Tree_t * p, int v )                               { assert( v < p->nItems ); return v < 0 ? NULL : p->pItems + v;     }
-static inline int           Scl_LibertyCompare( Scl_Tree_t * p, Scl_Pair_t Pair, char * pStr )     { return strncmp( p->pContents+Pair.Beg, pStr, Pair.End-Pair.Beg ) || ((int)strlen(pStr) != Pair.End-Pair.Beg); }
+static inline int           Scl_LibertyCompare( Scl_Tree_t * p, Scl_Pair_t Pair, char * pStr )     { return strncmp( p->pContents+Pair.Beg, pStr, Pair.End-Pair.Beg ) || (strlen(pStr) != Pair.End-Pair.Beg); }
 static inline void          Scl_PrintWord( FILE * pFile, Scl_Tree_t * p, Scl_Pair_t Pair )         { char * pBeg = p->pContents+Pair.Beg, * pEnd = p->pContents+Pair.End; while ( pBeg < pEnd ) fputc( *pBeg++, pFile ); }
 static inline void          Scl_PrintSpace( FILE * pFile, int nOffset )                            { int i; for ( i = 0; i < nOffset; i++ ) fputc(' ', pFile);         }
 static inline int           Scl_LibertyItemId( Scl_Tree_t * p, Scl_Item_t * pItem )                { return pItem - p->pItems;                                         }
@@ -85,6 +105,24 @@ static inline int           Scl_LibertyItemId( Scl_Tree_t * p, Scl_Item_t * pIte
 #define Scl_ItemForEachChildName( p, pItem, pChild, pName ) \
     for ( pChild = Scl_LibertyItem(p, pItem->Child); pChild; pChild = Scl_LibertyItem(p, pChild->Next) ) if ( Scl_LibertyCompare(p, pChild->Key, pName) ) {} else
 
+// the data of one thread parsing the library
+typedef struct Scl_LibertyThData_t_ Scl_LibertyThData_t;
+struct Scl_LibertyThData_t_
+{
+    Scl_Tree_t *    p;            // the tree (the thread's own copy when deriving cells)
+    int             iThread;      // the thread number
+    int             nThreads;     // the number of threads
+    int             fFailed;      // the thread has failed
+    // building items
+    Vec_Ptr_t *     vChunks;      // the trees of the chunks
+    Vec_Wrd_t *     vBounds;      // the chunk boundaries
+    Vec_Int_t *     vResults;     // the first item of each chunk (-2 if empty; -1 if failed)
+    // deriving cells
+    Vec_Ptr_t *     vCells;       // the cells to write
+    Vec_Ptr_t *     vTemples;     // the delay-table templates
+    Vec_Ptr_t *     vStrs;        // the binary data of each cell
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -343,8 +381,8 @@ char * Scl_LibertyReadString( Scl_Tree_t * p, Scl_Pair_t Pair )
 { 
     // static char Buffer[ABC_MAX_LIB_STR_LEN]; 
     char * Buffer;
-    if ( Pair.End - Pair.Beg + 2 > Vec_StrSize(p->vBuffer) )
-        Vec_StrFill( p->vBuffer, Pair.End - Pair.Beg + 100, '\0' );
+    if ( Pair.End - Pair.Beg + 2 > (size_t)Vec_StrSize(p->vBuffer) )
+        Vec_StrFill( p->vBuffer, (int)(Pair.End - Pair.Beg) + 100, '\0' );
     Buffer = Vec_StrArray( p->vBuffer );
     strncpy( Buffer, p->pContents+Pair.Beg, Pair.End-Pair.Beg ); 
     if ( Pair.Beg < Pair.End && Buffer[0] == '\"' )
@@ -506,22 +544,32 @@ void Scl_LibertyFixFileName( char * pFileName )
         if ( *pHead == '>' )
             *pHead = '\\';
 }
-int Scl_LibertyFileSize( char * pFileName )
+size_t Scl_LibertyFileSize( char * pFileName )
 {
+#ifndef _WIN32
+    struct stat Stat;
+    if ( stat( pFileName, &Stat ) == -1 || !S_ISREG(Stat.st_mode) )
+    {
+        printf( "Scl_LibertyFileSize(): The input file is unavailable (absent or open).\n" );
+        return 0;
+    }
+    return (size_t)Stat.st_size;
+#else
     FILE * pFile;
-    int nFileSize;
+    ABC_INT64_T nFileSize;
     pFile = fopen( pFileName, "rb" );
     if ( pFile == NULL )
     {
         printf( "Scl_LibertyFileSize(): The input file is unavailable (absent or open).\n" );
         return 0;
     }
-    fseek( pFile, 0, SEEK_END );  
-    nFileSize = ftell( pFile ); 
+    _fseeki64( pFile, 0, SEEK_END );  
+    nFileSize = _ftelli64( pFile ); 
     fclose( pFile );
-    return nFileSize;
+    return nFileSize < 0 ? 0 : (size_t)nFileSize;
+#endif
 }
-char * Scl_LibertyFileContents( char * pFileName, int nContents )
+char * Scl_LibertyFileContents( char * pFileName, size_t nContents )
 {
     FILE * pFile = fopen( pFileName, "rb" );
     char * pContents = ABC_ALLOC( char, nContents+1 );
@@ -531,6 +579,44 @@ char * Scl_LibertyFileContents( char * pFileName, int nContents )
     pContents[nContents] = 0;
     return pContents;
 }
+// maps the file followed by at least one zero byte; returns NULL if mapping is not available
+char * Scl_LibertyFileMap( char * pFileName, size_t nContents, size_t * pnMapped )
+{
+#ifndef _WIN32
+    size_t nPage = (size_t)sysconf( _SC_PAGESIZE );
+    size_t nMap = (nContents / nPage + 1) * nPage;
+    char * pBase, * pFile;
+    int Fd = open( pFileName, O_RDONLY );
+    if ( Fd < 0 )
+        return NULL;
+    // reserve zero pages and place the file at the beginning, so that the contents is zero-terminated
+    pBase = (char *)mmap( NULL, nMap, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0 );
+    if ( pBase == (char *)MAP_FAILED )
+    {
+        close( Fd );
+        return NULL;
+    }
+    // the mapping is private, so wiping out comments does not change the file
+    pFile = (char *)mmap( pBase, nContents, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, Fd, 0 );
+    close( Fd );
+    if ( pFile != pBase )
+    {
+        munmap( pBase, nMap );
+        return NULL;
+    }
+    assert( pBase[nContents] == 0 );
+    *pnMapped = nMap;
+    return pBase;
+#else
+    return NULL;
+#endif
+}
+void Scl_LibertyFileUnmap( char * pContents, size_t nMapped )
+{
+#ifndef _WIN32
+    munmap( pContents, nMapped );
+#endif
+}
 void Scl_LibertyStringDump( char * pFileName, Vec_Str_t * vStr )
 {
     FILE * pFile = fopen( pFileName, "wb" );
@@ -558,18 +644,20 @@ void Scl_LibertyStringDump( char * pFileName, Vec_Str_t * vStr )
 Scl_Tree_t * Scl_LibertyStart( char * pFileName )
 {
     Scl_Tree_t * p;
-    int RetValue;
+    size_t nFileSize;
     // read the file into the buffer
     Scl_LibertyFixFileName( pFileName );
-    RetValue = Scl_LibertyFileSize( pFileName );
-    if ( RetValue == 0 )
+    nFileSize = Scl_LibertyFileSize( pFileName );
+    if ( nFileSize == 0 )
         return NULL;
     // start the manager
     p = ABC_ALLOC( Scl_Tree_t, 1 );
     memset( p, 0, sizeof(Scl_Tree_t) );
     p->clkStart  = Abc_Clock();
-    p->nContents = RetValue;
-    p->pContents = Scl_LibertyFileContents( pFileName, p->nContents );
+    p->nContents = nFileSize;
+    p->pContents = Scl_LibertyFileMap( pFileName, p->nContents, &p->nMapped );
+    if ( p->pContents == NULL )
+        p->pContents = Scl_LibertyFileContents( pFileName, p->nContents );
     // other 
     p->pFileName = Abc_UtilStrsav( pFileName );
     p->nItermAlloc = 10 + Scl_LibertyCountItems( p->pContents, p->pContents+p->nContents );
@@ -588,20 +676,282 @@ void Scl_LibertyStop( Scl_Tree_t * p, int fVerbose )
     }
     Vec_StrFree( p->vBuffer );
     ABC_FREE( p->pFileName );
-    ABC_FREE( p->pContents );
+    if ( p->nMapped )
+        Scl_LibertyFileUnmap( p->pContents, p->nMapped );
+    else
+        ABC_FREE( p->pContents );
     ABC_FREE( p->pItems );
     ABC_FREE( p->pError );
     ABC_FREE( p );
 }
-Scl_Tree_t * Scl_LibertyParse( char * pFileName, int fVerbose )
+/**Function*************************************************************
+
+  Synopsis    [Runs the threads.]
+
+  Description [The first thread is run by the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Scl_LibertyRunThreads( Scl_LibertyThData_t * pThData, int nThreads, void * (*pFunc)(void *) )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[SCL_LIBERTY_THR_MAX];
+    int i, status;
+    assert( nThreads <= SCL_LIBERTY_THR_MAX );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, pFunc, (void *)(pThData + i) );  assert( status == 0 );
+    }
+    pFunc( (void *)pThData );
+    for ( i = 1; i < nThreads; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+#else
+    int i;
+    for ( i = 0; i < nThreads; i++ )
+        pFunc( (void *)(pThData + i) );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the body of the library into chunks.]
+
+  Description [A chunk ends after a top-level group, which is followed
+  by a cell group. Records the first line of each chunk.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Scl_LibertySplitBody( Scl_Tree_t * p, size_t Beg, size_t End, int nChunks, Vec_Int_t * vLines )
+{
+    Vec_Wrd_t * vBounds = Vec_WrdAlloc( 2 * nChunks + 2 );
+    char * pCur, * pNext, * pEnd = p->pContents + End;
+    size_t nTarget = (End - Beg) / nChunks + 1, iLast = Beg;
+    int nParens = 0, nBraces = 0, fQuote = 0, nLines = 1;
+    for ( pCur = p->pContents; pCur < p->pContents + Beg; pCur++ )
+        nLines += (*pCur == '\n');
+    Vec_WrdPush( vBounds, Beg );
+    Vec_IntPush( vLines, nLines );
+    for ( pCur = p->pContents + Beg; pCur < pEnd; pCur++ )
+    {
+        if ( *pCur == '\n' )
+            nLines++;
+        else if ( *pCur == '\"' && nParens == 0 )
+            fQuote ^= 1;
+        else if ( fQuote )
+            continue;
+        else if ( *pCur == '(' )
+            nParens++;
+        else if ( *pCur == ')' )
+            nParens--;
+        else if ( *pCur == '{' && nParens == 0 )
+            nBraces++;
+        else if ( *pCur == '}' && nParens == 0 && --nBraces == 0 && (size_t)(pCur + 1 - p->pContents) - iLast >= nTarget )
+        {
+            for ( pNext = pCur + 1; pNext < pEnd && Scl_LibertyCharIsSpace(*pNext); pNext++ );
+            if ( pEnd - pNext > 4 && !strncmp(pNext, "cell", 4) && (Scl_LibertyCharIsSpace(pNext[4]) || pNext[4] == '(') )
+            {
+                iLast = pCur + 1 - p->pContents;
+                Vec_WrdPush( vBounds, iLast );
+                Vec_IntPush( vLines, nLines );
+            }
+        }
+    }
+    Vec_WrdPush( vBounds, End );
+    return vBounds;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the items of the chunks assigned to the thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Scl_LibertyBuildChunks( void * pArg )
+{
+    Scl_LibertyThData_t * pTh = (Scl_LibertyThData_t *)pArg;
+    Scl_Tree_t * pNew;
+    char * pPos;
+    int i;
+    for ( i = pTh->iThread; i < Vec_PtrSize(pTh->vChunks); i += pTh->nThreads )
+    {
+        pNew = (Scl_Tree_t *)Vec_PtrEntry( pTh->vChunks, i );
+        pPos = pNew->pContents + Vec_WrdEntry(pTh->vBounds, i);
+        pNew->nItermAlloc = 10 + Scl_LibertyCountItems( pPos, pNew->pContents + Vec_WrdEntry(pTh->vBounds, i+1) );
+        pNew->pItems = ABC_CALLOC( Scl_Item_t, pNew->nItermAlloc );
+        Vec_IntWriteEntry( pTh->vResults, i, Scl_LibertyBuildItem(pNew, &pPos, pNew->pContents + Vec_WrdEntry(pTh->vBounds, i+1)) );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Builds the items using several threads.]
+
+  Description [The body of the library group is split into chunks
+  of top-level groups, whose items are built by the threads. The items
+  of the chunks are then appended in order, which gives the same
+  numbering as Scl_LibertyBuildItem(). Falls back to the serial parser
+  if the file does not start with a group or if a chunk cannot be
+  parsed. Returns 0 on success.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Scl_LibertyBuildPar( Scl_Tree_t * p, int nProcs )
+{
+    Scl_LibertyThData_t ThData[SCL_LIBERTY_THR_MAX];
+    Vec_Ptr_t * vChunks;
+    Vec_Wrd_t * vBounds;
+    Vec_Int_t * vLines, * vResults;
+    Scl_Tree_t * pNew;
+    Scl_Item_t * pRoot = NULL, * pItem;
+    Scl_Pair_t Key, Head, Body;
+    char * pPos = p->pContents, * pEnd = p->pContents + p->nContents, * pStop;
+    int i, k, Offset, iPrev = -1, fFailed = 0;
+    nProcs = Abc_MinInt( nProcs, SCL_LIBERTY_THR_MAX );
+    // parse the head of the library group
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) )
+        goto serial;
+    Key.Beg = pPos - p->pContents;
+    if ( Scl_LibertySkipEntry( &pPos, pEnd ) )
+        goto serial;
+    Key.End = pPos - p->pContents;
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) || *pPos != '(' )
+        goto serial;
+    pStop = Scl_LibertyFindMatch( pPos, pEnd );
+    Head.Beg = pPos - p->pContents + 1;
+    Head.End = pStop - p->pContents;
+    pPos = pStop + 1;
+    if ( Scl_LibertySkipSpaces( p, &pPos, pEnd, 0 ) || *pPos != '{' )
+        goto serial;
+    pStop = Scl_LibertyFindMatch( pPos, pEnd );
+    Body.Beg = pPos - p->pContents + 1;
+    Body.End = pStop - p->pContents;
+    // split the body into chunks
+    vLines  = Vec_IntAlloc( 100 );
+    vBounds = Scl_LibertySplitBody( p, Body.Beg, Body.End, 4 * nProcs, vLines );
+    if ( Vec_WrdSize(vBounds) < 3 )
+    {
+        Vec_WrdFree( vBounds );
+        Vec_IntFree( vLines );
+        goto serial;
+    }
+    vChunks  = Vec_PtrAlloc( Vec_IntSize(vLines) );
+    vResults = Vec_IntStartFull( Vec_IntSize(vLines) );
+    for ( i = 0; i < Vec_IntSize(vLines); i++ )
+    {
+        pNew = ABC_CALLOC( Scl_Tree_t, 1 );
+        pNew->pFileName = p->pFileName;
+        pNew->pContents = p->pContents;
+        pNew->nContents = p->nContents;
+        pNew->nLines    = Vec_IntEntry( vLines, i );
+        pNew->vBuffer   = Vec_StrStart( 10 );
+        Vec_PtrPush( vChunks, pNew );
+    }
+    // build the items
+    nProcs = Abc_MinInt( nProcs, Vec_PtrSize(vChunks) );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Scl_LibertyThData_t) );
+        ThData[i].p        = p;
+        ThData[i].iThread  = i;
+        ThData[i].nThreads = nProcs;
+        ThData[i].vChunks  = vChunks;
+        ThData[i].vBounds  = vBounds;
+        ThData[i].vResults = vResults;
+    }
+    Scl_LibertyRunThreads( ThData, nProcs, Scl_LibertyBuildChunks );
+    fFailed = (Vec_IntFind(vResults, -1) >= 0);
+    // append the items of the chunks
+    if ( !fFailed )
+    {
+        pRoot = Scl_LibertyNewItem( p, SCL_LIBERTY_PROC );
+        pRoot->Key   = Key;
+        pRoot->Head  = Scl_LibertyUpdateHead( p, Head );
+        pRoot->Body  = Body;
+        pRoot->Child = -2;
+        Vec_PtrForEachEntry( Scl_Tree_t *, vChunks, pNew, i )
+        {
+            if ( Vec_IntEntry(vResults, i) == -2 ) // empty chunk
+                continue;
+            assert( Vec_IntEntry(vResults, i) == 0 );
+            assert( p->nItems + pNew->nItems <= p->nItermAlloc );
+            Offset = p->nItems;
+            memcpy( p->pItems + Offset, pNew->pItems, sizeof(Scl_Item_t) * pNew->nItems );
+            for ( k = 0; k < pNew->nItems; k++ )
+            {
+                pItem = p->pItems + Offset + k;
+                if ( pItem->Child >= 0 )
+                    pItem->Child += Offset;
+                if ( pItem->Next >= 0 )
+                    pItem->Next += Offset;
+            }
+            p->nItems += pNew->nItems;
+            // link the first top-level item of the chunk and find the last one
+            if ( iPrev == -1 )
+                pRoot->Child = Offset;
+            else
+                p->pItems[iPrev].Next = Offset;
+            for ( iPrev = Offset; p->pItems[iPrev].Next >= 0; iPrev = p->pItems[iPrev].Next );
+        }
+        p->nLines = ((Scl_Tree_t *)Vec_PtrEntryLast(vChunks))->nLines;
+    }
+    Vec_PtrForEachEntry( Scl_Tree_t *, vChunks, pNew, i )
+    {
+        Vec_StrFree( pNew->vBuffer );
+        ABC_FREE( pNew->pItems );
+        ABC_FREE( pNew->pError );
+        ABC_FREE( pNew );
+    }
+    Vec_PtrFree( vChunks );
+    Vec_WrdFree( vBounds );
+    Vec_IntFree( vLines );
+    Vec_IntFree( vResults );
+    if ( fFailed )
+        goto serial;
+    // parse the items following the library group
+    pPos = pStop + 1;
+    pRoot->Next = Scl_LibertyBuildItem( p, &pPos, pEnd );
+    return pRoot->Next == -1 ? -1 : 0;
+
+serial:
+    // the serial parser also reports the error, if any
+    p->nItems = 0;
+    p->nLines = 1;
+    ABC_FREE( p->pError );
+    pPos = p->pContents;
+    return Scl_LibertyBuildItem( p, &pPos, pEnd );
+}
+
+Scl_Tree_t * Scl_LibertyParse( char * pFileName, int nProcs, int fVerbose )
 {
     Scl_Tree_t * p;
     char * pPos;
+    int RetValue;
     if ( (p = Scl_LibertyStart(pFileName)) == NULL )
         return NULL;
     pPos = p->pContents;
     Scl_LibertyWipeOutComments( p->pContents, p->pContents+p->nContents );
-    if ( (!Scl_LibertyBuildItem( p, &pPos, p->pContents + p->nContents )) == 0 )
+    if ( nProcs > 1 )
+        RetValue = Scl_LibertyBuildPar( p, nProcs );
+    else
+        RetValue = Scl_LibertyBuildItem( p, &pPos, p->pContents + p->nContents );
+    if ( RetValue != 0 )
     {
         if ( p->pError ) printf( "%s", p->pError );
         printf( "Parsing failed.  " );
@@ -772,7 +1122,7 @@ Vec_Str_t * Scl_LibertyParseGenlibStr( char * pFileName, int fVerbose )
 {
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
-    p = Scl_LibertyParse( pFileName, fVerbose );
+    p = Scl_LibertyParse( pFileName, 1, fVerbose );
     if ( p == NULL )
         return NULL;
 //    Scl_LibertyRead( p, "temp_.lib" );
@@ -1004,10 +1354,14 @@ int Scl_LibertyReadTimingSense( Scl_Tree_t * p, Scl_Item_t * pPin )
 }
 Vec_Flt_t * Scl_LibertyReadFloatVec( char * pName )
 {
-    char * pToken;
+    char * pToken, * pDelims = " \t\n\r\\\",";
     Vec_Flt_t * vValues = Vec_FltAlloc( 100 );
-    for ( pToken = strtok(pName, " \t\n\r\\\","); pToken; pToken = strtok(NULL, " \t\n\r\\\",") )
+    // same as splitting with strtok(), which cannot be used by several threads
+    for ( pToken = pName + strspn(pName, pDelims); *pToken; pToken += strspn(pToken, pDelims) )
+    {
         Vec_FltPush( vValues, atof(pToken) );
+        pToken += strcspn( pToken, pDelims );
+    }
     return vValues;
 }
 
@@ -1427,15 +1781,266 @@ Vec_Ptr_t * Scl_LibertyReadTemplates( Scl_Tree_t * p )
 //    Scl_LibertyPrintTemplates( vRes );
     return vRes;
 }
-Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbose )
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the binary data of one cell.]
+
+  Description [Returns 0 if the cell cannot be read.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Scl_LibertyReadCell( Scl_Tree_t * p, Scl_Item_t * pCell, Vec_Ptr_t * vTemples, Vec_Str_t * vOut )
 {
     int fUseFirstTable = 0;
-    Vec_Str_t * vOut;
-    Vec_Ptr_t * vNameIns, * vTemples = NULL;
-    Scl_Item_t * pCell, * pPin, * pTiming;
+    Vec_Ptr_t * vNameIns;
+    Scl_Item_t * pPin, * pTiming;
     Vec_Wrd_t * vTruth;
     char * pFormula, * pName;
-    int i, k, Counter, nOutputs, nCells;
+    int i, k, nOutputs;
+    // top level information
+    Vec_StrPutS_( vOut, Scl_LibertyReadString(p, pCell->Head) );
+    pName = Scl_LibertyReadCellArea(p, pCell);
+    Vec_StrPutF_( vOut, pName ? atof(pName) : 1 );
+    pName = Scl_LibertyReadCellLeakage(p, pCell);
+    Vec_StrPutF_( vOut, pName ? atof(pName) : 0 );
+    Vec_StrPutI_( vOut, Scl_LibertyReadDeriveStrength(p, pCell) );
+    // pin count
+    nOutputs = Scl_LibertyReadCellOutputNum( p, pCell );
+    Vec_StrPutI_( vOut, Scl_LibertyItemNum(p, pCell, "pin") - nOutputs );
+    Vec_StrPutI_( vOut, nOutputs );
+    Vec_StrPut_( vOut );
+    Vec_StrPut_( vOut );
+
+    // input pins
+    vNameIns = Vec_PtrAlloc( 16 );
+    Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
+    {
+        float CapOne, CapRise, CapFall;
+        if ( Scl_LibertyReadPinFormula(p, pPin) != NULL ) // skip output pin
+            continue;
+        assert( Scl_LibertyReadPinDirection(p, pPin) == 0 );
+        pName = Scl_LibertyReadString(p, pPin->Head);
+        Vec_PtrPush( vNameIns, Abc_UtilStrsav(pName) );
+        Vec_StrPutS_( vOut, pName );
+        CapOne  = Scl_LibertyReadPinCap( p, pPin, "capacitance" );
+        CapRise = Scl_LibertyReadPinCap( p, pPin, "rise_capacitance" );
+        CapFall = Scl_LibertyReadPinCap( p, pPin, "fall_capacitance" );
+        if ( CapRise == 0 )
+            CapRise = CapOne;
+        if ( CapFall == 0 )
+            CapFall = CapOne;
+        Vec_StrPutF_( vOut, CapRise );
+        Vec_StrPutF_( vOut, CapFall );
+        Vec_StrPut_( vOut );
+    }
+    Vec_StrPut_( vOut );
+    // output pins
+    Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
+    {
+        if ( !Scl_LibertyReadPinFormula(p, pPin) ) // skip input pin
+            continue;
+        assert( Scl_LibertyReadPinDirection(p, pPin) == 1 );
+        pName = Scl_LibertyReadString(p, pPin->Head);
+        Vec_StrPutS_( vOut, pName );
+        Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_capacitance" ) );
+        Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_transition" ) );
+        Vec_StrPutI_( vOut, Vec_PtrSize(vNameIns) );
+        pFormula = Scl_LibertyReadPinFormula(p, pPin);
+        Vec_StrPutS_( vOut, pFormula );
+        // write truth table
+        vTruth = Mio_ParseFormulaTruth( pFormula, (char **)Vec_PtrArray(vNameIns), Vec_PtrSize(vNameIns) );
+        if ( vTruth == NULL )
+            return 0;
+        for ( i = 0; i < Abc_Truth6WordNum(Vec_PtrSize(vNameIns)); i++ )
+            Vec_StrPutW_( vOut, Vec_WrdEntry(vTruth, i) );
+        Vec_WrdFree( vTruth );
+        Vec_StrPut_( vOut );
+        Vec_StrPut_( vOut );
+
+        // write the delay tables
+        if ( fUseFirstTable )
+        {
+            Vec_PtrForEachEntry( char *, vNameIns, pName, i )
+            {
+                pTiming = Scl_LibertyReadPinTiming( p, pPin, pName );
+                Vec_StrPutS_( vOut, pName );
+                Vec_StrPutI_( vOut, (int)(pTiming != NULL) );
+                if ( pTiming == NULL ) // output does not depend on input
+                    continue;
+                Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, pTiming) );
+                Vec_StrPut_( vOut );
+                Vec_StrPut_( vOut );
+                // some cells only have 'rise' or 'fall' but not both - here we work around this
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",           vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",           vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition",     vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition",     vTemples ) )
+                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }  
+            }
+            continue;
+        }
+
+        // write the timing tables
+        Vec_PtrForEachEntry( char *, vNameIns, pName, i )
+        {
+            Vec_Ptr_t * vTables[4];
+            Vec_Ptr_t * vTimings;
+            vTimings = Scl_LibertyReadPinTimingAll( p, pPin, pName );
+            Vec_StrPutS_( vOut, pName );
+            Vec_StrPutI_( vOut, (int)(Vec_PtrSize(vTimings) != 0) );
+            if ( Vec_PtrSize(vTimings) == 0 ) // output does not depend on input
+            {
+                Vec_PtrFree( vTimings );
+                continue;
+            }
+            Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, (Scl_Item_t *)Vec_PtrEntry(vTimings, 0)) );
+            Vec_StrPut_( vOut );
+            Vec_StrPut_( vOut );
+            // collect the timing tables
+            for ( k = 0; k < 4; k++ )
+                vTables[k] = Vec_PtrAlloc( 16 );
+            Vec_PtrForEachEntry( Scl_Item_t *, vTimings, pTiming, k )
+            {
+                // some cells only have 'rise' or 'fall' but not both - here we work around this
+                if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_rise",           vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_fall",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_fall",           vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_rise",       vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "rise_transition",     vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "fall_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }                              
+                if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "fall_transition",     vTemples ) )
+                    if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "rise_transition", vTemples ) )
+                            { printf( "Table cannot be found\n" ); return 0; }  
+            }
+            Vec_PtrFree( vTimings );
+            // compute worse case of the tables
+            for ( k = 0; k < 4; k++ )
+            {
+                Vec_Flt_t * vInd0, * vInd1, * vValues;
+                if ( !Scl_LibertyComputeWorstCase( vTables[k], &vInd0, &vInd1, &vValues ) )
+                    { printf( "Table indexes have different values\n" ); return 0; }  
+                Vec_VecFree( (Vec_Vec_t *)vTables[k] );
+                Scl_LibertyDumpTables( vOut, vInd0, vInd1, vValues );
+                Vec_FltFree( vInd0 );
+                Vec_FltFree( vInd1 );
+                Vec_FltFree( vValues );
+            }
+        }
+    }
+    Vec_StrPut_( vOut );
+    Vec_PtrFreeFree( vNameIns );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the binary data of the cells assigned to the thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Scl_LibertyReadCells( void * pArg )
+{
+    Scl_LibertyThData_t * pTh = (Scl_LibertyThData_t *)pArg;
+    Scl_Item_t * pCell;
+    int i;
+    for ( i = pTh->iThread; i < Vec_PtrSize(pTh->vCells) && !pTh->fFailed; i += pTh->nThreads )
+    {
+        pCell = (Scl_Item_t *)Vec_PtrEntry( pTh->vCells, i );
+        Vec_PtrWriteEntry( pTh->vStrs, i, Vec_StrAlloc(1000) );
+        if ( !Scl_LibertyReadCell( pTh->p, pCell, pTh->vTemples, (Vec_Str_t *)Vec_PtrEntry(pTh->vStrs, i) ) )
+            pTh->fFailed = 1;
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the binary data of the cells using several threads.]
+
+  Description [Each thread writes the cells into separate buffers,
+  which are appended in the original order. The threads read the tree
+  through their own copies of the manager, which differ in the string
+  buffer used by Scl_LibertyReadString().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Scl_LibertyReadCellsPar( Scl_Tree_t * p, Vec_Ptr_t * vCells, Vec_Ptr_t * vTemples, Vec_Str_t * vOut, int nProcs )
+{
+    Scl_LibertyThData_t ThData[SCL_LIBERTY_THR_MAX];
+    Scl_Tree_t Trees[SCL_LIBERTY_THR_MAX];
+    Vec_Ptr_t * vStrs = Vec_PtrStart( Vec_PtrSize(vCells) );
+    Vec_Str_t * vStr;
+    int i, fFailed = 0;
+    nProcs = Abc_MinInt( Abc_MinInt(nProcs, SCL_LIBERTY_THR_MAX), Vec_PtrSize(vCells) );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Trees[i] = *p;
+        Trees[i].vBuffer = Vec_StrStart( 10 );
+        memset( ThData + i, 0, sizeof(Scl_LibertyThData_t) );
+        ThData[i].p        = Trees + i;
+        ThData[i].iThread  = i;
+        ThData[i].nThreads = nProcs;
+        ThData[i].vCells   = vCells;
+        ThData[i].vTemples = vTemples;
+        ThData[i].vStrs    = vStrs;
+    }
+    Scl_LibertyRunThreads( ThData, nProcs, Scl_LibertyReadCells );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        fFailed |= ThData[i].fFailed;
+        Vec_StrFree( Trees[i].vBuffer );
+    }
+    Vec_PtrForEachEntry( Vec_Str_t *, vStrs, vStr, i )
+    {
+        if ( vStr == NULL )
+            continue;
+        if ( !fFailed )
+            Vec_StrPushBuffer( vOut, Vec_StrArray(vStr), Vec_StrSize(vStr) );
+        Vec_StrFree( vStr );
+    }
+    Vec_PtrFree( vStrs );
+    return !fFailed;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the binary SCL representation of the library.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int nProcs, int fVerbose, int fVeryVerbose )
+{
+    Vec_Str_t * vOut;
+    Vec_Ptr_t * vCells, * vTemples = NULL;
+    Scl_Item_t * pCell;
+    int i, Counter, nCells;
     int nSkipped[4] = {0};
 
     // read delay-table templates
@@ -1460,8 +2065,8 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     Scl_LibertyReadWireLoad( p, vOut );
     Scl_LibertyReadWireLoadSelect( p, vOut );
 
-    // count cells
-    nCells = 0;
+    // collect cells
+    vCells = Vec_PtrAlloc( 1000 );
     Scl_ItemForEachChildName( p, Scl_LibertyRoot(p), pCell, "cell" )
     {
         if ( Scl_LibertyReadCellIsFlop(p, pCell) )
@@ -1488,165 +2093,25 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
             nSkipped[2]++;
             continue;
         }
-        nCells++;
+        Vec_PtrPush( vCells, pCell );
     }
+    nCells = Vec_PtrSize( vCells );
     // read cells
     Vec_StrPutI_( vOut, nCells );
     Vec_StrPut_( vOut );
     Vec_StrPut_( vOut );
-    Scl_ItemForEachChildName( p, Scl_LibertyRoot(p), pCell, "cell" )
+    if ( nProcs > 1 && Vec_PtrSize(vCells) > 1 )
     {
-        if ( Scl_LibertyReadCellIsFlop(p, pCell) )
-            continue;
-        if ( Scl_LibertyReadCellIsDontUse(p, pCell) )
-            continue;
-        if ( Scl_LibertyReadCellIsThreeState(p, pCell) )
-            continue;
-        if ( (Counter = Scl_LibertyReadCellOutputNum(p, pCell)) == 0 )
-            continue;
-        // top level information
-        Vec_StrPutS_( vOut, Scl_LibertyReadString(p, pCell->Head) );
-        pName = Scl_LibertyReadCellArea(p, pCell);
-        Vec_StrPutF_( vOut, pName ? atof(pName) : 1 );
-        pName = Scl_LibertyReadCellLeakage(p, pCell);
-        Vec_StrPutF_( vOut, pName ? atof(pName) : 0 );
-        Vec_StrPutI_( vOut, Scl_LibertyReadDeriveStrength(p, pCell) );
-        // pin count
-        nOutputs = Scl_LibertyReadCellOutputNum( p, pCell );
-        Vec_StrPutI_( vOut, Scl_LibertyItemNum(p, pCell, "pin") - nOutputs );
-        Vec_StrPutI_( vOut, nOutputs );
-        Vec_StrPut_( vOut );
-        Vec_StrPut_( vOut );
-
-        // input pins
-        vNameIns = Vec_PtrAlloc( 16 );
-        Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
-        {
-            float CapOne, CapRise, CapFall;
-            if ( Scl_LibertyReadPinFormula(p, pPin) != NULL ) // skip output pin
-                continue;
-            assert( Scl_LibertyReadPinDirection(p, pPin) == 0 );
-            pName = Scl_LibertyReadString(p, pPin->Head);
-            Vec_PtrPush( vNameIns, Abc_UtilStrsav(pName) );
-            Vec_StrPutS_( vOut, pName );
-            CapOne  = Scl_LibertyReadPinCap( p, pPin, "capacitance" );
-            CapRise = Scl_LibertyReadPinCap( p, pPin, "rise_capacitance" );
-            CapFall = Scl_LibertyReadPinCap( p, pPin, "fall_capacitance" );
-            if ( CapRise == 0 )
-                CapRise = CapOne;
-            if ( CapFall == 0 )
-                CapFall = CapOne;
-            Vec_StrPutF_( vOut, CapRise );
-            Vec_StrPutF_( vOut, CapFall );
-            Vec_StrPut_( vOut );
-        }
-        Vec_StrPut_( vOut );
-        // output pins
-        Scl_ItemForEachChildName( p, pCell, pPin, "pin" )
-        {
-            if ( !Scl_LibertyReadPinFormula(p, pPin) ) // skip input pin
-                continue;
-            assert( Scl_LibertyReadPinDirection(p, pPin) == 1 );
-            pName = Scl_LibertyReadString(p, pPin->Head);
-            Vec_StrPutS_( vOut, pName );
-            Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_capacitance" ) );
-            Vec_StrPutF_( vOut, Scl_LibertyReadPinCap( p, pPin, "max_transition" ) );
-            Vec_StrPutI_( vOut, Vec_PtrSize(vNameIns) );
-            pFormula = Scl_LibertyReadPinFormula(p, pPin);
-            Vec_StrPutS_( vOut, pFormula );
-            // write truth table
-            vTruth = Mio_ParseFormulaTruth( pFormula, (char **)Vec_PtrArray(vNameIns), Vec_PtrSize(vNameIns) );
-            if ( vTruth == NULL )
+        if ( !Scl_LibertyReadCellsPar( p, vCells, vTemples, vOut, nProcs ) )
+            return NULL;
+    }
+    else
+    {
+        Vec_PtrForEachEntry( Scl_Item_t *, vCells, pCell, i )
+            if ( !Scl_LibertyReadCell( p, pCell, vTemples, vOut ) )
                 return NULL;
-            for ( i = 0; i < Abc_Truth6WordNum(Vec_PtrSize(vNameIns)); i++ )
-                Vec_StrPutW_( vOut, Vec_WrdEntry(vTruth, i) );
-            Vec_WrdFree( vTruth );
-            Vec_StrPut_( vOut );
-            Vec_StrPut_( vOut );
-
-            // write the delay tables
-            if ( fUseFirstTable )
-            {
-                Vec_PtrForEachEntry( char *, vNameIns, pName, i )
-                {
-                    pTiming = Scl_LibertyReadPinTiming( p, pPin, pName );
-                    Vec_StrPutS_( vOut, pName );
-                    Vec_StrPutI_( vOut, (int)(pTiming != NULL) );
-                    if ( pTiming == NULL ) // output does not depend on input
-                        continue;
-                    Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, pTiming) );
-                    Vec_StrPut_( vOut );
-                    Vec_StrPut_( vOut );
-                    // some cells only have 'rise' or 'fall' but not both - here we work around this
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",           vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_fall",           vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "cell_rise",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition",     vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyReadTable( p, vOut, pTiming, "fall_transition",     vTemples ) )
-                        if ( !Scl_LibertyReadTable( p, vOut, pTiming, "rise_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }  
-                }
-                continue;
-            }
-
-            // write the timing tables
-            Vec_PtrForEachEntry( char *, vNameIns, pName, i )
-            {
-                Vec_Ptr_t * vTables[4];
-                Vec_Ptr_t * vTimings;
-                vTimings = Scl_LibertyReadPinTimingAll( p, pPin, pName );
-                Vec_StrPutS_( vOut, pName );
-                Vec_StrPutI_( vOut, (int)(Vec_PtrSize(vTimings) != 0) );
-                if ( Vec_PtrSize(vTimings) == 0 ) // output does not depend on input
-                {
-                    Vec_PtrFree( vTimings );
-                    continue;
-                }
-                Vec_StrPutI_( vOut, Scl_LibertyReadTimingSense(p, (Scl_Item_t *)Vec_PtrEntry(vTimings, 0)) );
-                Vec_StrPut_( vOut );
-                Vec_StrPut_( vOut );
-                // collect the timing tables
-                for ( k = 0; k < 4; k++ )
-                    vTables[k] = Vec_PtrAlloc( 16 );
-                Vec_PtrForEachEntry( Scl_Item_t *, vTimings, pTiming, k )
-                {
-                    // some cells only have 'rise' or 'fall' but not both - here we work around this
-                    if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_rise",           vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[0], pTiming, "cell_fall",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_fall",           vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[1], pTiming, "cell_rise",       vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "rise_transition",     vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[2], pTiming, "fall_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }                              
-                    if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "fall_transition",     vTemples ) )
-                        if ( !Scl_LibertyScanTable( p, vTables[3], pTiming, "rise_transition", vTemples ) )
-                                { printf( "Table cannot be found\n" ); return NULL; }  
-                }
-                Vec_PtrFree( vTimings );
-                // compute worse case of the tables
-                for ( k = 0; k < 4; k++ )
-                {
-                    Vec_Flt_t * vInd0, * vInd1, * vValues;
-                    if ( !Scl_LibertyComputeWorstCase( vTables[k], &vInd0, &vInd1, &vValues ) )
-                        { printf( "Table indexes have different values\n" ); return NULL; }  
-                    Vec_VecFree( (Vec_Vec_t *)vTables[k] );
-                    Scl_LibertyDumpTables( vOut, vInd0, vInd1, vValues );
-                    Vec_FltFree( vInd0 );
-                    Vec_FltFree( vInd1 );
-                    Vec_FltFree( vValues );
-                }
-            }
-        }
-        Vec_StrPut_( vOut );
-        Vec_PtrFreeFree( vNameIns );
     }
+    Vec_PtrFree( vCells );
     // free templates
     if ( vTemples )
     {
@@ -1673,20 +2138,29 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fUseCache, int nProcs, int fVerbose, int fVeryVerbose )
 {
     SC_Lib * pLib;
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
+    // reuse the binary image saved by an earlier run, if it is still valid
+    if ( fUseCache && (pLib = Abc_SclReadCache( pFileName )) )
+    {
+        if ( fVerbose )
+            printf( "Library \"%s\" was loaded from the binary cache.\n", pFileName );
+        return pLib;
+    }
+    p = Scl_LibertyParse( pFileName, nProcs, fVeryVerbose );
     if ( p == NULL )
         return NULL;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
     // collect relevant data
-    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
+    vStr = Scl_LibertyReadSclStr( p, nProcs, fVerbose, fVeryVerbose );
     Scl_LibertyStop( p, fVeryVerbose );
     if ( vStr == NULL )
         return NULL;
+    if ( fUseCache )
+        Abc_SclWriteCache( pFileName, vStr );
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
     if ( pLib == NULL )
@@ -1717,11 +2191,11 @@ void Scl_LibertyTest()
     Scl_Tree_t * p;
     Vec_Str_t * vStr;
 //    return;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
+    p = Scl_LibertyParse( pFileName, 1, fVeryVerbose );
     if ( p == NULL )
         return;
 //    Scl_LibertyParseDump( p, "temp_.lib" );
-    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
+    vStr = Scl_LibertyReadSclStr( p, 1, fVerbose, fVeryVerbose );
     Scl_LibertyStringDump( "test_scl.lib", vStr );
     Vec_StrFree( vStr );
     Scl_LibertyStop( p, fVerbose );
@@ -22,11 +22,23 @@
 #include "map/mio/mio.h"
 #include "misc/vec/vecWec.h"
 #include "base/main/main.h"
+#include "misc/util/utilPth.h"
 
 #ifdef WIN32
 #include <windows.h>
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -305,7 +317,7 @@ static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
         Scl_LibHandleInputDriver( p->pPiDrive, pLoad, pTime, pSlew );
     }
 }
-void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+static inline int Abc_SclTimeNodeInt( SC_Man * p, Abc_Obj_t * pObj, int fDept )
 {
     SC_Timing * pTime;
     SC_Cell * pCell;
@@ -317,22 +329,6 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
     float DeptFall = 0;
     float Value = p->EstLoadMax ? Abc_SclObjLoadValue( p, pObj ) : 0;
     Abc_Obj_t * pFanin;
-    if ( Abc_ObjIsCi(pObj) )
-    {
-        assert( !fDept );
-        Abc_SclTimeCi( p, pObj );
-        return;
-    }
-    if ( Abc_ObjIsCo(pObj) )
-    {
-        if ( !fDept )
-        {
-            Abc_SclObjDupFanin( p, pObj );
-            Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
-            Vec_QueUpdate( p->vQue, pObj->iData );
-        }
-        return;
-    }
     assert( Abc_ObjIsNode(pObj) );
 //    if ( !(Abc_ObjFaninNum(pObj) == 1 && Abc_ObjIsPi(Abc_ObjFanin0(pObj))) && p->EstLoadMax && Value > 1 )
     if ( p->EstLoadMax && Value > 1 )
@@ -348,7 +344,6 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pDepOut->rise += EstDelta;
             pDepOut->fall += EstDelta;
         }
-        p->nEstNodes++;
     }
     // get the library cell
     pCell = Abc_SclObjCell( pObj );
@@ -379,6 +374,27 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pArrOut->fall += EstDelta;
         }
     }
+    return p->EstLoadMax && Value > 1;
+}
+void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    if ( Abc_ObjIsCi(pObj) )
+    {
+        assert( !fDept );
+        Abc_SclTimeCi( p, pObj );
+        return;
+    }
+    if ( Abc_ObjIsCo(pObj) )
+    {
+        if ( !fDept )
+        {
+            Abc_SclObjDupFanin( p, pObj );
+            Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
+            Vec_QueUpdate( p->vQue, pObj->iData );
+        }
+        return;
+    }
+    p->nEstNodes += Abc_SclTimeNodeInt( p, pObj, fDept );
 }
 void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
 {
@@ -397,6 +413,264 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
         printf( "after (%6.1f ps  %6.1f ps)\n", Abc_SclObjTimeOne(p, pObj, 1), Abc_SclObjTimeOne(p, pObj, 0) );
     }
 }
+/**Function*************************************************************
+
+  Synopsis    [Computes the departure time of the object from its fanouts.]
+
+  Description [Produces the same result as the reverse pass of 
+  Abc_SclTimeNode() over the fanouts, including the buffer tree estimation,
+  but only the departure time of the given object is modified. This allows
+  for the objects on the same level to be processed concurrently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Abc_SclDeptObjGather( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair * pDepIn  = Abc_SclObjDept( p, pObj );
+    SC_Pair * pSlewIn = Abc_SclObjSlew( p, pObj );
+    SC_Pair Load, DepOut;
+    Abc_Obj_t * pFanout, * pFanin;
+    SC_Cell * pCell;
+    float Value;
+    int i, k;
+    SC_PairClean( pDepIn );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( !Abc_ObjIsNode(pFanout) || !Abc_ObjFaninNum(pFanout) )
+            continue;
+        Load   = *Abc_SclObjLoad( p, pFanout );
+        DepOut = *Abc_SclObjDept( p, pFanout );
+        Value  = p->EstLoadMax ? Abc_SclObjLoadValue( p, pFanout ) : 0;
+        if ( p->EstLoadMax && Value > 1 )
+        {
+            float EstDelta = p->EstLinear * log( Value );
+            Load.rise = p->EstLoadAve * p->EstLoadMax;
+            Load.fall = p->EstLoadAve * p->EstLoadMax;
+            DepOut.rise += EstDelta;
+            DepOut.fall += EstDelta;
+        }
+        pCell = Abc_SclObjCell( pFanout );
+        Abc_ObjForEachFanin( pFanout, pFanin, k )
+            if ( pFanin == pObj )
+                Scl_LibPinDeparture( Scl_CellPinTime(pCell, k), pDepIn, pSlewIn, &Load, &DepOut );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Levelizes the network for the full timing update.]
+
+  Description [Returns the IDs of CIs and internal nodes ordered by level.
+  The CIs and the constant nodes are on level 0. The entries of vStarts 
+  point to the beginning of each level, followed by the total size.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Abc_SclTimeLevelize( SC_Man * p, Vec_Int_t * vStarts )
+{
+    Vec_Int_t * vLevel = Vec_IntStart( p->nObjs );
+    Vec_Int_t * vOrder;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level, LevelMax = 0;
+    Abc_NtkForEachNode( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Abc_ObjId(pFanin)) + 1 );
+        Vec_IntWriteEntry( vLevel, i, Level );
+        LevelMax = Abc_MaxInt( LevelMax, Level );
+    }
+    // count the objects on each level
+    Vec_IntFill( vStarts, LevelMax + 2, 0 );
+    Vec_IntAddToEntry( vStarts, 0, Abc_NtkCiNum(p->pNtk) );
+    Abc_NtkForEachNode( p->pNtk, pObj, i )
+        Vec_IntAddToEntry( vStarts, Vec_IntEntry(vLevel, i), 1 );
+    Level = 0;
+    Vec_IntForEachEntry( vStarts, k, i )
+        Vec_IntWriteEntry( vStarts, i, Level ), Level += k;
+    // place the objects 
+    vOrder = Vec_IntStart( Level );
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+        Vec_IntWriteEntry( vOrder, Vec_IntAddToEntry(vStarts, 0, 1) - 1, Abc_ObjId(pObj) );
+    Abc_NtkForEachNode( p->pNtk, pObj, i )
+        Vec_IntWriteEntry( vOrder, Vec_IntAddToEntry(vStarts, Vec_IntEntry(vLevel, i), 1) - 1, i );
+    // restore the starts
+    for ( i = Vec_IntSize(vStarts) - 1; i > 0; i-- )
+        Vec_IntWriteEntry( vStarts, i, Vec_IntEntry(vStarts, i-1) );
+    Vec_IntWriteEntry( vStarts, 0, 0 );
+    Vec_IntFree( vLevel );
+    return vOrder;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs full timing update using several threads.]
+
+  Description [The arrival times are computed level by level in the 
+  direct order and the departure times in the reverse order. The objects
+  of a level depend only on the objects of other levels, so the level is 
+  split into contiguous slices processed by the threads. The COs and the
+  small levels are handled by the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+void Abc_SclTimeNtkRecomputePar( SC_Man * p, int fReverse ) { assert( 0 ); }
+
+#else // pthreads are used
+
+#define SCL_THR_MAX   64
+#define SCL_THR_MIN  512  // the smallest level processed by threads
+typedef struct Abc_SclThData_t_
+{
+    SC_Man *      p;
+    Vec_Int_t *   vOrder;
+    int           iStart;
+    int           iStop;
+    int           fDept;
+    int           nEstNodes;
+    volatile int  fWorking;
+} Abc_SclThData_t;
+static inline int Abc_SclTimeLevelSlice( SC_Man * p, Vec_Int_t * vOrder, int iStart, int iStop, int fDept )
+{
+    Abc_Obj_t * pObj;
+    int i, nEstNodes = 0;
+    for ( i = iStart; i < iStop; i++ )
+    {
+        pObj = Abc_NtkObj( p->pNtk, Vec_IntEntry(vOrder, i) );
+        if ( fDept )
+        {
+            Abc_SclDeptObjGather( p, pObj );
+            if ( p->EstLoadMax && Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) && Abc_SclObjLoadValue(p, pObj) > 1 )
+                nEstNodes++;
+        }
+        else if ( Abc_ObjIsCi(pObj) )
+            Abc_SclTimeCi( p, pObj );
+        else if ( Abc_ObjFaninNum(pObj) )
+            nEstNodes += Abc_SclTimeNodeInt( p, pObj, 0 );
+    }
+    return nEstNodes;
+}
+void * Abc_SclTimeWorkerThread( void * pArg )
+{
+    Abc_SclThData_t * pThData = (Abc_SclThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        ABC_FENCE();
+        assert( pThData->fWorking );
+        if ( pThData->vOrder == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        pThData->nEstNodes += Abc_SclTimeLevelSlice( pThData->p, pThData->vOrder, pThData->iStart, pThData->iStop, pThData->fDept );
+        ABC_FENCE();
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+static int Abc_SclTimeLevelPar( SC_Man * p, Abc_SclThData_t * ThData, int nProcs, Vec_Int_t * vOrder, int iStart, int iStop, int fDept )
+{
+    int i, nChunk, nEstNodes = 0;
+    if ( iStop - iStart < SCL_THR_MIN )
+        return Abc_SclTimeLevelSlice( p, vOrder, iStart, iStop, fDept );
+    nChunk = (iStop - iStart + nProcs - 1) / nProcs;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].vOrder    = vOrder;
+        ThData[i].iStart    = Abc_MinInt( iStart + i * nChunk, iStop );
+        ThData[i].iStop     = Abc_MinInt( iStart + (i + 1) * nChunk, iStop );
+        ThData[i].fDept     = fDept;
+        ThData[i].nEstNodes = 0;
+        ABC_FENCE();
+        ThData[i].fWorking  = 1;
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        while ( ThData[i].fWorking );
+        ABC_FENCE();
+        nEstNodes += ThData[i].nEstNodes;
+    }
+    return nEstNodes;
+}
+void Abc_SclTimeNtkRecomputePar( SC_Man * p, int fReverse )
+{
+    Abc_SclThData_t ThData[SCL_THR_MAX];
+    pthread_t WorkerThread[SCL_THR_MAX];
+    Vec_Int_t * vStarts = Vec_IntAlloc( 100 );
+    Vec_Int_t * vOrder = Abc_SclTimeLevelize( p, vStarts );
+    int nProcs = Abc_MinInt( p->nProcs, SCL_THR_MAX );
+    int i, status, nLevels = Vec_IntSize(vStarts) - 1;
+    Abc_Obj_t * pObj;
+    // start threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].p         = p;
+        ThData[i].vOrder    = NULL;
+        ThData[i].iStart    = 0;
+        ThData[i].iStop     = 0;
+        ThData[i].fDept     = 0;
+        ThData[i].nEstNodes = 0;
+        ThData[i].fWorking  = 0;
+        status = pthread_create( WorkerThread + i, NULL, Abc_SclTimeWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    // arrival times
+    p->nEstNodes = 0;
+    for ( i = 0; i < nLevels; i++ )
+        p->nEstNodes += Abc_SclTimeLevelPar( p, ThData, nProcs, vOrder, Vec_IntEntry(vStarts, i), Vec_IntEntry(vStarts, i+1), 0 );
+    Abc_NtkForEachCo( p->pNtk, pObj, i )
+        Abc_SclTimeNode( p, pObj, 0 );
+    // departure times
+    if ( fReverse )
+    {
+        p->nEstNodes = 0;
+        for ( i = nLevels - 1; i >= 0; i-- )
+            p->nEstNodes += Abc_SclTimeLevelPar( p, ThData, nProcs, vOrder, Vec_IntEntry(vStarts, i), Vec_IntEntry(vStarts, i+1), 1 );
+    }
+    // stop threads
+    for ( i = 0; i < nProcs; i++ )
+    {
+        assert( !ThData[i].fWorking );
+        ThData[i].vOrder   = NULL;
+        ABC_FENCE();
+        ThData[i].fWorking = 1;
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    Vec_IntFree( vStarts );
+    Vec_IntFree( vOrder );
+}
+
+#endif // pthreads are used
+
+
+/**Function*************************************************************
+
+  Synopsis    [Performs full timing update of the network.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
     Abc_Obj_t * pObj;
@@ -404,13 +678,18 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     int i;
     Abc_SclComputeLoad( p );
     Abc_SclManCleanTime( p );
-    p->nEstNodes = 0;
-    Abc_NtkForEachCi( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachCo( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+    if ( p->nProcs > 1 )
+        Abc_SclTimeNtkRecomputePar( p, fReverse );
+    else
+    {
+        p->nEstNodes = 0;
+        Abc_NtkForEachCi( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+        Abc_NtkForEachNode1( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+        Abc_NtkForEachCo( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+    }
     D = Abc_SclReadMaxDelay( p );
     if ( fReverse && DUser > 0 && D < DUser )
         D = DUser;
@@ -418,7 +697,7 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
         *pArea = Abc_SclGetTotalArea(p->pNtk);
     if ( pDelay )
         *pDelay = D;
-    if ( fReverse )
+    if ( fReverse && p->nProcs <= 1 )
     {
         p->nEstNodes = 0;
         Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
@@ -630,9 +909,12 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+#ifdef ABC_USE_PTHREADS
+    p->nProcs = nProcs;
+#endif
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -668,10 +950,10 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nProcs );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -689,12 +971,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nProcs );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -899,7 +1181,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
@@ -41,10 +41,11 @@ ABC_NAMESPACE_IMPL_START
  *  Purpose: get option letter from argv.
  */
 
-const char * globalUtilOptarg;        // Global argument pointer (util_optarg)
-int    globalUtilOptind = 0;    // Global argv index (util_optind)
+// the parser state is thread-local to allow concurrent command execution in private frames
+ABC_THREAD_LOCAL const char * globalUtilOptarg;        // Global argument pointer (util_optarg)
+ABC_THREAD_LOCAL int    globalUtilOptind = 0;    // Global argv index (util_optind)
 
-static const char *pScanStr;
+static ABC_THREAD_LOCAL const char *pScanStr;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -158,7 +159,7 @@ int Extra_UtilGetopt( int argc, char *argv[], const char *optstring )
 ***********************************************************************/
 char * Extra_UtilPrintTime( long t )
 {
-    static char s[40];
+    static ABC_THREAD_LOCAL char s[40];
 
     (void) sprintf(s, "%ld.%02ld sec", t/1000, (t%1000)/10);
     return s;
@@ -57,6 +57,17 @@
 #define ABC_DLL ABC_DLLIMPORT
 #endif
 
+// storage class for the variables that have a separate copy in each thread
+#if !defined(ABC_THREAD_LOCAL)
+#if defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define ABC_THREAD_LOCAL __thread
+#else
+#define ABC_THREAD_LOCAL
+#endif
+#endif
+
 #if !defined(___unused)
 #if defined(__GNUC__)
 #define ___unused __attribute__ ((__unused__))
@@ -345,6 +356,20 @@ static inline abctime Abc_Clock()
     return (abctime) clock();
 #endif
 }
+// elapsed (wall-clock) time in the same units as Abc_Clock()
+static inline abctime Abc_TimeWall()
+{
+#if (defined(LIN) || defined(LIN64)) && !APPLE_MACH && !defined(__MINGW32__)
+    struct timespec ts;
+    if ( clock_gettime(CLOCK_MONOTONIC, &ts) < 0 ) 
+        return (abctime)-1;
+    abctime res = ((abctime) ts.tv_sec) * CLOCKS_PER_SEC;
+    res += (((abctime) ts.tv_nsec) * CLOCKS_PER_SEC) / 1000000000;
+    return res;
+#else
+    return (abctime) clock();
+#endif
+}
 
 
 // misc printing procedures
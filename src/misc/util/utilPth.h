@@ -0,0 +1,72 @@
+/**CFile****************************************************************
+
+  FileName    [utilPth.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Multi-threading utilities.]
+
+  Synopsis    [Atomic operations and memory fences used by the threaded code.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilPth.h,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#ifndef ABC__misc__util__utilPth_h
+#define ABC__misc__util__utilPth_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+#if !defined(__GNUC__) && !defined(__clang__) && defined(_WIN32)
+#include <windows.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// ABC_FETCH_ADD and ABC_CAS work on 32-bit integers, ABC_FETCH_ADD64 on 64-bit ones;
+// ABC_FETCH_ADD* return the old value; ABC_CAS returns 1 if the value was swapped;
+// ABC_FENCE is a full memory barrier, which orders the accesses to the data
+// exchanged by the threads through volatile flags
+#if defined(__GNUC__) || defined(__clang__)
+#define ABC_FETCH_ADD(p, v)     __sync_fetch_and_add(p, v)
+#define ABC_FETCH_ADD64(p, v)   __sync_fetch_and_add(p, v)
+#define ABC_CAS(p, o, n)        __sync_bool_compare_and_swap(p, o, n)
+#define ABC_FENCE()             __sync_synchronize()
+#else
+#define ABC_FETCH_ADD(p, v)     InterlockedExchangeAdd((volatile LONG *)(p), v)
+#define ABC_FETCH_ADD64(p, v)   InterlockedExchangeAdd64((volatile LONG64 *)(p), v)
+#define ABC_CAS(p, o, n)        (InterlockedCompareExchange((volatile LONG *)(p), n, o) == (o))
+#define ABC_FENCE()             MemoryBarrier()
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,268 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized bit-parallel simulation kernels.]
+
+  Synopsis    [Vectorized bit-parallel simulation kernels.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilSimd.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utilSimd.h"
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+// the vector kernels are compiled with per-function target attributes 
+// and selected at run time, so the binary still runs on any x86 CPU
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ABC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef void (*Abc_SimdFunc_t)( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords );
+
+static Abc_SimdFunc_t s_SimdAnd  = NULL;
+static Abc_SimdFunc_t s_SimdXor  = NULL;
+static const char *   s_SimdName = NULL;
+#ifdef ABC_USE_PTHREADS
+static pthread_once_t s_SimdOnce = PTHREAD_ONCE_INIT;
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Portable kernels.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdAndScalar( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+static void Abc_SimdXorScalar( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    int w;
+    for ( w = 0; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+
+#ifdef ABC_SIMD_X86
+
+/**Function*************************************************************
+
+  Synopsis    [AVX2 kernels (four words per step).]
+
+  Description [Loads and stores are unaligned, so any row of the 
+  simulation array can be passed in; the tail is done word by word.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Abc_SimdAndAvx2( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m256i d0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i d1 = _mm256_set1_epi64x( (long long)Diff1 );
+    int w = 0;
+    for ( ; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (const __m256i *)(pIn0 + w) );
+        __m256i b = _mm256_loadu_si256( (const __m256i *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_and_si256(_mm256_xor_si256(a, d0), _mm256_xor_si256(b, d1)) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx2")))
+static void Abc_SimdXorAvx2( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m256i d  = _mm256_set1_epi64x( (long long)(Diff0 ^ Diff1) );
+    int w = 0;
+    for ( ; w + 4 <= nWords; w += 4 )
+    {
+        __m256i a = _mm256_loadu_si256( (const __m256i *)(pIn0 + w) );
+        __m256i b = _mm256_loadu_si256( (const __m256i *)(pIn1 + w) );
+        _mm256_storeu_si256( (__m256i *)(pOut + w), _mm256_xor_si256(_mm256_xor_si256(a, b), d) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [AVX-512 kernels (eight words per step).]
+
+  Description [The complemented AND is a single ternary-logic operation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Abc_SimdAndAvx512( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m512i d0 = _mm512_set1_epi64( (long long)Diff0 );
+    __m512i d1 = _mm512_set1_epi64( (long long)Diff1 );
+    int w = 0;
+    for ( ; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (const void *)(pIn0 + w) );
+        __m512i b = _mm512_loadu_si512( (const void *)(pIn1 + w) );
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_and_si512(_mm512_xor_si512(a, d0), _mm512_xor_si512(b, d1)) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) & (pIn1[w] ^ Diff1);
+}
+__attribute__((target("avx512f")))
+static void Abc_SimdXorAvx512( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    __m512i d  = _mm512_set1_epi64( (long long)(Diff0 ^ Diff1) );
+    int w = 0;
+    for ( ; w + 8 <= nWords; w += 8 )
+    {
+        __m512i a = _mm512_loadu_si512( (const void *)(pIn0 + w) );
+        __m512i b = _mm512_loadu_si512( (const void *)(pIn1 + w) );
+        // 0x96 is the truth table of the three-input XOR
+        _mm512_storeu_si512( (void *)(pOut + w), _mm512_ternarylogic_epi64(a, b, d, 0x96) );
+    }
+    for ( ; w < nWords; w++ )
+        pOut[w] = (pIn0[w] ^ Diff0) ^ (pIn1[w] ^ Diff1);
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the kernels supported by the current CPU.]
+
+  Description [Called once on the first use. With threads, the selection
+  is done under pthread_once(), so that the kernels are published to all
+  threads before they are called.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SimdSelect()
+{
+    Abc_SimdFunc_t pAnd = Abc_SimdAndScalar;
+    Abc_SimdFunc_t pXor = Abc_SimdXorScalar;
+    const char * pName  = "scalar";
+#ifdef ABC_SIMD_X86
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        pAnd = Abc_SimdAndAvx512, pXor = Abc_SimdXorAvx512, pName = "avx512";
+    else if ( __builtin_cpu_supports("avx2") )
+        pAnd = Abc_SimdAndAvx2, pXor = Abc_SimdXorAvx2, pName = "avx2";
+#endif
+    s_SimdXor  = pXor;
+    s_SimdName = pName;
+    s_SimdAnd  = pAnd;
+}
+static inline void Abc_SimdInit()
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_once( &s_SimdOnce, Abc_SimdSelect );
+#else
+    if ( s_SimdAnd == NULL )
+        Abc_SimdSelect();
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates an AND/XOR node with complemented fanins.]
+
+  Description [Diff0 and Diff1 are all-0 or all-1 masks that complement
+  the corresponding fanin. Computes nWords words of the result.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SimdAnd( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    Abc_SimdInit();
+    s_SimdAnd( pOut, pIn0, pIn1, Diff0, Diff1, nWords );
+}
+void Abc_SimdXor( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords )
+{
+    Abc_SimdInit();
+    s_SimdXor( pOut, pIn0, pIn1, Diff0, Diff1, nWords );
+}
+const char * Abc_SimdName()
+{
+    Abc_SimdInit();
+    return s_SimdName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates zeroed simulation storage aligned for vector access.]
+
+  Description [The result can be released with ABC_FREE and wrapped into 
+  a vector with Vec_WrdAllocArray(). When the rows have Abc_SimdPadWords() 
+  words, each row starts on a vector boundary and has no scalar tail.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word * Abc_SimdCalloc( int nWords )
+{
+#if defined(_WIN32)
+    return ABC_CALLOC( word, nWords );
+#else
+    void * pMem = NULL;
+    if ( posix_memalign( &pMem, ABC_SIMD_ALIGN, sizeof(word) * (size_t)Abc_MaxInt(nWords, 1) ) )
+        return ABC_CALLOC( word, nWords );
+    memset( pMem, 0, sizeof(word) * (size_t)nWords );
+    return (word *)pMem;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
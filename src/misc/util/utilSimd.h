@@ -0,0 +1,69 @@
+/**CFile****************************************************************
+
+  FileName    [utilSimd.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Vectorized bit-parallel simulation kernels.]
+
+  Synopsis    [Vectorized bit-parallel simulation kernels.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: utilSimd.h,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+ 
+#ifndef ABC__misc__util__utilSimd_h
+#define ABC__misc__util__utilSimd_h
+
+////////////////////////////////////////////////////////////////////////
+///                          INCLUDES                                ///
+////////////////////////////////////////////////////////////////////////
+
+#include "misc/util/abc_global.h"
+
+////////////////////////////////////////////////////////////////////////
+///                         PARAMETERS                               ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_HEADER_START
+
+// below this number of words, the inlined scalar loop is faster than a call
+#define ABC_SIMD_MIN_WORDS  16
+// alignment (in bytes) of the simulation storage
+#define ABC_SIMD_ALIGN      64
+// the number of words in the widest vector (rows are padded to this size)
+#define ABC_SIMD_WORDS      (ABC_SIMD_ALIGN / 8)
+
+////////////////////////////////////////////////////////////////////////
+///                         BASIC TYPES                              ///
+////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+///                      MACRO DEFINITIONS                           ///
+////////////////////////////////////////////////////////////////////////
+
+// rounds the number of words in a row up to a whole vector width
+static inline int   Abc_SimdPadWords( int nWords ) { return (nWords + ABC_SIMD_WORDS - 1) / ABC_SIMD_WORDS * ABC_SIMD_WORDS; }
+
+////////////////////////////////////////////////////////////////////////
+///                    FUNCTION DECLARATIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/*=== utilSimd.c ==========================================================*/
+
+extern void         Abc_SimdAnd( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords );
+extern void         Abc_SimdXor( word * pOut, word * pIn0, word * pIn1, word Diff0, word Diff1, int nWords );
+extern word *       Abc_SimdCalloc( int nWords );
+extern const char * Abc_SimdName();
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
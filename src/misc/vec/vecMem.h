@@ -244,6 +244,29 @@ static inline void Vec_MemPush( Vec_Mem_t * p, word * pEntry )
     memmove( pPlace, pEntry, sizeof(word) * (size_t)p->nEntrySize );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reserves the page table for the given number of entries.]
+
+  Description [Until the number of entries exceeds nEntries, the page
+  table is not reallocated, so the existing entries can be read while
+  new ones are added.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Vec_MemReserve( Vec_Mem_t * p, int nEntries )
+{
+    int nPages = (nEntries >> p->LogPageSze) + 1;
+    if ( p->nPageAlloc >= nPages )
+        return;
+    nPages = Abc_MaxInt( nPages, 2 * p->nPageAlloc );
+    p->ppPages = ABC_REALLOC( word *, p->ppPages, nPages );
+    p->nPageAlloc = nPages;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
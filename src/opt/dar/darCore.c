@@ -58,6 +58,7 @@ void Dar_ManDefaultRwrParams( Dar_RwrPar_t * pPars )
     pPars->fUseZeros    =  0;
     pPars->fPower       =  0;
     pPars->fRecycle     =  1;
+    pPars->nProcs       =  0;
     pPars->fVerbose     =  0;
     pPars->fVeryVerbose =  0;
 }
@@ -86,6 +87,8 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     abctime clk = 0, clkStart;
     int Counter = 0;
     int nMffcSize;//, nMffcGains[MAX_VAL+1][MAX_VAL+1] = {{0}};
+    if ( pPars->nProcs > 1 && !pPars->fPower )
+        return Dar_ManRewritePar( pAig, pPars );
     // prepare the library
     Dar_LibPrepare( pPars->nSubgMax ); 
     // create rewriting manager
@@ -97,7 +100,7 @@ int Dar_ManRewrite( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
     // if updating levels is requested, start fanout and timing
     if ( p->pPars->fFanout )
         Aig_ManFanoutStart( pAig );
-    if ( p->pPars->fUpdateLevel )
+    if ( p->pPars->fUpdateLevel && pAig->vLevelR == NULL ) // reverse levels may be given by the caller
         Aig_ManStartReverseLevels( pAig, 0 );
     // set elementary cuts for the PIs
 //    Dar_ManCutsStart( p );
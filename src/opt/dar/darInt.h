@@ -151,6 +151,8 @@ extern Aig_Obj_t *     Dar_LibBuildBest( Dar_Man_t * p );
 extern Dar_Man_t *     Dar_ManStart( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 extern void            Dar_ManStop( Dar_Man_t * p );
 extern void            Dar_ManPrintStats( Dar_Man_t * p );
+/*=== darPar.c ============================================================*/
+extern int             Dar_ManRewritePar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars );
 /*=== darPrec.c ============================================================*/
 extern char **         Dar_Permutations( int n );
 extern void            Dar_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap );
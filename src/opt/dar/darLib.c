@@ -22,6 +22,16 @@
 #include "aig/gia/gia.h"
 #include "dar.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -103,9 +113,19 @@ struct Dar_Lib_t_ // library
     char *           pPhases; 
     char *           pPerms; 
     unsigned char *  pMap;
+    // the library whose read-only tables are used
+    Dar_Lib_t *      pShared;
 };
 
-static Dar_Lib_t * s_DarLib = NULL;
+static ABC_THREAD_LOCAL Dar_Lib_t * s_DarLib = NULL; // separate library in each thread
+static Dar_Lib_t *      s_DarLibShared = NULL;      // read-only tables shared by the threads
+static int              s_DarLibRefs = 0;           // the number of threads using the shared tables
+
+#ifdef ABC_USE_PTHREADS
+static pthread_once_t   s_DarLibOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t    s_DarLibKey;        // frees the library of a thread when it exits
+static pthread_mutex_t  s_DarLibMutex = PTHREAD_MUTEX_INITIALIZER; // protects the shared tables
+#endif
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -163,6 +183,16 @@ Dar_Lib_t * Dar_LibAlloc( int nObjs )
 ***********************************************************************/
 void Dar_LibFree( Dar_Lib_t * p )
 {
+    if ( p->pShared )
+    {
+        // the working copy owns only the arrays updated during rewriting
+        ABC_FREE( p->pObjs );
+        ABC_FREE( p->pDatas );
+        ABC_FREE( p->pNodes0Mem );
+        ABC_FREE( p->pSubgr0Mem );
+        ABC_FREE( p );
+        return;
+    }
     ABC_FREE( p->pObjs );
     ABC_FREE( p->pDatas );
     ABC_FREE( p->pNodesMem );
@@ -193,6 +223,8 @@ void Dar_LibFree( Dar_Lib_t * p )
 ***********************************************************************/
 int Dar_LibReturnClass( unsigned uTruth )
 {
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
     return s_DarLib->pMap[uTruth & 0xffff];
 }
 
@@ -212,6 +244,8 @@ void Dar_LibReturnCanonicals( unsigned * pCanons )
 {
     int Visits[222] = {0};
     int i, k;
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
     // find canonical truth tables
     for ( i = k = 0; i < (1<<16); i++ )
         if ( !Visits[s_DarLib->pMap[i]] )
@@ -477,8 +511,11 @@ void Dar_LibSetup0_rec( Dar_Lib_t * p, Dar_LibObj_t * pObj, int Class, int fColl
 ***********************************************************************/
 void Dar_LibPrepare( int nSubgraphs )
 {
-    Dar_Lib_t * p = s_DarLib;
+    Dar_Lib_t * p;
     int i, k, nNodes0Total;
+    if ( s_DarLib == NULL )
+        Dar_LibStart();
+    p = s_DarLib;
     if ( p->nSubgraphs == nSubgraphs )
         return;
 
@@ -579,24 +616,112 @@ Dar_Lib_t * Dar_LibRead()
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the library for use in one thread.]
+
+  Description [The copy points to the read-only tables of the original
+  and allocates only the arrays that are changed by Dar_LibPrepare()
+  and by rewriting.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Dar_Lib_t * Dar_LibDup( Dar_Lib_t * pLib )
+{
+    Dar_Lib_t * p;
+    int i;
+    assert( pLib->pPlaceMem == NULL && pLib->pScoreMem == NULL ); // no training
+    p = ABC_ALLOC( Dar_Lib_t, 1 );
+    memcpy( p, pLib, sizeof(Dar_Lib_t) );
+    p->pShared = pLib;
+    p->pObjs = ABC_ALLOC( Dar_LibObj_t, pLib->nObjs );
+    memcpy( p->pObjs, pLib->pObjs, sizeof(Dar_LibObj_t) * pLib->nObjs );
+    p->pSubgr0Mem = ABC_ALLOC( int, pLib->nSubgrTotal );
+    p->pNodes0Mem = ABC_ALLOC( int, pLib->nNodesTotal );
+    for ( i = 0; i < 222; i++ )
+    {
+        p->pSubgr0[i] = p->pSubgr0Mem + (pLib->pSubgr0[i] - pLib->pSubgr0Mem);
+        p->pNodes0[i] = p->pNodes0Mem + (pLib->pNodes0[i] - pLib->pNodes0Mem);
+    }
+    p->pDatas = NULL;
+    p->nDatas = 0;
+    p->nSubgraphs = 0;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the library of one thread.]
+
+  Description [The shared tables are freed when the last thread releases them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_LibRelease( Dar_Lib_t * p )
+{
+    Dar_LibFree( p );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_DarLibMutex );
+#endif
+    assert( s_DarLibRefs > 0 );
+    if ( --s_DarLibRefs == 0 )
+    {
+        Dar_LibFree( s_DarLibShared );
+        s_DarLibShared = NULL;
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_DarLibMutex );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    [Starts the library.]
 
-  Description []
+  Description [The library is read once and shared by all threads. Each
+  thread works with its own copy, which is started on demand and freed
+  by Dar_LibStop() or when the thread exits.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+static void Dar_LibThreadExit( void * pLib )
+{
+    Dar_LibRelease( (Dar_Lib_t *)pLib );
+}
+static void Dar_LibKeyStart()
+{
+    pthread_key_create( &s_DarLibKey, Dar_LibThreadExit );
+}
+#endif
 void Dar_LibStart()
 {
 //    abctime clk = Abc_Clock();
     if ( s_DarLib != NULL )
         return;
     assert( s_DarLib == NULL );
-    s_DarLib = Dar_LibRead();
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &s_DarLibMutex );
+#endif
+    if ( s_DarLibShared == NULL )
+        s_DarLibShared = Dar_LibRead();
+    s_DarLibRefs++;
+    s_DarLib = Dar_LibDup( s_DarLibShared );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_DarLibMutex );
+    // the library is freed when the thread exits without calling Dar_LibStop()
+    pthread_once( &s_DarLibOnce, Dar_LibKeyStart );
+    pthread_setspecific( s_DarLibKey, s_DarLib );
+#endif
 //    printf( "The 4-input library started with %d nodes and %d subgraphs. ", s_DarLib->nObjs - 4, s_DarLib->nSubgrTotal );
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
@@ -614,8 +739,12 @@ void Dar_LibStart()
 ***********************************************************************/
 void Dar_LibStop()
 {
-    assert( s_DarLib != NULL );
-    Dar_LibFree( s_DarLib );
+    if ( s_DarLib == NULL )
+        return;
+#ifdef ABC_USE_PTHREADS
+    pthread_setspecific( s_DarLibKey, NULL );
+#endif
+    Dar_LibRelease( s_DarLib );
     s_DarLib = NULL;
 }
 
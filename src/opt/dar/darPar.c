@@ -0,0 +1,393 @@
+/**CFile****************************************************************
+
+  FileName    [darPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware AIG rewriting.]
+
+  Synopsis    [Partitioned rewriting using several threads.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: darPar.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "darInt.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+/*
+    The internal nodes are divided into slices of the topological order.
+    The fanins of a slice coming from outside become the inputs of its
+    partition and the nodes used outside of the slice become the outputs.
+    The partitions are rewritten independently by the threads, each of them
+    using its own copy of the library (s_DarLib is thread-local), while
+    the boundary nodes are kept. The rewritten partitions are then added
+    to the original manager in the topological order and the COs are
+    redirected to the new nodes. When levels are preserved, the outputs
+    of a partition are not allowed to become deeper, so the depth of the
+    AIG does not increase. The partitioning does not depend on the number
+    of threads, so the result is the same for any number of threads.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DAR_PAR_THR_MAX   64         // the largest number of threads
+#define DAR_PAR_SIZE   20000         // the number of nodes in one partition
+
+typedef struct Dar_ParMan_t_ Dar_ParMan_t;
+typedef struct Dar_ParTh_t_ Dar_ParTh_t;
+struct Dar_ParTh_t_
+{
+    Dar_ParMan_t *  pMan;            // the manager
+    Dar_RwrPar_t    Pars;            // the parameters of this thread
+};
+
+struct Dar_ParMan_t_
+{
+    int             nParts;          // the number of partitions
+    volatile int    iPartNext;       // the next partition to be given to a thread
+    Aig_Man_t **    pParts;          // the partitions
+    int             nProcs;          // the number of threads
+    Dar_ParTh_t     Th[DAR_PAR_THR_MAX];
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the inputs and the outputs of the partitions.]
+
+  Description [The partition of the node is given by its position in
+  the topological order.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManParBoundary( Aig_Man_t * p, Vec_Ptr_t * vNodes, Vec_Wec_t * vIns, Vec_Wec_t * vOuts )
+{
+    Vec_Int_t * vPart  = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    Vec_Int_t * vStamp = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    Aig_Obj_t * pObj, * pFanin;
+    int i, k, iPart, iPartFanin;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        Vec_IntWriteEntry( vPart, pObj->Id, i / DAR_PAR_SIZE );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+    {
+        iPart = i / DAR_PAR_SIZE;
+        for ( k = 0; k < 2; k++ )
+        {
+            pFanin = k ? Aig_ObjFanin1(pObj) : Aig_ObjFanin0(pObj);
+            if ( Aig_ObjIsConst1(pFanin) )
+                continue;
+            iPartFanin = Vec_IntEntry( vPart, pFanin->Id );
+            if ( iPartFanin == iPart )
+                continue;
+            if ( Vec_IntEntry(vStamp, pFanin->Id) != iPart )
+            {
+                Vec_IntWriteEntry( vStamp, pFanin->Id, iPart );
+                Vec_WecPush( vIns, iPart, pFanin->Id );
+            }
+            if ( iPartFanin >= 0 && !pFanin->fMarkA )
+            {
+                pFanin->fMarkA = 1;
+                Vec_WecPush( vOuts, iPartFanin, pFanin->Id );
+            }
+        }
+    }
+    Aig_ManForEachCo( p, pObj, i )
+    {
+        pFanin = Aig_ObjFanin0(pObj);
+        if ( Aig_ObjIsNode(pFanin) && !pFanin->fMarkA )
+        {
+            pFanin->fMarkA = 1;
+            Vec_WecPush( vOuts, Vec_IntEntry(vPart, pFanin->Id), pFanin->Id );
+        }
+    }
+    Aig_ManCleanMarkA( p );
+    Vec_IntFree( vPart );
+    Vec_IntFree( vStamp );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the reverse levels of the partition.]
+
+  Description [The required level of each output is its current level.
+  The reverse levels of the COs are not recomputed by the incremental
+  update in Aig_ManUpdateReverseLevel(), so this constraint holds during
+  rewriting.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManParStartReverseLevels( Aig_Man_t * p )
+{
+    Aig_Obj_t * pObj;
+    int i, LevelR;
+    assert( p->vLevelR == NULL );
+    p->nLevelMax = Aig_ManLevels( p );
+    p->vLevelR = Vec_IntStart( Aig_ManObjNumMax(p) );
+    Aig_ManForEachCo( p, pObj, i )
+    {
+        LevelR = p->nLevelMax - Aig_ObjFanin0(pObj)->Level;
+        Vec_IntWriteEntry( p->vLevelR, pObj->Id, LevelR );
+        Vec_IntUpdateEntry( p->vLevelR, Aig_ObjFaninId0(pObj), LevelR + 1 );
+    }
+    // the nodes were created in the topological order
+    for ( i = Aig_ManObjNumMax(p) - 1; i >= 0; i-- )
+    {
+        pObj = Aig_ManObj( p, i );
+        if ( pObj == NULL || !Aig_ObjIsNode(pObj) )
+            continue;
+        LevelR = Vec_IntEntry( p->vLevelR, i );
+        Vec_IntUpdateEntry( p->vLevelR, Aig_ObjFaninId0(pObj), LevelR + 1 );
+        Vec_IntUpdateEntry( p->vLevelR, Aig_ObjFaninId1(pObj), LevelR + 1 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives one partition.]
+
+  Description [The inputs keep the levels they have in the original AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Man_t * Dar_ManParExtract( Aig_Man_t * p, Vec_Ptr_t * vNodes, int iBeg, int iEnd, Vec_Int_t * vIns, Vec_Int_t * vOuts, int fUpdateLevel )
+{
+    Aig_Man_t * pNew;
+    Aig_Obj_t * pObj, * pObjNew;
+    int i, Id;
+    pNew = Aig_ManStart( iEnd - iBeg );
+    pNew->Time2Quit = p->Time2Quit;
+    Aig_ManConst1(p)->pData = Aig_ManConst1(pNew);
+    Vec_IntForEachEntry( vIns, Id, i )
+    {
+        pObj = Aig_ManObj( p, Id );
+        pObjNew = Aig_ObjCreateCi( pNew );
+        pObjNew->Level = pObj->Level;
+        pObj->pData = pObjNew;
+    }
+    for ( i = iBeg; i < iEnd; i++ )
+    {
+        pObj = (Aig_Obj_t *)Vec_PtrEntry( vNodes, i );
+        pObj->pData = Aig_And( pNew, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+    }
+    Vec_IntForEachEntry( vOuts, Id, i )
+        Aig_ObjCreateCo( pNew, (Aig_Obj_t *)Aig_ManObj(p, Id)->pData );
+    if ( fUpdateLevel )
+        Dar_ManParStartReverseLevels( pNew );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the rewritten partition to the original AIG.]
+
+  Description [Records the new functions of the partition outputs in vCopy.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManParInsert( Aig_Man_t * p, Aig_Man_t * pPart, Vec_Int_t * vIns, Vec_Int_t * vOuts, Vec_Ptr_t * vCopy )
+{
+    Vec_Ptr_t * vNodes;
+    Aig_Obj_t * pObj;
+    int i;
+    Aig_ManConst1(pPart)->pData = Aig_ManConst1(p);
+    Aig_ManForEachCi( pPart, pObj, i )
+        pObj->pData = Vec_PtrEntry( vCopy, Vec_IntEntry(vIns, i) );
+    vNodes = Aig_ManDfs( pPart, 1 );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        pObj->pData = Aig_And( p, Aig_ObjChild0Copy(pObj), Aig_ObjChild1Copy(pObj) );
+    Vec_PtrFree( vNodes );
+    Aig_ManForEachCo( pPart, pObj, i )
+        Vec_PtrWriteEntry( vCopy, Vec_IntEntry(vOuts, i), Aig_ObjChild0Copy(pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the partitions in one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Dar_ManParThreadRun( Dar_ParTh_t * pTh )
+{
+    Dar_ParMan_t * pMan = pTh->pMan;
+    int iPart;
+    while ( (iPart = ABC_FETCH_ADD(&pMan->iPartNext, 1)) < pMan->nParts )
+        Dar_ManRewrite( pMan->pParts[iPart], &pTh->Pars );
+}
+
+#ifdef ABC_USE_PTHREADS
+static void * Dar_ManParThread( void * pArg )
+{
+    Dar_ManParThreadRun( (Dar_ParTh_t *)pArg );
+    Dar_LibStop(); // the library is started on demand in each thread
+    return NULL;
+}
+#endif
+
+static void Dar_ManParRun( Dar_ParMan_t * pMan )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[DAR_PAR_THR_MAX];
+    int status;
+#endif
+    int i;
+    pMan->iPartNext = 0;
+#ifdef ABC_USE_PTHREADS
+    for ( i = 1; i < pMan->nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Dar_ManParThread, (void *)(pMan->Th + i) );  assert( status == 0 );
+    }
+#endif
+    Dar_ManParThreadRun( pMan->Th );
+#ifdef ABC_USE_PTHREADS
+    for ( i = 1; i < pMan->nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs partitioned rewriting using several threads.]
+
+  Description [Has the same interface as Dar_ManRewrite(), which calls it
+  when the number of threads is more than one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dar_ManRewritePar( Aig_Man_t * pAig, Dar_RwrPar_t * pPars )
+{
+    Dar_ParMan_t * pMan;
+    Vec_Ptr_t * vNodes, * vCopy, * vDrivers;
+    Vec_Wec_t * vIns, * vOuts;
+    Aig_Obj_t * pObj, * pDriver;
+    int i, nNodesOld;
+    abctime clk = Abc_Clock();
+    assert( pPars->nProcs > 1 && !pPars->fPower );
+    Aig_ManCleanup( pAig );
+    nNodesOld = Aig_ManNodeNum( pAig );
+    vNodes = Aig_ManDfs( pAig, 1 );
+    if ( Vec_PtrSize(vNodes) <= DAR_PAR_SIZE )
+    {
+        Dar_RwrPar_t Pars = *pPars;
+        Vec_PtrFree( vNodes );
+        Pars.nProcs = 0;
+        return Dar_ManRewrite( pAig, &Pars );
+    }
+    // derive the partitions
+    pMan = ABC_CALLOC( Dar_ParMan_t, 1 );
+    pMan->nParts = (Vec_PtrSize(vNodes) + DAR_PAR_SIZE - 1) / DAR_PAR_SIZE;
+    pMan->nProcs = Abc_MinInt( Abc_MinInt(pPars->nProcs, DAR_PAR_THR_MAX), pMan->nParts );
+    pMan->pParts = ABC_CALLOC( Aig_Man_t *, pMan->nParts );
+    vIns  = Vec_WecStart( pMan->nParts );
+    vOuts = Vec_WecStart( pMan->nParts );
+    Dar_ManParBoundary( pAig, vNodes, vIns, vOuts );
+    for ( i = 0; i < pMan->nParts; i++ )
+        pMan->pParts[i] = Dar_ManParExtract( pAig, vNodes, i * DAR_PAR_SIZE, Abc_MinInt((i+1) * DAR_PAR_SIZE, Vec_PtrSize(vNodes)),
+            Vec_WecEntry(vIns, i), Vec_WecEntry(vOuts, i), pPars->fUpdateLevel );
+    Vec_PtrFree( vNodes );
+    // rewrite the partitions
+    for ( i = 0; i < pMan->nProcs; i++ )
+    {
+        pMan->Th[i].pMan = pMan;
+        pMan->Th[i].Pars = *pPars;
+        pMan->Th[i].Pars.nProcs = 0;
+        pMan->Th[i].Pars.fVerbose = 0;
+        pMan->Th[i].Pars.fVeryVerbose = 0;
+    }
+    Dar_ManParRun( pMan );
+    // add the partitions to the original AIG
+    vCopy = Vec_PtrStart( Aig_ManObjNumMax(pAig) );
+    Vec_PtrWriteEntry( vCopy, 0, Aig_ManConst1(pAig) );
+    Aig_ManForEachCi( pAig, pObj, i )
+        Vec_PtrWriteEntry( vCopy, pObj->Id, pObj );
+    for ( i = 0; i < pMan->nParts; i++ )
+    {
+        Dar_ManParInsert( pAig, pMan->pParts[i], Vec_WecEntry(vIns, i), Vec_WecEntry(vOuts, i), vCopy );
+        Aig_ManStop( pMan->pParts[i] );
+    }
+    // redirect the COs while the new drivers are referenced,
+    // so that they are not removed together with the old logic
+    vDrivers = Vec_PtrAlloc( Aig_ManCoNum(pAig) );
+    Aig_ManForEachCo( pAig, pObj, i )
+    {
+        pDriver = Aig_NotCond( (Aig_Obj_t *)Vec_PtrEntry(vCopy, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj) );
+        Aig_ObjRef( Aig_Regular(pDriver) );
+        Vec_PtrPush( vDrivers, pDriver );
+    }
+    Aig_ManForEachCo( pAig, pObj, i )
+        if ( Aig_ObjChild0(pObj) != (Aig_Obj_t *)Vec_PtrEntry(vDrivers, i) )
+            Aig_ObjPatchFanin0( pAig, pObj, (Aig_Obj_t *)Vec_PtrEntry(vDrivers, i) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vDrivers, pDriver, i )
+        Aig_ObjDeref( Aig_Regular(pDriver) );
+    Aig_ManCleanup( pAig );
+    if ( pPars->fVerbose )
+    {
+        printf( "Partitions = %d. Threads = %d. Nodes: %d -> %d.  ",
+            pMan->nParts, pMan->nProcs, nNodesOld, Aig_ManNodeNum(pAig) );
+        ABC_PRT( "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFree( vDrivers );
+    Vec_PtrFree( vCopy );
+    Vec_WecFree( vIns );
+    Vec_WecFree( vOuts );
+    ABC_FREE( pMan->pParts );
+    ABC_FREE( pMan );
+    Aig_ManCheckPhase( pAig );
+    if ( !Aig_ManCheck( pAig ) )
+    {
+        printf( "Dar_ManRewritePar: The network check has failed.\n" );
+        return 0;
+    }
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
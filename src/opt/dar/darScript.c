@@ -225,14 +225,14 @@ Aig_Man_t * Dar_ManCompress( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, i
 
   Synopsis    [Reproduces script "compress2".]
 
-  Description []
+  Description [Rewriting uses nProcs threads (0 or 1 means no threading).]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+Aig_Man_t * Dar_ManCompress2Par( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int nProcs, int fVerbose )
 //alias compress2   "b -l; rw -l; rf -l; b -l; rw -l; rwz -l; b -l; rfz -l; rwz -l; b -l"
 {
     Aig_Man_t * pTemp;
@@ -247,6 +247,7 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     pParsRef->fUpdateLevel = fUpdateLevel;
     pParsRwr->fFanout = fFanout;
     pParsRwr->fPower = fPower;
+    pParsRwr->nProcs = nProcs;
 
     pParsRwr->fVerbose = 0;//fVerbose;
     pParsRef->fVerbose = 0;//fVerbose;
@@ -331,6 +332,22 @@ Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel,
     return pAig;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Reproduces script "compress2".]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Dar_ManCompress2( Aig_Man_t * pAig, int fBalance, int fUpdateLevel, int fFanout, int fPower, int fVerbose )
+{
+    return Dar_ManCompress2Par( pAig, fBalance, fUpdateLevel, fFanout, fPower, 0, fVerbose );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reproduces script "compress2".]
@@ -76,6 +76,13 @@ static inline int Dau_DsdReadVar( char * p )  { if ( *p == '!' ) p++; return *p
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== dauCache.c ==========================================================*/
+extern void          Abc_TtCacheStart( char * pFileName );
+extern void          Abc_TtCacheStop();
+extern int           Abc_TtCacheIsUsed( int nVars );
+extern int           Abc_TtCacheLookup( word * pTruth, int nVars, char * pCanonPerm, unsigned * puCanonPhase );
+extern void          Abc_TtCacheInsert( word * pTruth, word * pCanon, int nVars, char * pCanonPerm, unsigned uCanonPhase );
+extern void          Abc_TtCachePrintStats();
 /*=== dauCanon.c ==========================================================*/
 extern unsigned      Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm );
 extern unsigned      Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm );
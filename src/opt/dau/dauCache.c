@@ -0,0 +1,521 @@
+/**CFile****************************************************************
+
+  FileName    [dauCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Persistent cache of NPN canonical forms.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: dauCache.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache file starts with an 8-byte magic word, followed by records.
+// Each record is a sequence of 64-bit words in the native byte order:
+//     word 0         : canonical phase (bits 0-31) and the number of variables (bits 32-39)
+//     words 1-2      : canonical permutation (one char per variable)
+//     nWords words   : the original truth table (the key)
+//     nWords words   : the canonical truth table
+// The records of the file are mapped into memory read-only. The records
+// derived in the current run are kept in separate arrays and appended
+// to the file when the cache is stopped.
+//
+// The records are distributed among shards by the top bits of the hash
+// value. Each shard has its own hash table, new records, and lock, so that 
+// the mappers running in parallel rarely wait for each other.
+//
+// There is one cache per process. It is started and stopped together with
+// the framework (see Abc_Start/Abc_Stop), while no other thread uses it.
+
+#define DAU_CACHE_MAGIC    ABC_CONST(0x31434E504E434241)   // "ABCNPNC1"
+#define DAU_CACHE_MAX_VAR  10
+#define DAU_CACHE_SHARDS   16
+
+typedef struct Dau_Shard_t_ Dau_Shard_t;
+struct Dau_Shard_t_
+{
+    Vec_Wrd_t *    vNew;        // records derived in this run
+    int *          pTable;      // hash table of record offsets (offset + 1)
+    int            nTableMask;  // hash table mask
+    int            nEntries;    // the number of records in the hash table
+    int            nNew;        // the number of records derived in this run
+    int            nLookups;    // statistics
+    int            nHits;       // statistics
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;      // protects the shard when mappers run in parallel
+#endif
+};
+
+typedef struct Dau_Cache_t_ Dau_Cache_t;
+struct Dau_Cache_t_
+{
+    char *         pFileName;   // cache file name
+    word *         pMap;        // records of the file (including the magic word)
+    int            nMapWords;   // the number of valid words in the file
+    int            nFileSize;   // the size of the mapped file in bytes
+    int            fMapped;     // the file contents are memory-mapped
+    int            fRewrite;    // the file has a damaged tail and should be rewritten
+    Dau_Shard_t *  pShards[DAU_CACHE_SHARDS]; // the shards
+};
+
+static Dau_Cache_t * s_DauCache = NULL;
+
+// the offsets below nMapWords point to the file; others point to the shard's new records
+static inline int    Dau_CacheRecSize( int nVars )                { return 3 + 2 * Abc_TtWordNum(nVars);                                                   }
+static inline word * Dau_CacheRec( Dau_Cache_t * p, Dau_Shard_t * pShard, int Offset )  { return Offset < p->nMapWords ? p->pMap + Offset : Vec_WrdEntryP(pShard->vNew, Offset - p->nMapWords); }
+static inline int    Dau_CacheRecVars( word * pRec )              { return (int)((pRec[0] >> 32) & 0xFF);                                                 }
+
+static inline void Dau_CacheLock( Dau_Shard_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &p->Mutex );
+#endif
+}
+static inline void Dau_CacheUnlock( Dau_Shard_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &p->Mutex );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Hashing of truth tables.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Dau_CacheHash( word * pTruth, int nVars )
+{
+    int i, nWords = Abc_TtWordNum( nVars );
+    word Key = (word)nVars * ABC_CONST(0x9E3779B97F4A7C15);
+    for ( i = 0; i < nWords; i++ )
+    {
+        Key ^= pTruth[i];
+        Key *= ABC_CONST(0xFF51AFD7ED558CCD);
+        Key ^= Key >> 33;
+    }
+    return (unsigned)Key;
+}
+static inline Dau_Shard_t * Dau_CacheShard( Dau_Cache_t * p, unsigned Hash )
+{
+    return p->pShards[Hash >> 28];
+}
+static inline int * Dau_CacheFind( Dau_Cache_t * p, Dau_Shard_t * pShard, word * pTruth, int nVars, unsigned Hash )
+{
+    int nWords = Abc_TtWordNum( nVars );
+    int * pPlace = pShard->pTable + (Hash & pShard->nTableMask);
+    for ( ; *pPlace; pPlace = pShard->pTable + ((pPlace - pShard->pTable + 1) & pShard->nTableMask) )
+    {
+        word * pRec = Dau_CacheRec( p, pShard, *pPlace - 1 );
+        if ( Dau_CacheRecVars(pRec) == nVars && Abc_TtEqual(pRec + 3, pTruth, nWords) )
+            break;
+    }
+    return pPlace;
+}
+static void Dau_CacheResize( Dau_Cache_t * p, Dau_Shard_t * pShard )
+{
+    int * pOld = pShard->pTable, nOld = pShard->nTableMask + 1, i;
+    pShard->nTableMask = 2 * nOld - 1;
+    pShard->pTable = ABC_CALLOC( int, 2 * nOld );
+    for ( i = 0; i < nOld; i++ )
+        if ( pOld[i] )
+        {
+            word * pRec = Dau_CacheRec( p, pShard, pOld[i] - 1 );
+            int nVars = Dau_CacheRecVars( pRec );
+            *Dau_CacheFind( p, pShard, pRec + 3, nVars, Dau_CacheHash(pRec + 3, nVars) ) = pOld[i];
+        }
+    ABC_FREE( pOld );
+}
+static void Dau_CacheAdd( Dau_Cache_t * p, Dau_Shard_t * pShard, int Offset, unsigned Hash )
+{
+    word * pRec = Dau_CacheRec( p, pShard, Offset );
+    int * pPlace = Dau_CacheFind( p, pShard, pRec + 3, Dau_CacheRecVars(pRec), Hash );
+    if ( *pPlace ) // duplicated record (the file was appended by several runs)
+        return;
+    *pPlace = Offset + 1;
+    if ( ++pShard->nEntries > (pShard->nTableMask + 1) / 2 )
+        Dau_CacheResize( p, pShard );
+}
+static void Dau_CacheFree( Dau_Cache_t * p )
+{
+    int i;
+    for ( i = 0; i < DAU_CACHE_SHARDS; i++ )
+    {
+        Dau_Shard_t * pShard = p->pShards[i];
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_destroy( &pShard->Mutex );
+#endif
+        Vec_WrdFree( pShard->vNew );
+        ABC_FREE( pShard->pTable );
+        ABC_FREE( pShard );
+    }
+    ABC_FREE( p->pFileName );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the cache file into memory.]
+
+  Description [Falls back to reading the file if mapping is not available.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word * Dau_CacheMapFile( char * pFileName, int * pnFileSize, int * pfMapped )
+{
+    word * pContents;
+    FILE * pFile;
+    int nFileSize, nWords;
+#ifndef _WIN32
+    struct stat Stat;
+    int Fd = open( pFileName, O_RDONLY );
+    if ( Fd == -1 )
+        return NULL;
+    if ( fstat( Fd, &Stat ) == 0 && S_ISREG(Stat.st_mode) && Stat.st_size >= 8 && Stat.st_size <= 0x7FFFFFF8 )
+    {
+        pContents = (word *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, Fd, 0 );
+        if ( pContents != (word *)MAP_FAILED )
+        {
+            close( Fd );
+            *pnFileSize = (int)Stat.st_size;
+            *pfMapped = 1;
+            return pContents;
+        }
+    }
+    close( Fd );
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = (int)ftell( pFile );
+    rewind( pFile );
+    if ( nFileSize < 8 )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    pContents = ABC_ALLOC( word, nFileSize / 8 );
+    nWords = (int)fread( pContents, 8, nFileSize / 8, pFile );
+    fclose( pFile );
+    *pnFileSize = nWords == nFileSize / 8 ? nFileSize : 8 * nWords;
+    *pfMapped = 0;
+    return pContents;
+}
+static void Dau_CacheUnmapFile( Dau_Cache_t * p )
+{
+    if ( p->pMap == NULL )
+        return;
+#ifndef _WIN32
+    if ( p->fMapped )
+        munmap( p->pMap, (size_t)p->nFileSize );
+    else
+#endif
+        ABC_FREE( p->pMap );
+    p->pMap = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the cache.]
+
+  Description [Loads the records of the cache file, if it exists.
+  The cache is started only once; repeated calls do nothing.
+  If the file name is NULL, the cache is not started.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtCacheStart( char * pFileName )
+{
+    Dau_Cache_t * p;
+    int i, Offset, nRecWords;
+    if ( s_DauCache != NULL || pFileName == NULL || pFileName[0] == 0 )
+        return;
+    p = ABC_CALLOC( Dau_Cache_t, 1 );
+    p->pFileName  = Abc_UtilStrsav( pFileName );
+    for ( i = 0; i < DAU_CACHE_SHARDS; i++ )
+    {
+        Dau_Shard_t * pShard = p->pShards[i] = ABC_CALLOC( Dau_Shard_t, 1 );
+        pShard->vNew       = Vec_WrdAlloc( 1 << 8 );
+        pShard->nTableMask = (1 << 8) - 1;
+        pShard->pTable     = ABC_CALLOC( int, pShard->nTableMask + 1 );
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_init( &pShard->Mutex, NULL );
+#endif
+    }
+    p->pMap = Dau_CacheMapFile( pFileName, &p->nFileSize, &p->fMapped );
+    if ( p->pMap && p->pMap[0] != DAU_CACHE_MAGIC )
+    {
+        printf( "Abc_TtCacheStart(): File \"%s\" is not an NPN cache file. The cache is not used.\n", pFileName );
+        Dau_CacheUnmapFile( p );
+        Dau_CacheFree( p );
+        return;
+    }
+    if ( p->pMap )
+    {
+        // index the records; stop at the first damaged one
+        int nWords = p->nFileSize / 8;
+        p->nMapWords = nWords; // the records of the file are recognized while indexing
+        for ( Offset = 1; Offset < nWords; Offset += nRecWords )
+        {
+            int nVars = Dau_CacheRecVars( p->pMap + Offset );
+            unsigned Hash;
+            if ( nVars > DAU_CACHE_MAX_VAR )
+                break;
+            nRecWords = Dau_CacheRecSize( nVars );
+            if ( Offset + nRecWords > nWords )
+                break;
+            Hash = Dau_CacheHash( p->pMap + Offset + 3, nVars );
+            Dau_CacheAdd( p, Dau_CacheShard(p, Hash), Offset, Hash );
+        }
+        p->nMapWords = Offset;
+        p->nMapWords = Abc_MaxInt( p->nMapWords, 1 );
+        p->fRewrite  = (8 * p->nMapWords != p->nFileSize);
+    }
+    s_DauCache = p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the cache.]
+
+  Description [Appends the records derived in this run to the file.
+  If the file had a damaged tail, it is rewritten.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtCacheStop()
+{
+    Dau_Cache_t * p = s_DauCache;
+    FILE * pFile;
+    int i, nNewWords = 0;
+    if ( p == NULL )
+        return;
+    s_DauCache = NULL;
+    for ( i = 0; i < DAU_CACHE_SHARDS; i++ )
+        nNewWords += Vec_WrdSize(p->pShards[i]->vNew);
+    if ( nNewWords > 0 || p->fRewrite )
+    {
+        word Magic = DAU_CACHE_MAGIC;
+        if ( p->pMap == NULL || p->fRewrite )
+        {
+            // write the valid records into a temporary file and replace the old one
+            char * pTemp = ABC_ALLOC( char, strlen(p->pFileName) + 8 );
+            sprintf( pTemp, "%s.tmp", p->pFileName );
+            pFile = fopen( pTemp, "wb" );
+            if ( pFile != NULL )
+            {
+                if ( p->pMap )
+                    fwrite( p->pMap, sizeof(word), p->nMapWords, pFile );
+                else
+                    fwrite( &Magic, sizeof(word), 1, pFile );
+                for ( i = 0; i < DAU_CACHE_SHARDS; i++ )
+                    fwrite( Vec_WrdArray(p->pShards[i]->vNew), sizeof(word), Vec_WrdSize(p->pShards[i]->vNew), pFile );
+                fclose( pFile );
+                Dau_CacheUnmapFile( p );
+                if ( rename( pTemp, p->pFileName ) != 0 )
+                    printf( "Abc_TtCacheStop(): Cannot update file \"%s\".\n", p->pFileName );
+            }
+            else
+                printf( "Abc_TtCacheStop(): Cannot open file \"%s\" for writing.\n", pTemp );
+            ABC_FREE( pTemp );
+        }
+        else
+        {
+            // the records are appended with one call, so that runs finishing at the same time do not interleave
+            pFile = fopen( p->pFileName, "ab" );
+            if ( pFile != NULL )
+            {
+                Vec_Wrd_t * vAll = Vec_WrdAlloc( nNewWords );
+                for ( i = 0; i < DAU_CACHE_SHARDS; i++ )
+                    Vec_WrdAppend( vAll, p->pShards[i]->vNew );
+                setvbuf( pFile, NULL, _IONBF, 0 );
+                fwrite( Vec_WrdArray(vAll), sizeof(word), Vec_WrdSize(vAll), pFile );
+                fclose( pFile );
+                Vec_WrdFree( vAll );
+            }
+            else
+                printf( "Abc_TtCacheStop(): Cannot open file \"%s\" for appending.\n", p->pFileName );
+        }
+    }
+    Dau_CacheUnmapFile( p );
+    Dau_CacheFree( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the cache is used for this function size.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtCacheIsUsed( int nVars )
+{
+    return s_DauCache != NULL && nVars <= DAU_CACHE_MAX_VAR;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up the canonical form.]
+
+  Description [If the truth table is found, overwrites it by the canonical
+  form, writes the permutation, and returns 1 together with the phase.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtCacheLookup( word * pTruth, int nVars, char * pCanonPerm, unsigned * puCanonPhase )
+{
+    Dau_Cache_t * p = s_DauCache;
+    unsigned Hash = Dau_CacheHash( pTruth, nVars );
+    Dau_Shard_t * pShard = Dau_CacheShard( p, Hash );
+    int nWords = Abc_TtWordNum( nVars ), * pPlace, RetValue;
+    assert( Abc_TtCacheIsUsed(nVars) );
+    Dau_CacheLock( pShard );
+    pShard->nLookups++;
+    pPlace = Dau_CacheFind( p, pShard, pTruth, nVars, Hash );
+    if ( (RetValue = (*pPlace != 0)) )
+    {
+        word * pRec = Dau_CacheRec( p, pShard, *pPlace - 1 );
+        *puCanonPhase = (unsigned)pRec[0];
+        memcpy( pCanonPerm, pRec + 1, (size_t)nVars );
+        Abc_TtCopy( pTruth, pRec + 3 + nWords, nWords, 0 );
+        pShard->nHits++;
+    }
+    Dau_CacheUnlock( pShard );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the canonical form to the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtCacheInsert( word * pTruth, word * pCanon, int nVars, char * pCanonPerm, unsigned uCanonPhase )
+{
+    Dau_Cache_t * p = s_DauCache;
+    unsigned Hash = Dau_CacheHash( pTruth, nVars );
+    Dau_Shard_t * pShard = Dau_CacheShard( p, Hash );
+    int nWords = Abc_TtWordNum( nVars );
+    word Perm[2] = {0, 0};
+    assert( Abc_TtCacheIsUsed(nVars) );
+    memcpy( Perm, pCanonPerm, (size_t)nVars );
+    Dau_CacheLock( pShard );
+    if ( *Dau_CacheFind( p, pShard, pTruth, nVars, Hash ) == 0 )
+    {
+        int Offset = p->nMapWords + Vec_WrdSize(pShard->vNew);
+        Vec_WrdPush( pShard->vNew, ((word)nVars << 32) | (word)uCanonPhase );
+        Vec_WrdPushArray( pShard->vNew, Perm, 2 );
+        Vec_WrdPushArray( pShard->vNew, pTruth, nWords );
+        Vec_WrdPushArray( pShard->vNew, pCanon, nWords );
+        Dau_CacheAdd( p, pShard, Offset, Hash );
+        pShard->nNew++;
+    }
+    Dau_CacheUnlock( pShard );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtCachePrintStats()
+{
+    Dau_Cache_t * p = s_DauCache;
+    int i, nEntries = 0, nNew = 0, nLookups = 0, nHits = 0;
+    double Memory;
+    if ( p == NULL )
+    {
+        printf( "NPN cache is not used.\n" );
+        return;
+    }
+    Memory = 8.0 * p->nMapWords;
+    for ( i = 0; i < DAU_CACHE_SHARDS; i++ )
+    {
+        Dau_Shard_t * pShard = p->pShards[i];
+        nEntries += pShard->nEntries;
+        nNew     += pShard->nNew;
+        nLookups += pShard->nLookups;
+        nHits    += pShard->nHits;
+        Memory   += 8.0 * Vec_WrdSize(pShard->vNew) + 4.0 * (pShard->nTableMask + 1);
+    }
+    printf( "NPN cache \"%s\":  Records = %d (new = %d).  Lookups = %d.  Hits = %d (%.2f %%).  Memory = %.2f MB.\n",
+        p->pFileName, nEntries, nNew, nLookups, nHits,
+        100.0 * nHits / Abc_MaxInt(nLookups, 1), Memory / (1 << 20) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -1028,7 +1028,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
 
 ***********************************************************************/
 //#define CANON_VERIFY
-unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
+static unsigned Abc_TtCanonicizeInt( word * pTruth, int nVars, char * pCanonPerm )
 {
     int pStoreIn[17];
     unsigned uCanonPhase;
@@ -1077,6 +1077,34 @@ unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
     return uCanonPhase;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Semi-canonical form computation.]
+
+  Description [Uses the persistent NPN cache (see dauCache.c), if it is
+  started, to avoid recomputing canonical forms derived in earlier runs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Abc_TtCanonicize( word * pTruth, int nVars, char * pCanonPerm )
+{
+    word pCopy[16];
+    unsigned uCanonPhase;
+    int nWords = Abc_TtWordNum( nVars );
+    if ( !Abc_TtCacheIsUsed(nVars) )
+        return Abc_TtCanonicizeInt( pTruth, nVars, pCanonPerm );
+    if ( Abc_TtCacheLookup( pTruth, nVars, pCanonPerm, &uCanonPhase ) )
+        return uCanonPhase;
+    assert( nWords <= 16 );
+    Abc_TtCopy( pCopy, pTruth, nWords, 0 );
+    uCanonPhase = Abc_TtCanonicizeInt( pTruth, nVars, pCanonPerm );
+    Abc_TtCacheInsert( pCopy, pTruth, nVars, pCanonPerm, uCanonPhase );
+    return uCanonPhase;
+}
+
 unsigned Abc_TtCanonicizePerm( word * pTruth, int nVars, char * pCanonPerm )
 {
     int pStoreIn[17];
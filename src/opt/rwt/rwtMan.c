@@ -21,6 +21,17 @@
 #include "rwt.h"
 #include "bool/deco/deco.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -33,6 +44,10 @@ static char *           s_pPhases = NULL;
 static char *           s_pPerms = NULL; 
 static unsigned char *  s_pMap = NULL;
 
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t  s_MutexGlobal = PTHREAD_MUTEX_INITIALIZER; // protects lazy creation of the tables
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -50,8 +65,15 @@ static unsigned char *  s_pMap = NULL;
 ***********************************************************************/
 void Rwt_ManGlobalStart()
 { 
+#ifdef ABC_USE_PTHREADS
+    // the tables are shared by all threads and are read-only after creation
+    pthread_mutex_lock( &s_MutexGlobal );
+#endif
     if ( s_puCanons == NULL )
         Extra_Truth4VarNPN( &s_puCanons, &s_pPhases, &s_pPerms, &s_pMap );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &s_MutexGlobal );
+#endif
 }
 
 /**Function*************************************************************
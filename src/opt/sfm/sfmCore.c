@@ -213,6 +213,14 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be performed later
+    if ( p->fSpecMode )
+    {
+        p->SpecFanin = f;
+        p->SpecDiv   = iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar);
+        p->SpecTruth = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth );
     return 1;
@@ -274,15 +282,25 @@ p->timeSat += Abc_Clock() - clk;
     p->nImproves++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be performed later
+    if ( p->fSpecMode )
+    {
+        p->SpecFanin = -1;
+        p->SpecDiv   = -1;
+        p->SpecTruth = uTruth;
+        return 1;
+    }
     // update truth table
-    Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
-    Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
+    Sfm_NtkUpdateTruth( p, iNode, uTruth );
     return 1;
 }
 int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
 {
     int i, iFanin;
     p->nNodesTried++;
+    Sfm_ObjSpecRead( p, iNode );
+    Sfm_ObjForEachFanin( p, iNode, iFanin, i )
+        Sfm_ObjSpecRead( p, iFanin );
     // prepare SAT solver
     if ( !Sfm_NtkCreateWindow( p, iNode, p->pPars->fVeryVerbose ) )
         return 0;
@@ -320,6 +338,28 @@ int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if resubstitution should be tried for the node.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NodeResubFilter( Sfm_Ntk_t * p, int iNode )
+{
+    if ( Sfm_ObjIsFixed( p, iNode ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, iNode) > p->pPars->nDepthMax )
+        return 0;
+    if ( Sfm_ObjFaninNum(p, iNode) < 2 || Sfm_ObjFaninNum(p, iNode) > 6 )
+        return 0;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -376,13 +416,12 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
+    if ( pPars->nProcs > 1 && !pPars->fVeryVerbose )
+        Counter = Sfm_NtkPerformPar( p );
+    else
     Sfm_NtkForEachNode( p, i )
     {
-        if ( Sfm_ObjIsFixed( p, i ) )
-            continue;
-        if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
-            continue;
-        if ( Sfm_ObjFaninNum(p, i) < 2 || Sfm_ObjFaninNum(p, i) > 6 )
+        if ( !Sfm_NodeResubFilter( p, i ) )
             continue;
         for ( k = 0; Sfm_NodeResub(p, i); k++ )
         {
@@ -133,6 +133,13 @@ struct Sfm_Ntk_t_
     int               nSatCalls;
     int               nTimeOuts;
     int               nMaxDivs;
+    // speculative resubstitution
+    int               fSpecMode;   // record the change instead of updating the network
+    int               SpecFanin;   // recorded change: the fanin index (-1 if only the function is updated)
+    int               SpecDiv;     // recorded change: the new fanin (-1 if none)
+    word              SpecTruth;   // recorded change: the new function
+    Vec_Int_t *       vSpecReads;  // objects whose data was used by the computation (or NULL)
+    Vec_Int_t *       vSpecWrites; // objects whose data was changed by the update (or NULL)
     // runtime
     abctime           timeWin;
     abctime           timeDiv;
@@ -180,6 +187,9 @@ static inline void Sfm_ObjSetLevelR( Sfm_Ntk_t * p, int iObj, int Lev ) { Vec_In
 static inline int  Sfm_ObjUpdateFaninCount( Sfm_Ntk_t * p, int iObj )   { return Vec_IntAddToEntry(&p->vCounts, iObj, -1);                  }
 static inline void Sfm_ObjResetFaninCount( Sfm_Ntk_t * p, int iObj )    { Vec_IntWriteEntry(&p->vCounts, iObj, Sfm_ObjFaninNum(p, iObj)-1); }
 
+static inline void Sfm_ObjSpecRead( Sfm_Ntk_t * p, int iObj )           { if ( p->vSpecReads ) Vec_IntPush( p->vSpecReads, iObj );          }
+static inline void Sfm_ObjSpecWrite( Sfm_Ntk_t * p, int iObj )          { int k; if ( p->vSpecWrites ) { Vec_IntPush( p->vSpecWrites, iObj ); for ( k = 0; k < Sfm_ObjFaninNum(p, iObj); k++ ) Vec_IntPush( p->vSpecWrites, Sfm_ObjFanin(p, iObj, k) ); } }
+
 extern void        Kit_DsdPrintFromTruth( unsigned * pTruth, int nVars );
 
 ////////////////////////////////////////////////////////////////////////
@@ -203,6 +213,8 @@ extern int          Sfm_TruthToCnf( word Truth, word * pTruth, int nVars, Vec_In
 extern Vec_Wec_t *  Sfm_CreateCnf( Sfm_Ntk_t * p );
 extern void         Sfm_TranslateCnf( Vec_Wec_t * vRes, Vec_Str_t * vCnf, Vec_Int_t * vFaninMap, int iPivotVar );
 /*=== sfmCore.c ==========================================================*/
+extern int          Sfm_NodeResub( Sfm_Ntk_t * p, int iNode );
+extern int          Sfm_NodeResubFilter( Sfm_Ntk_t * p, int iNode );
 /*=== sfmLib.c ==========================================================*/
 extern int          Sfm_LibFindComplInputGate( Vec_Wrd_t * vFuncs, int iGate, int nFanins, int iFanin, int * piFaninNew );
 extern Sfm_Lib_t *  Sfm_LibPrepare( int nVars, int fTwo, int fDelay, int fVerbose, int fLibVerbose );
@@ -216,7 +228,12 @@ extern int          Sfm_LibImplementGatesDelay( Sfm_Lib_t * p, int * pFanins, Mi
 /*=== sfmNtk.c ==========================================================*/
 extern Sfm_Ntk_t *  Sfm_ConstructNetwork( Vec_Wec_t * vFanins, int nPis, int nPos );
 extern void         Sfm_NtkPrepare( Sfm_Ntk_t * p );
+extern void         Sfm_NtkPrepareWindow( Sfm_Ntk_t * p );
+extern void         Sfm_NtkFreeWindow( Sfm_Ntk_t * p );
 extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth );
+extern void         Sfm_NtkUpdateTruth( Sfm_Ntk_t * p, int iNode, word uTruth );
+/*=== sfmPar.c ==========================================================*/
+extern int          Sfm_NtkPerformPar( Sfm_Ntk_t * p );
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
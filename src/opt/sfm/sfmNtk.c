@@ -197,6 +197,10 @@ Sfm_Ntk_t * Sfm_NtkConstruct( Vec_Wec_t * vFanins, int nPis, int nPos, Vec_Str_t
 void Sfm_NtkPrepare( Sfm_Ntk_t * p )
 {
     p->nLevelMax = Vec_IntFindMax(&p->vLevels) + p->pPars->nGrowthLevel;
+    Sfm_NtkPrepareWindow( p );
+}
+void Sfm_NtkPrepareWindow( Sfm_Ntk_t * p )
+{
     p->vNodes    = Vec_IntAlloc( 1000 );
     p->vDivs     = Vec_IntAlloc( 100 );
     p->vRoots    = Vec_IntAlloc( 1000 );
@@ -233,6 +237,11 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     Vec_WecFree( p->vCnfs );
     Vec_IntFree( p->vCover );
     // other data
+    Sfm_NtkFreeWindow( p );
+    ABC_FREE( p );
+}
+void Sfm_NtkFreeWindow( Sfm_Ntk_t * p )
+{
     Vec_IntFreeP( &p->vNodes );
     Vec_IntFreeP( &p->vDivs  );
     Vec_IntFreeP( &p->vRoots );
@@ -246,7 +255,7 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     Vec_WecFreeP( &p->vClauses );
     Vec_IntFreeP( &p->vFaninMap );
     if ( p->pSat  ) sat_solver_delete( p->pSat );
-    ABC_FREE( p );
+    p->pSat = NULL;
 }
 
 /**Function*************************************************************
@@ -287,6 +296,7 @@ void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
     if ( Sfm_ObjFanoutNum(p, iNode) > 0 || Sfm_ObjIsPi(p, iNode) || Sfm_ObjIsFixed(p, iNode) )
         return;
     assert( Sfm_ObjIsNode(p, iNode) );
+    Sfm_ObjSpecWrite( p, iNode );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
     {
         int RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );  assert( RetValue );
@@ -301,6 +311,7 @@ void Sfm_NtkUpdateLevel_rec( Sfm_Ntk_t * p, int iNode )
     int LevelNew = Sfm_ObjLevelNew( Sfm_ObjFiArray(p, iNode), &p->vLevels, Sfm_ObjAddsLevel(p, iNode) );
     if ( LevelNew == Sfm_ObjLevel(p, iNode) )
         return;
+    Sfm_ObjSpecWrite( p, iNode );
     Sfm_ObjSetLevel( p, iNode, LevelNew );
     Sfm_ObjForEachFanout( p, iNode, iFanout, i )
         Sfm_NtkUpdateLevel_rec( p, iFanout );
@@ -311,6 +322,7 @@ void Sfm_NtkUpdateLevelR_rec( Sfm_Ntk_t * p, int iNode )
     int LevelNew = Sfm_ObjLevelNewR( Sfm_ObjFoArray(p, iNode), &p->vLevelsR, Sfm_ObjAddsLevel(p, iNode) );
     if ( LevelNew == Sfm_ObjLevelR(p, iNode) )
         return;
+    Sfm_ObjSpecWrite( p, iNode );
     Sfm_ObjSetLevelR( p, iNode, LevelNew );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
         Sfm_NtkUpdateLevelR_rec( p, iFanin );
@@ -321,6 +333,7 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth
     assert( Sfm_ObjIsNode(p, iNode) );
     assert( iFanin != iFaninNew );
     assert( Sfm_ObjFaninNum(p, iNode) <= 6 );
+    Sfm_ObjSpecWrite( p, iNode );
     if ( uTruth == 0 || ~uTruth == 0 )
     {
         Sfm_ObjForEachFanin( p, iNode, iFanin, f )
@@ -338,6 +351,7 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth
         // recursively remove MFFC
         Sfm_NtkDeleteObj_rec( p, iFanin );
     }
+    Sfm_ObjSpecWrite( p, iNode );
     // update logic level
     Sfm_NtkUpdateLevel_rec( p, iNode );
     if ( iFaninNew != -1 )
@@ -345,6 +359,11 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth
     if ( Sfm_ObjFanoutNum(p, iFanin) > 0 )
         Sfm_NtkUpdateLevelR_rec( p, iFanin );
     // update truth table
+    Sfm_NtkUpdateTruth( p, iNode, uTruth );
+}
+void Sfm_NtkUpdateTruth( Sfm_Ntk_t * p, int iNode, word uTruth )
+{
+    Sfm_ObjSpecWrite( p, iNode );
     Vec_WrdWriteEntry( p->vTruths, iNode, uTruth );
     Sfm_TruthToCnf( uTruth, NULL, Sfm_ObjFaninNum(p, iNode), p->vCover, (Vec_Str_t *)Vec_WecEntry(p->vCnfs, iNode) );
 }
@@ -0,0 +1,388 @@
+/**CFile****************************************************************
+
+  FileName    [sfmPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based optimization using internal don't-cares.]
+
+  Synopsis    [Speculative resubstitution using several threads.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: sfmPar.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "sfmInt.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+/*
+    The nodes are processed in rounds. In each round, a batch of the next
+    nodes in the serial order is given to the threads. Each thread has its
+    own window and SAT solver, reads the network, which does not change
+    while the threads run, and records for every node the first change
+    found by Sfm_NodeResub() together with the objects whose data was used
+    to find it. After that, the changes are committed in the serial order.
+    A node whose recorded objects were not changed by earlier commits of the
+    same round gets exactly the result the serial run would have computed,
+    because the window and the restarted SAT solver depend only on these
+    objects. The remaining nodes are recomputed by the committing thread.
+    Therefore, the resulting network is identical to the one of the serial run.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define SFM_PAR_THR_MAX   64         // the largest number of threads
+#define SFM_PAR_JOBS      16         // the number of nodes per thread in one round
+#define SFM_PAR_STATS     11         // the number of statistics counters
+
+typedef struct Sfm_ParJob_t_ Sfm_ParJob_t;
+struct Sfm_ParJob_t_
+{
+    int             iNode;           // the node
+    int             iThread;         // the thread that processed the node
+    int             iReadBeg;        // the first recorded object in the thread's array
+    int             iReadEnd;        // the last recorded object in the thread's array
+    int             fChange;         // the change is found
+    int             SpecFanin;       // the change (see Sfm_NodeResubSolve)
+    int             SpecDiv;         // the change (see Sfm_NodeResubSolve)
+    word            SpecTruth;       // the change (see Sfm_NodeResubSolve)
+    int             Stats[SFM_PAR_STATS]; // the statistics of this computation
+};
+
+typedef struct Sfm_ParMan_t_ Sfm_ParMan_t;
+typedef struct Sfm_ParTh_t_ Sfm_ParTh_t;
+struct Sfm_ParTh_t_
+{
+    Sfm_ParMan_t *  pMan;            // the manager
+    Sfm_Ntk_t *     pNtk;            // the window and the SAT solver of this thread
+    Sfm_Par_t       Pars;            // the parameters (modified by Sfm_NtkCreateWindow)
+    Vec_Int_t *     vReads;          // the objects recorded for the jobs of this thread
+};
+
+struct Sfm_ParMan_t_
+{
+    Sfm_Ntk_t *     pNtk;            // the network
+    int             nProcs;          // the number of threads
+    int             nJobs;           // the number of jobs in this round
+    volatile int    iJobNext;        // the next job to be given to a thread
+    Sfm_ParJob_t *  pJobs;           // the jobs of this round
+    Vec_Int_t *     vStamps;         // the last round when the object was changed
+    int             iRound;          // the current round
+    int             nReused;         // the number of speculative results used
+    int             nRedone;         // the number of nodes recomputed
+    Sfm_ParTh_t     Th[SFM_PAR_THR_MAX];
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Reading and adding statistics counters.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_ParStatsRead( Sfm_Ntk_t * p, int * pStats )
+{
+    pStats[0]  = p->nNodesTried;
+    pStats[1]  = p->nTryRemoves;
+    pStats[2]  = p->nTryImproves;
+    pStats[3]  = p->nTryResubs;
+    pStats[4]  = p->nRemoves;
+    pStats[5]  = p->nImproves;
+    pStats[6]  = p->nResubs;
+    pStats[7]  = p->nTotalDivs;
+    pStats[8]  = p->nSatCalls;
+    pStats[9]  = p->nTimeOuts;
+    pStats[10] = p->nMaxDivs;
+}
+static void Sfm_ParStatsAdd( Sfm_Ntk_t * p, int * pStats )
+{
+    p->nNodesTried  += pStats[0];
+    p->nTryRemoves  += pStats[1];
+    p->nTryImproves += pStats[2];
+    p->nTryResubs   += pStats[3];
+    p->nRemoves     += pStats[4];
+    p->nImproves    += pStats[5];
+    p->nResubs      += pStats[6];
+    p->nTotalDivs   += pStats[7];
+    p->nSatCalls    += pStats[8];
+    p->nTimeOuts    += pStats[9];
+    p->nMaxDivs     += pStats[10];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the private context of a thread.]
+
+  Description [The network data is shared with the main context and is
+  only read by the thread. Traversal IDs, SAT variable maps, fanin counters
+  and the window data are private.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Sfm_Ntk_t * Sfm_ParNtkStart( Sfm_Ntk_t * p, Sfm_Par_t * pPars, Vec_Int_t * vReads )
+{
+    Sfm_Ntk_t * pNew = ABC_ALLOC( Sfm_Ntk_t, 1 );
+    *pNew = *p;
+    pNew->pPars = pPars;
+    memset( &pNew->vCounts,   0, sizeof(Vec_Int_t) );
+    memset( &pNew->vTravIds,  0, sizeof(Vec_Int_t) );
+    memset( &pNew->vTravIds2, 0, sizeof(Vec_Int_t) );
+    memset( &pNew->vId2Var,   0, sizeof(Vec_Int_t) );
+    memset( &pNew->vVar2Id,   0, sizeof(Vec_Int_t) );
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    pNew->nTravIds    = 0;
+    pNew->nTravIds2   = 0;
+    pNew->nSatVars    = 0;
+    pNew->vCover      = Vec_IntAlloc( 1 << 16 );
+    pNew->fSpecMode   = 1;
+    pNew->vSpecReads  = vReads;
+    pNew->vSpecWrites = NULL;
+    Sfm_NtkPrepareWindow( pNew );
+    return pNew;
+}
+static void Sfm_ParNtkStop( Sfm_Ntk_t * p )
+{
+    ABC_FREE( p->vCounts.pArray );
+    ABC_FREE( p->vTravIds.pArray );
+    ABC_FREE( p->vTravIds2.pArray );
+    ABC_FREE( p->vId2Var.pArray );
+    ABC_FREE( p->vVar2Id.pArray );
+    Vec_IntFree( p->vCover );
+    Sfm_NtkFreeWindow( p );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Processes the jobs of the current round in one thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_ParThreadRun( Sfm_ParTh_t * pTh )
+{
+    Sfm_ParMan_t * pMan = pTh->pMan;
+    Sfm_Ntk_t * p = pTh->pNtk;
+    Sfm_ParJob_t * pJob;
+    int i, iJob, Stats[SFM_PAR_STATS];
+    while ( (iJob = ABC_FETCH_ADD(&pMan->iJobNext, 1)) < pMan->nJobs )
+    {
+        pJob = pMan->pJobs + iJob;
+        pJob->iThread  = pTh - pMan->Th;
+        pJob->iReadBeg = Vec_IntSize( pTh->vReads );
+        Sfm_ObjSpecRead( p, pJob->iNode );
+        if ( Sfm_NodeResubFilter( p, pJob->iNode ) )
+        {
+            Sfm_ParStatsRead( p, Stats );
+            pJob->fChange = Sfm_NodeResub( p, pJob->iNode );
+            Sfm_ParStatsRead( p, pJob->Stats );
+            for ( i = 0; i < SFM_PAR_STATS; i++ )
+                pJob->Stats[i] -= Stats[i];
+            pJob->SpecFanin = p->SpecFanin;
+            pJob->SpecDiv   = p->SpecDiv;
+            pJob->SpecTruth = p->SpecTruth;
+        }
+        pJob->iReadEnd = Vec_IntSize( pTh->vReads );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+static void * Sfm_ParThread( void * pArg )
+{
+    Sfm_ParThreadRun( (Sfm_ParTh_t *)pArg );
+    return NULL;
+}
+#endif
+
+static void Sfm_ParRound( Sfm_ParMan_t * pMan )
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[SFM_PAR_THR_MAX];
+    int status;
+#endif
+    int i;
+    for ( i = 0; i < pMan->nProcs; i++ )
+        Vec_IntClear( pMan->Th[i].vReads );
+    pMan->iJobNext = 0;
+#ifdef ABC_USE_PTHREADS
+    for ( i = 1; i < pMan->nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Sfm_ParThread, (void *)(pMan->Th + i) );  assert( status == 0 );
+    }
+#endif
+    Sfm_ParThreadRun( pMan->Th );
+#ifdef ABC_USE_PTHREADS
+    for ( i = 1; i < pMan->nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the speculative result of the job can be used.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Sfm_ParJobIsValid( Sfm_ParMan_t * pMan, Sfm_ParJob_t * pJob )
+{
+    Vec_Int_t * vReads = pMan->Th[pJob->iThread].vReads;
+    int i;
+    for ( i = pJob->iReadBeg; i < pJob->iReadEnd; i++ )
+        if ( Vec_IntEntry(pMan->vStamps, Vec_IntEntry(vReads, i)) == pMan->iRound )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution for all nodes using several threads.]
+
+  Description [Returns the number of nodes changed, as the serial loop
+  in Sfm_NtkPerform() does.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p )
+{
+    Sfm_ParMan_t * pMan;
+    Sfm_ParJob_t * pJob;
+    int i, k, w, iObj, iNode, Counter = 0, fStop = 0;
+    pMan = ABC_CALLOC( Sfm_ParMan_t, 1 );
+    pMan->pNtk    = p;
+#ifdef ABC_USE_PTHREADS
+    pMan->nProcs  = Abc_MinInt( Abc_MaxInt(p->pPars->nProcs, 1), SFM_PAR_THR_MAX );
+#else
+    pMan->nProcs  = 1;
+#endif
+    pMan->pJobs   = ABC_CALLOC( Sfm_ParJob_t, pMan->nProcs * SFM_PAR_JOBS );
+    pMan->vStamps = Vec_IntStart( p->nObjs );
+    for ( i = 0; i < pMan->nProcs; i++ )
+    {
+        pMan->Th[i].pMan   = pMan;
+        pMan->Th[i].Pars   = *p->pPars;
+        pMan->Th[i].vReads = Vec_IntAlloc( 1000 );
+        pMan->Th[i].pNtk   = Sfm_ParNtkStart( p, &pMan->Th[i].Pars, pMan->Th[i].vReads );
+    }
+    p->vSpecWrites = Vec_IntAlloc( 100 );
+    iNode = p->nPis;
+    while ( !fStop && iNode + p->nPos < p->nObjs )
+    {
+        // collect the next nodes
+        pMan->iRound++;
+        pMan->nJobs = 0;
+        for ( ; iNode + p->nPos < p->nObjs && pMan->nJobs < pMan->nProcs * SFM_PAR_JOBS; iNode++ )
+        {
+            if ( Sfm_ObjIsFixed(p, iNode) )
+                continue;
+            pJob = pMan->pJobs + pMan->nJobs++;
+            memset( pJob, 0, sizeof(Sfm_ParJob_t) );
+            pJob->iNode = iNode;
+        }
+        // compute the changes speculatively
+        Sfm_ParRound( pMan );
+        // commit the changes in the serial order
+        for ( i = 0; i < pMan->nJobs; i++ )
+        {
+            pJob = pMan->pJobs + i;
+            if ( !Sfm_NodeResubFilter(p, pJob->iNode) )
+                continue;
+            k = 0;
+            if ( Sfm_ParJobIsValid(pMan, pJob) )
+            {
+                Sfm_ParStatsAdd( p, pJob->Stats );
+                if ( pJob->fChange )
+                {
+                    if ( pJob->SpecFanin >= 0 )
+                        Sfm_NtkUpdate( p, pJob->iNode, pJob->SpecFanin, pJob->SpecDiv, pJob->SpecTruth );
+                    else
+                        Sfm_NtkUpdateTruth( p, pJob->iNode, pJob->SpecTruth );
+                    for ( k = 1; Sfm_NodeResub(p, pJob->iNode); k++ );
+                }
+                pMan->nReused++;
+            }
+            else
+            {
+                for ( k = 0; Sfm_NodeResub(p, pJob->iNode); k++ );
+                pMan->nRedone++;
+            }
+            // remember the changed objects
+            Vec_IntForEachEntry( p->vSpecWrites, iObj, w )
+                Vec_IntWriteEntry( pMan->vStamps, iObj, pMan->iRound );
+            Vec_IntClear( p->vSpecWrites );
+            Counter += (k > 0);
+            if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+            {
+                fStop = 1;
+                break;
+            }
+        }
+    }
+    if ( p->pPars->fVerbose )
+        printf( "Speculation with %d threads: Rounds = %d. Reused = %d. Recomputed = %d.\n",
+            pMan->nProcs, pMan->iRound, pMan->nReused, pMan->nRedone );
+    Vec_IntFreeP( &p->vSpecWrites );
+    for ( i = 0; i < pMan->nProcs; i++ )
+    {
+        Sfm_ParNtkStop( pMan->Th[i].pNtk );
+        Vec_IntFree( pMan->Th[i].vReads );
+    }
+    Vec_IntFree( pMan->vStamps );
+    ABC_FREE( pMan->pJobs );
+    ABC_FREE( pMan );
+    return Counter;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
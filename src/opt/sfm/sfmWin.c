@@ -244,6 +244,7 @@ void Sfm_NtkComputeRoots_rec( Sfm_Ntk_t * p, int iNode, int nLevelMax, Vec_Int_t
     if ( Sfm_ObjIsTravIdCurrent(p, iNode) )
         return;
     Sfm_ObjSetTravIdCurrent(p, iNode);
+    Sfm_ObjSpecRead( p, iNode );
     if ( iNode != p->iPivotNode )
         Vec_IntPush( vTfo, iNode );
     // check if the node should be the root
@@ -331,6 +332,7 @@ int Sfm_NtkCollectTfi_rec( Sfm_Ntk_t * p, int iNode, Vec_Int_t * vNodes )
     if ( Sfm_ObjIsTravIdCurrent( p, iNode ) )
         return 0;
     Sfm_ObjSetTravIdCurrent( p, iNode );
+    Sfm_ObjSpecRead( p, iNode );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
         if ( Sfm_NtkCollectTfi_rec( p, iFanin, vNodes ) )
             return 1;
@@ -385,6 +387,9 @@ int Sfm_NtkCreateWindow( Sfm_Ntk_t * p, int iNode, int fVerbose )
     }
     assert( !p->pPars->nWinSizeMax || Vec_IntSize(p->vDivs) <= p->pPars->nWinSizeMax );
     p->nMaxDivs += (int)(p->pPars->nWinSizeMax && Vec_IntSize(p->vDivs) == p->pPars->nWinSizeMax);
+    // remember divisor candidates, whose fanouts are checked below
+    if ( p->vSpecReads )
+        Vec_IntAppend( p->vSpecReads, p->vDivs );
     // remove node/fanins from divisors
     // mark fanins
     Sfm_NtkIncrementTravId2( p );
@@ -424,6 +424,93 @@ Aig_Man_t * Cec_ComputeChoicesNew( Gia_Man_t * pGia, int nConfs, int fVerbose )
     return pAig;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives equivalence classes from the result of SAT sweeping.]
+
+  Description [After sweeping, the copy of each object points to the node
+  of the reduced AIG. Objects sharing the same node are proved equivalent.
+  The classes are derived from the copies rather than from the candidate
+  classes, which may contain undecided members.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManDeriveProvedClasses( Gia_Man_t * p )
+{
+    Vec_Int_t * vFirst = Vec_IntStartFull( Gia_ManObjNum(p) );
+    Gia_Obj_t * pObj; int i, iFirst;
+    ABC_FREE( p->pReprs );
+    ABC_FREE( p->pNexts );
+    p->pReprs = ABC_CALLOC( Gia_Rpr_t, Gia_ManObjNum(p) );
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        Gia_ObjSetRepr( p, i, GIA_VOID );
+        if ( Gia_ObjIsCo(pObj) )
+            continue;
+        iFirst = Vec_IntEntry( vFirst, Abc_Lit2Var(pObj->Value) );
+        if ( iFirst == -1 )
+            Vec_IntWriteEntry( vFirst, Abc_Lit2Var(pObj->Value), i );
+        else
+            Gia_ObjSetRepr( p, i, iFirst );
+    }
+    p->pNexts = Gia_ManDeriveNexts( p );
+    Vec_IntFree( vFirst );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes proved equivalences using the GIA-based SAT sweeper.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ComputeEquivsGia( Gia_Man_t * p, Dch_Pars_t * pPars )
+{
+    extern void Cec4_ManSetParams( Cec_ParFra_t * pPars );
+    extern int  Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly );
+    Cec_ParFra_t ParsFra, * pParsFra = &ParsFra;
+    abctime clk = Abc_Clock();
+    Cec4_ManSetParams( pParsFra );
+    pParsFra->nWords     = Abc_MaxInt( 1, pPars->nWords );
+    pParsFra->nBTLimit   = pPars->nBTLimit;
+    pParsFra->nSatVarMax = pPars->nSatVarMax;
+    pParsFra->fVerbose   = pPars->fVerbose;
+    Cec4_ManPerformSweeping( p, pParsFra, NULL, 0 );
+    Cec_ManDeriveProvedClasses( p );
+    if ( pPars->fVerbose )
+        Abc_PrintTime( 1, "Equivalence computation time", Abc_Clock() - clk );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes choices for the miter of snapshots without AIG conversion.]
+
+  Description [The miter is produced by Dar_NewChoiceSynthesis() and contains
+  three snapshots with interleaved outputs. Returns the AIG with choices 
+  represented using siblings, as expected by the GIA-based mappers.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Cec_ComputeChoicesGia( Gia_Man_t * pMiter, Dch_Pars_t * pPars )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Cec_ComputeEquivsGia( pMiter, pPars );
+    pNew = Gia_ManEquivToChoices( pMiter, 3 );
+    pNew = Gia_ManEquivToSibls( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    return pNew;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
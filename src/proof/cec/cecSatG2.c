@@ -20,8 +20,21 @@
 
 #include "aig/gia/gia.h"
 #include "misc/util/utilTruth.h"
+#include "misc/util/utilSimd.h"
+#include "misc/util/utilPth.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 #define USE_GLUCOSE2
 
 #ifdef USE_GLUCOSE2
@@ -131,6 +144,7 @@ struct Cec4_Man_t_
     abctime          timeSatSat;
     abctime          timeSatUnsat;
     abctime          timeSatUndec;
+    abctime          timeSatPar;
     abctime          timeSim;
     abctime          timeRefine;
     abctime          timeResimGlo;
@@ -267,7 +281,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     if ( p->pPars->fVerbose ) 
     {
         abctime timeTotal = Abc_Clock() - p->timeStart;
-        abctime timeSat   = p->timeSatSat0 + p->timeSatSat + p->timeSatUnsat0 + p->timeSatUnsat + p->timeSatUndec;
+        abctime timeSat   = p->timeSatSat0 + p->timeSatSat + p->timeSatUnsat0 + p->timeSatUnsat + p->timeSatUndec + p->timeSatPar;
         abctime timeOther = timeTotal - timeSat - p->timeSim - p->timeRefine - p->timeResimLoc - p->timeGenPats;// - p->timeResimGlo;
         ABC_PRTP( "SAT solving  ", timeSat,          timeTotal );
         ABC_PRTP( "  sat(easy)  ", p->timeSatSat0,   timeTotal );
@@ -275,6 +289,8 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
         ABC_PRTP( "  unsat(easy)", p->timeSatUnsat0, timeTotal );
         ABC_PRTP( "  unsat      ", p->timeSatUnsat,  timeTotal );
         ABC_PRTP( "  fail       ", p->timeSatUndec,  timeTotal );
+        if ( p->pPars->nProcs > 1 )
+            ABC_PRTP( "  parallel   ", p->timeSatPar,    timeTotal );
         ABC_PRTP( "Generate CNF ", p->timeCnf,       timeTotal );
         ABC_PRTP( "Generate pats", p->timeGenPats,   timeTotal );
         ABC_PRTP( "Simulation   ", p->timeSim,       timeTotal );
@@ -843,7 +859,9 @@ static inline void Cec4_ObjSimAnd( Gia_Man_t * p, int iObj )
     word * pSim  = Cec4_ObjSim( p, iObj );
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
+    if ( p->nSimWords >= ABC_SIMD_MIN_WORDS )
+        Abc_SimdAnd( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ? ~(word)0 : 0, Gia_ObjFaninC1(pObj) ? ~(word)0 : 0, p->nSimWords );
+    else if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )
         for ( w = 0; w < p->nSimWords; w++ )
             pSim[w] = ~pSim0[w] & ~pSim1[w];
     else if ( Gia_ObjFaninC0(pObj) && !Gia_ObjFaninC1(pObj) )
@@ -863,7 +881,9 @@ static inline void Cec4_ObjSimXor( Gia_Man_t * p, int iObj )
     word * pSim  = Cec4_ObjSim( p, iObj );
     word * pSim0 = Cec4_ObjSim( p, Gia_ObjFaninId0(pObj, iObj) );
     word * pSim1 = Cec4_ObjSim( p, Gia_ObjFaninId1(pObj, iObj) );
-    if ( Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) )
+    if ( p->nSimWords >= ABC_SIMD_MIN_WORDS )
+        Abc_SimdXor( pSim, pSim0, pSim1, Gia_ObjFaninC0(pObj) ? ~(word)0 : 0, Gia_ObjFaninC1(pObj) ? ~(word)0 : 0, p->nSimWords );
+    else if ( Gia_ObjFaninC0(pObj) ^ Gia_ObjFaninC1(pObj) )
         for ( w = 0; w < p->nSimWords; w++ )
             pSim[w] = ~pSim0[w] ^ pSim1[w];
     else
@@ -973,7 +993,10 @@ void Cec4_ManSimAlloc( Gia_Man_t * p, int nWords )
 {
     Vec_WrdFreeP( &p->vSims );
     Vec_WrdFreeP( &p->vSimsPi );
-    p->vSims     = Vec_WrdStart( Gia_ManObjNum(p) * nWords );
+    // with the vector kernels, each row is a whole number of aligned vectors
+    if ( nWords >= ABC_SIMD_MIN_WORDS )
+        nWords = Abc_SimdPadWords( nWords );
+    p->vSims     = Vec_WrdAllocArray( Abc_SimdCalloc(Gia_ManObjNum(p) * nWords), Gia_ManObjNum(p) * nWords );
     p->vSimsPi   = Vec_WrdStart( (Gia_ManCiNum(p) + 1) * nWords );
     p->nSimWords = nWords;
 }
@@ -1729,14 +1752,398 @@ Gia_Obj_t * Cec4_ManFindRepr( Gia_Man_t * p, Cec4_Man_t * pMan, int iObj )
     pMan->timeResimLoc += Abc_Clock() - clk;
     return NULL;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping.]
+
+  Description [Each worker owns a SAT solver and proves the candidate
+  equivalences of its shard of the equivalence classes in a private
+  copy of the speculatively reduced AIG, in which the candidate nodes 
+  are replaced by their representatives. The proof of a pair is accepted
+  when all the replacements in its fanin cone are proved. The counter-
+  examples are packed into the simulation info of the shared AIG, which 
+  is used to refine the classes before the next round. Proved and 
+  undecided nodes are marked, so that the sequential sweeping only merges
+  them and takes care of the remaining candidates.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+#define CEC4_THR_MAX  64   // the max number of threads
+#define CEC4_PAIR_MIN 100  // the min number of pairs to solve in parallel
+
+typedef struct Cec4_ThData_t_ Cec4_ThData_t;
+struct Cec4_ThData_t_
+{
+    Cec4_Man_t *     pMan;           // the worker's manager with its own solver
+    Gia_Man_t *      pShared;        // the speculatively reduced AIG of the round (shared)
+    Vec_Int_t *      vOwn;           // the copies of the nodes (shared)
+    Vec_Int_t *      vSpec;          // the copies of the nodes after replacement (shared)
+    Vec_Int_t *      vPairs;         // candidate pairs (iRepr, iObj) of the shard
+    Vec_Int_t *      vStatus;        // the solver status for each node (shared)
+    Vec_Int_t *      vCexes;         // counter-examples (the number of literals followed by literals)
+    volatile int     fWorking;       // the worker is busy
+};
+
+static inline int Cec4_ObjIsSpec( Gia_Man_t * p, Cec_ParFra_t * pPars, int iObj )
+{
+    if ( Gia_ObjRepr(p, iObj) == GIA_VOID || Gia_ObjFailed(p, iObj) )
+        return 0;
+    return !pPars->nLevelMax || Gia_ObjLevel(p, Gia_ManObj(p, iObj)) <= pPars->nLevelMax;
+}
+// derives the speculatively reduced AIG without changing the user's AIG
+Gia_Man_t * Cec4_ManDeriveSpec( Gia_Man_t * pAig, Cec_ParFra_t * pPars, Vec_Int_t * vOwn, Vec_Int_t * vSpec )
+{
+    Gia_Man_t * pNew;
+    Gia_Obj_t * pObj; int i, iLit, iRepr;
+    pNew = Gia_ManStart( Gia_ManObjNum(pAig) );
+    if ( pAig->pMuxes )
+        pNew->pMuxes = ABC_CALLOC( unsigned, pNew->nObjsAlloc );
+    Vec_IntFill( vOwn, Gia_ManObjNum(pAig), -1 );
+    Vec_IntFill( vSpec, Gia_ManObjNum(pAig), -1 );
+    Vec_IntWriteEntry( vOwn, 0, 0 );
+    Vec_IntWriteEntry( vSpec, 0, 0 );
+    Gia_ManForEachCi( pAig, pObj, i )
+    {
+        iLit = Gia_ManAppendCi( pNew );
+        Vec_IntWriteEntry( vOwn, Gia_ObjId(pAig, pObj), iLit );
+        Vec_IntWriteEntry( vSpec, Gia_ObjId(pAig, pObj), iLit );
+    }
+    Gia_ManHashAlloc( pNew );
+    Gia_ManForEachAnd( pAig, pObj, i )
+    {
+        int iLit0 = Abc_LitNotCond( Vec_IntEntry(vSpec, Gia_ObjFaninId0(pObj, i)), Gia_ObjFaninC0(pObj) );
+        int iLit1 = Abc_LitNotCond( Vec_IntEntry(vSpec, Gia_ObjFaninId1(pObj, i)), Gia_ObjFaninC1(pObj) );
+        if ( Gia_ObjIsXor(pObj) )
+            iLit = Gia_ManHashXorReal( pNew, iLit0, iLit1 );
+        else
+            iLit = Gia_ManHashAnd( pNew, iLit0, iLit1 );
+        Vec_IntWriteEntry( vOwn, i, iLit );
+        if ( Cec4_ObjIsSpec(pAig, pPars, i) )
+        {
+            iRepr = Gia_ObjRepr( pAig, i );
+            iLit  = Abc_LitNotCond( Vec_IntEntry(vSpec, iRepr), pObj->fPhase ^ Gia_ManObj(pAig, iRepr)->fPhase );
+        }
+        Vec_IntWriteEntry( vSpec, i, iLit );
+    }
+    Gia_ManHashStop( pNew );
+    return pNew;
+}
+// the worker's view of the shared AIG: the objects are shared and read-only,
+// while the mapping of AIG nodes into SAT variables belongs to the worker
+void Cec4_ManStartView( Cec4_Man_t * p, Gia_Man_t * pShared )
+{
+    if ( p->pSat )
+        sat_solver_stop( p->pSat );
+    p->pSat = sat_solver_start();  
+    sat_solver_set_jftr( p->pSat, p->pPars->jType );
+    p->nCallsSince = 0;
+    if ( p->pNew == NULL )
+        p->pNew = ABC_CALLOC( Gia_Man_t, 1 );
+    p->pNew->pObjs    = pShared->pObjs;
+    p->pNew->pMuxes   = pShared->pMuxes;
+    p->pNew->nObjs    = pShared->nObjs;
+    p->pNew->vCis     = pShared->vCis;
+    p->pNew->vCos     = pShared->vCos;
+    Vec_IntFill( &p->pNew->vCopies2, Gia_ManObjNum(pShared), -1 );
+    Vec_IntClear( &p->pNew->vSuppVars );
+    Vec_IntClear( &p->pNew->vCopiesTwo );
+    Vec_IntClear( &p->pNew->vVarMap );
+}
+void Cec4_ManStopView( Cec4_Man_t * p )
+{
+    if ( p->pNew == NULL )
+        return;
+    Vec_IntErase( &p->pNew->vCopies2 );
+    Vec_IntErase( &p->pNew->vSuppVars );
+    Vec_IntErase( &p->pNew->vCopiesTwo );
+    Vec_IntErase( &p->pNew->vVarMap );
+    ABC_FREE( p->pNew );
+}
+Cec4_Man_t * Cec4_ManStartWorker( Cec4_Man_t * pMan )
+{
+    Cec4_Man_t * p = ABC_CALLOC( Cec4_Man_t, 1 );
+    p->timeStart     = Abc_Clock();
+    p->pPars         = pMan->pPars;
+    p->pAig          = pMan->pAig;
+    p->vFrontier     = Vec_PtrAlloc( 1000 );
+    p->vFanins       = Vec_PtrAlloc( 100 );
+    p->vPat          = Vec_IntAlloc( 100 );
+    p->vFails        = pMan->vFails;     // shared, not modified by the workers
+    p->vCoDrivers    = pMan->vCoDrivers; // shared, not modified by the workers
+    return p;
+}
+void Cec4_ManStopWorker( Cec4_Man_t * p, Cec4_Man_t * pMan )
+{
+    int i, k;
+    for ( i = 0; i < 2; i++ )
+    for ( k = 0; k < 3; k++ )
+        if ( k == 2 )
+            pMan->nConflicts[i][k] = Abc_MaxInt( pMan->nConflicts[i][k], p->nConflicts[i][k] );
+        else
+            pMan->nConflicts[i][k] += p->nConflicts[i][k];
+    pMan->nGates[0]  += p->nGates[0];
+    pMan->nGates[1]  += p->nGates[1];
+    pMan->nRecycles  += p->nRecycles;
+    if ( p->pSat )
+        sat_solver_stop( p->pSat );
+    Cec4_ManStopView( p );
+    Vec_PtrFreeP( &p->vFrontier );
+    Vec_PtrFreeP( &p->vFanins );
+    Vec_IntFreeP( &p->vPat );
+    ABC_FREE( p );
+}
+int Cec4_ManSweepPair( Cec4_Man_t * p, Cec4_ThData_t * pThData, int iRepr, int iObj )
+{
+    Gia_Obj_t * pObj  = Gia_ManObj( p->pAig, iObj );
+    Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
+    int iLit0   = Vec_IntEntry( pThData->vSpec, iRepr );
+    int iLit1   = Vec_IntEntry( pThData->vOwn, iObj );
+    int fCompl  = Abc_LitIsCompl(iLit0) ^ Abc_LitIsCompl(iLit1) ^ pObj->fPhase ^ pRepr->fPhase;
+    int fEffort = p->vCoDrivers ? Vec_BitEntry(p->vCoDrivers, iObj) || Vec_BitEntry(p->vCoDrivers, iRepr) : 0;
+    int i, IdAig, IdSat, status, fEasy;
+    if ( Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1) ) // the opposite polarity is left undecided
+        return fCompl ? GLUCOSE_UNDEC : GLUCOSE_UNSAT;
+    status = Cec4_ManSolveTwo( p, Abc_Lit2Var(iLit0), Abc_Lit2Var(iLit1), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
+    if ( status != GLUCOSE_SAT )
+        return status;
+    // the CIs of the copy have the same IDs as the CIs of the user's AIG
+    Vec_IntClear( p->vPat );
+    if ( p->pPars->jType == 0 )
+    {
+        Vec_IntForEachEntryDouble( &p->pNew->vCopiesTwo, IdAig, IdSat, i )
+            Vec_IntPush( p->vPat, Abc_Var2Lit(IdAig, sat_solver_read_cex_varvalue(p->pSat, IdSat)) );
+    }
+    else
+    {
+        int * pCex = sat_solver_read_cex( p->pSat );
+        int * pMap = Vec_IntArray(&p->pNew->vVarMap);
+        for ( i = 0; i < pCex[0]; )
+            Vec_IntPush( p->vPat, Abc_Lit2LitV(pMap, Abc_LitNot(pCex[++i])) );
+    }
+    Vec_IntPush( pThData->vCexes, Vec_IntSize(p->vPat) );
+    Vec_IntAppend( pThData->vCexes, p->vPat );
+    return status;
+}
+void * Cec4_ManWorkerThread( void * pArg )
+{
+    Cec4_ThData_t * pThData = (Cec4_ThData_t *)pArg;
+    volatile int * pPlace = &pThData->fWorking;
+    int i, iRepr, iObj;
+    while ( 1 )
+    {
+        while ( *pPlace == 0 );
+        ABC_FENCE();
+        assert( pThData->fWorking );
+        if ( pThData->pMan == NULL )
+        {
+            pthread_exit( NULL );
+            assert( 0 );
+            return NULL;
+        }
+        Cec4_ManStartView( pThData->pMan, pThData->pShared );
+        Vec_IntForEachEntryDouble( pThData->vPairs, iRepr, iObj, i )
+            Vec_IntWriteEntry( pThData->vStatus, iObj, Cec4_ManSweepPair(pThData->pMan, pThData, iRepr, iObj) );
+        ABC_FENCE();
+        pThData->fWorking = 0;
+    }
+    assert( 0 );
+    return NULL;
+}
+void Cec4_ManSweepResimulate( Cec4_Man_t * pMan )
+{
+    abctime clk = Abc_Clock();
+    Gia_Man_t * p = pMan->pAig;
+    Cec4_ManSimulate( p, pMan );
+    Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+    p->iPatsPi = 0;
+    Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+    pMan->timeResimGlo += Abc_Clock() - clk;
+}
+// accepts the proofs whose fanin cones do not depend on unproved replacements
+void Cec4_ManSweepParAccept( Cec4_Man_t * pMan, Vec_Int_t * vStatus, Vec_Bit_t * vValid )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Gia_Obj_t * pObj; int i, iRepr, Status, fValid;
+    Vec_BitFill( vValid, Gia_ManObjNum(p), 1 );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        fValid = Vec_BitEntry(vValid, Gia_ObjFaninId0(pObj, i)) && Vec_BitEntry(vValid, Gia_ObjFaninId1(pObj, i));
+        if ( Cec4_ObjIsSpec(p, pMan->pPars, i) )
+        {
+            iRepr  = Gia_ObjRepr( p, i );
+            Status = Vec_IntEntry( vStatus, i );
+            if ( Status == GLUCOSE_UNSAT && fValid && Vec_BitEntry(vValid, iRepr) )
+            {
+                pMan->nSatUnsat++;
+                Gia_ObjSetProved( p, i );
+            }
+            else if ( Status == GLUCOSE_UNDEC )
+            {
+                pMan->nSatUndec++;
+                Gia_ObjSetFailed( p, i );
+                Vec_BitWriteEntry( pMan->vFails, i, 1 );
+            }
+            fValid = Gia_ObjProved(p, i) && Vec_BitEntry(vValid, iRepr);
+        }
+        Vec_BitWriteEntry( vValid, i, fValid );
+    }
+}
+int Cec4_ManSweepParMerge( Cec4_Man_t * pMan, Vec_Int_t * vCexes )
+{
+    Gia_Man_t * p = pMan->pAig;
+    int k, nLits, iCex = 0, nSat = 0;
+    while ( iCex < Vec_IntSize(vCexes) )
+    {
+        nLits = Vec_IntEntry( vCexes, iCex++ );
+        Vec_IntClear( pMan->vPat );
+        for ( k = 0; k < nLits; k++ )
+            Vec_IntPush( pMan->vPat, Vec_IntEntry(vCexes, iCex++) );
+        pMan->nSatSat++;
+        pMan->nPatterns++;
+        nSat++;
+        if ( p->vPats )
+        {
+            Vec_IntPush( p->vPats, Vec_IntSize(pMan->vPat)+2 );
+            Vec_IntAppend( p->vPats, pMan->vPat );
+            Vec_IntPush( p->vPats, -1 );
+        }
+        if ( Cec4_ManPackAddPattern( p, pMan->vPat, 0 ) == 64 * p->nSimWords )
+            Cec4_ManSweepResimulate( pMan );
+    }
+    return nSat;
+}
+void Cec4_ManSweepPar( Cec4_Man_t * pMan )
+{
+    Gia_Man_t * p = pMan->pAig;
+    Cec4_ThData_t ThData[CEC4_THR_MAX];
+    pthread_t WorkerThread[CEC4_THR_MAX];
+    Vec_Int_t * vStatus = Vec_IntStart( Gia_ManObjNum(p) );
+    Vec_Int_t * vShards = Vec_IntAlloc( Gia_ManObjNum(p) );
+    Vec_Bit_t * vValid  = Vec_BitStart( Gia_ManObjNum(p) );
+    Vec_Int_t * vOwn    = Vec_IntAlloc( Gia_ManObjNum(p) );
+    Vec_Int_t * vSpec   = Vec_IntAlloc( Gia_ManObjNum(p) );
+    Gia_Man_t * pShared = NULL;
+    int i, k, r, status, nProcs = Abc_MinInt( pMan->pPars->nProcs, CEC4_THR_MAX );
+    abctime clk = Abc_Clock();
+    // start the workers
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pMan     = Cec4_ManStartWorker( pMan );
+        ThData[i].pShared  = NULL;
+        ThData[i].vOwn     = vOwn;
+        ThData[i].vSpec    = vSpec;
+        ThData[i].vPairs   = Vec_IntAlloc( 1000 );
+        ThData[i].vStatus  = vStatus;
+        ThData[i].vCexes   = Vec_IntAlloc( 1000 );
+        ThData[i].fWorking = 0;
+        status = pthread_create( WorkerThread + i, NULL, Cec4_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( r = 0; r < pMan->pPars->nItersMax; r++ )
+    {
+        abctime clk2 = Abc_Clock();
+        int nPairs = 0, nSat = 0, iShard, iNext = 0;
+        int nSatUnsat = pMan->nSatUnsat, nSatUndec = pMan->nSatUndec;
+        // distribute the classes among the workers
+        Vec_IntFill( vShards, Gia_ManObjNum(p), -1 );
+        for ( k = 0; k < nProcs; k++ )
+        {
+            Vec_IntClear( ThData[k].vPairs );
+            Vec_IntClear( ThData[k].vCexes );
+        }
+        Gia_ManForEachAndId( p, i )
+        {
+            int iRepr = Gia_ObjRepr( p, i );
+            if ( !Cec4_ObjIsSpec(p, pMan->pPars, i) || Gia_ObjProved(p, i) )
+                continue;
+            // the members of the constant class are distributed one by one
+            if ( iRepr == 0 )
+                iShard = iNext++ % nProcs;
+            else if ( (iShard = Vec_IntEntry(vShards, iRepr)) == -1 )
+                Vec_IntWriteEntry( vShards, iRepr, (iShard = iNext++ % nProcs) );
+            Vec_IntPushTwo( ThData[iShard].vPairs, iRepr, i );
+            nPairs++;
+        }
+        if ( nPairs < CEC4_PAIR_MIN )
+            break;
+        // derive one speculatively reduced AIG shared by the workers
+        Gia_ManStopP( &pShared );
+        pShared = Cec4_ManDeriveSpec( p, pMan->pPars, vOwn, vSpec );
+        // solve the shards
+        Vec_IntFill( vStatus, Gia_ManObjNum(p), 2 ); // not solved
+        ABC_FENCE();
+        for ( k = 0; k < nProcs; k++ )
+        {
+            ThData[k].pShared  = pShared;
+            ThData[k].fWorking = 1;
+        }
+        for ( k = 0; k < nProcs; k++ )
+            while ( ThData[k].fWorking );
+        ABC_FENCE();
+        // accept the proofs before the classes are refined
+        Cec4_ManSweepParAccept( pMan, vStatus, vValid );
+        for ( k = 0; k < nProcs; k++ )
+            nSat += Cec4_ManSweepParMerge( pMan, ThData[k].vCexes );
+        if ( p->iPatsPi > 0 )
+            Cec4_ManSweepResimulate( pMan );
+        if ( pMan->pPars->fVerbose )
+        {
+            printf( "Parallel round %3d : Pairs = %8d  P = %8d  D = %8d  F = %8d  ", r, nPairs, 
+                pMan->nSatUnsat - nSatUnsat, nSat, pMan->nSatUndec - nSatUndec );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk2 );
+        }
+        if ( nSat == 0 && pMan->nSatUndec == nSatUndec )
+            break;
+    }
+    // stop the workers
+    for ( i = 0; i < nProcs; i++ )
+    {
+        Cec4_Man_t * pWorker = ThData[i].pMan;
+        assert( !ThData[i].fWorking );
+        ThData[i].pMan = NULL;
+        ABC_FENCE();
+        ThData[i].fWorking = 1;
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        Cec4_ManStopWorker( pWorker, pMan );
+        Vec_IntFree( ThData[i].vPairs );
+        Vec_IntFree( ThData[i].vCexes );
+    }
+    Gia_ManStopP( &pShared );
+    Vec_IntFree( vStatus );
+    Vec_IntFree( vShards );
+    Vec_BitFree( vValid );
+    Vec_IntFree( vOwn );
+    Vec_IntFree( vSpec );
+    pMan->timeSatPar += Abc_Clock() - clk;
+}
+
+#endif // pthreads are used
+
+
+/**Function*************************************************************
+
+  Synopsis    [Performs SAT sweeping.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
     Cec4_Man_t * pMan = Cec4_ManCreate( p, pPars ); 
     Gia_Obj_t * pObj, * pRepr; 
     int i, fSimulate = 1;
     if ( pPars->fVerbose )
-        printf( "Solver type = %d. Simulate %d words in %d rounds. SAT with %d confs. Recycle after %d SAT calls.\n", 
-            pPars->jType, pPars->nWords, pPars->nRounds, pPars->nBTLimit, pPars->nCallsRecycle );
+        printf( "Solver type = %d. Simulate %d words in %d rounds (%s). SAT with %d confs. Recycle after %d SAT calls.\n", 
+            pPars->jType, pPars->nWords >= ABC_SIMD_MIN_WORDS ? Abc_SimdPadWords(pPars->nWords) : pPars->nWords, pPars->nRounds, pPars->nWords >= ABC_SIMD_MIN_WORDS ? Abc_SimdName() : "scalar", pPars->nBTLimit, pPars->nCallsRecycle );
 
     // this is currently needed to have a correct mapping
     Gia_ManForEachCi( p, pObj, i )
@@ -1798,6 +2205,10 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
     pMan->nSatSat = 0;
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nProcs > 1 )
+        Cec4_ManSweepPar( pMan );
+#endif
     pMan->pNew = Cec4_ManStartNew( p );
     Gia_ManForEachAnd( p, pObj, i )
     {
@@ -1820,6 +2231,15 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
         pRepr = Gia_ObjReprObj( p, i );
         if ( pRepr == NULL )
             continue;
+        if ( pPars->nProcs > 1 && Gia_ObjProved(p, i) ) // proved by parallel sweeping
+        {
+            pObj->Value = Abc_LitNotCond( pRepr->Value, pObj->fPhase ^ pRepr->fPhase );
+            if ( Gia_ObjId(p, pRepr) == 0 )
+                pMan->iLastConst = i;
+            continue;
+        }
+        if ( pPars->nProcs > 1 && Gia_ObjFailed(p, i) ) // undecided by parallel sweeping
+            continue;
         if ( 1 ) // select representative based on recent counter-examples
         {
             pRepr = Cec4_ManFindRepr( p, pMan, i );
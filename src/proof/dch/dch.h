@@ -53,6 +53,7 @@ struct Dch_Pars_t_
     int              fUseGia;       // uses GIA package 
     int              fUseCSat;      // uses circuit-based solver
     int              fUseNew;       // uses new implementation
+    int              fUseNative;    // uses GIA-native choice computation
     int              fLightSynth;   // uses lighter version of synthesis
     int              fSkipRedSupp;  // skip choices with redundant support vars
     int              fVerbose;      // verbose stats
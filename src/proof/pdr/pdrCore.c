@@ -697,7 +697,7 @@ int Pdr_ManGeneralize( Pdr_Man_t * p, int k, Pdr_Set_t * pCube, Pdr_Set_t ** ppP
         return -1;
     if ( RetValue == 0 )
     {
-        p->tGeneral += clock() - clk;
+        p->tGeneral += Abc_Clock() - clk;
         return 0;
     }
 
@@ -988,6 +988,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             }
             Vec_VecPush( p->vClauses, k, pCubeMin );   // consume ref
             p->nCubes++;
+            if ( p->pExc )
+                Pdr_ManExportLemma( p, k, pCubeMin );
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
@@ -1286,6 +1288,9 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
             Pdr_ManPrintClauses( p, 0 );
         }
+        // add lemmas derived by the concurrent instances
+        if ( p->pExc )
+            Pdr_ManImportLemmas( p );
         // push clauses into this timeframe
         RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
@@ -1393,6 +1398,8 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
 int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
 {
     Pdr_Man_t * p;
+    Aig_Man_t * pAigUsed;
+    Pdr_Par_t * pParsUsed;
     int k, RetValue;
     abctime clk = Abc_Clock();
     if ( pPars->nTimeOutOne && !pPars->fSolveAll )
@@ -1413,8 +1420,13 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSolveAll ?    "yes" : "no" );
     }
     ABC_FREE( pAig->pSeqModel );
-    p = Pdr_ManStart( pAig, pPars, NULL );
-    RetValue = Pdr_ManSolveInt( p );
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && !pPars->fUseBridge )
+        p = Pdr_ManSolvePar( pAig, pPars, &RetValue );
+    else
+    {
+        p = Pdr_ManStart( pAig, pPars, NULL );
+        RetValue = Pdr_ManSolveInt( p );
+    }
     if ( RetValue == 0 )
         assert( pAig->pSeqModel != NULL || p->vCexes != NULL );
     if ( p->vCexes )
@@ -1433,7 +1445,14 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
     else if ( RetValue == 1 )
         Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( p, RetValue!=1 ) );
     p->tTotal += Abc_Clock() - clk;
+    pAigUsed  = p->pAig;
+    pParsUsed = p->pPars;
     Pdr_ManStop( p );
+    if ( pAigUsed != pAig ) // the copies used by the winning instance
+    {
+        Aig_ManStop( pAigUsed );
+        ABC_FREE( pParsUsed );
+    }
     pPars->iFrame--;
     // convert all -2 (unknown) entries into -1 (undec)
     if ( pPars->vOutMap )
@@ -0,0 +1,369 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Portfolio of concurrent PDR instances with lemma exchange.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: pdrPth.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifndef ABC_USE_PTHREADS
+
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue )
+{
+    Pdr_Man_t * p = Pdr_ManStart( pAig, pPars, NULL );
+    *pRetValue = Pdr_ManSolveInt( p );
+    return p;
+}
+void Pdr_ManExportLemma( Pdr_Man_t * p, int k, Pdr_Set_t * pCube ) {}
+void Pdr_ManImportLemmas( Pdr_Man_t * p )                          {}
+
+#else // pthreads are used
+
+#define PDR_THR_MAX       64   // the largest number of instances
+#define PDR_EXC_MAX   262144   // the largest number of lemmas exchanged
+#define PDR_EXC_CONF     100   // conflict limit when checking an imported lemma
+
+// lemmas shared by the instances; the store is append-only: a writer reserves
+// a slot by an atomic increment and publishes the lemma by writing the cube last,
+// so readers never take a lock and skip the slots that are not yet published
+struct Pdr_Exc_t_
+{
+    Pdr_Set_t * volatile * pCubes;  // lemmas over flop literals (NULL if not published)
+    int *                  pFrames; // the frame where each lemma holds
+    int *                  pOwners; // the instance that derived each lemma
+    volatile int           nUsed;   // the number of reserved slots
+    volatile int           iWinner; // the first instance to reach the verdict
+    volatile int           fStop;   // set when the portfolio should terminate
+    int                 (* pFuncStop)(int); // the external callback of this run
+    int                    RunId;   // the run ID passed to the external callback
+};
+
+// information given to the thread
+typedef struct Pdr_ThData_t_
+{
+    Aig_Man_t * pAig;
+    Pdr_Par_t   Pars;
+    Pdr_Man_t * pMan;
+    Pdr_Exc_t * pExc;
+    char *      pConfig;
+    int         Id;
+    int         RetValue;
+} Pdr_ThData_t;
+
+// the store of the run executed by the current thread; the stopping callback
+// receives only an integer, so each worker sets this pointer when it starts
+static ABC_THREAD_LOCAL Pdr_Exc_t * s_pExcThis = NULL;
+
+// call back procedure for the instances
+static int Pdr_ManCallBackToStop( int RunId )
+{
+    Pdr_Exc_t * pExc = s_pExcThis;
+    return pExc && (pExc->fStop || (pExc->pFuncStop && pExc->pFuncStop(pExc->RunId)));
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the lemma derived by this instance.]
+
+  Description [Only the flop literals are exported. When the store
+  is full, the lemma is silently dropped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManExportLemma( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Exc_t * pExc = p->pExc;
+    Pdr_Set_t * pCopy;
+    int iSlot;
+    if ( pExc->nUsed >= PDR_EXC_MAX )
+        return;
+    iSlot = ABC_FETCH_ADD( &pExc->nUsed, 1 );
+    if ( iSlot >= PDR_EXC_MAX )
+        return;
+    pCopy = Pdr_SetDup( pCube );
+    pCopy->nTotal = pCopy->nLits;
+    pExc->pFrames[iSlot] = k;
+    pExc->pOwners[iSlot] = p->iExcId;
+    ABC_FENCE();
+    pExc->pCubes[iSlot] = pCopy;
+    p->nExcOut++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemmas published by other instances.]
+
+  Description [Each lemma is re-checked in this instance before it is
+  added: it should exclude the initial state and be inductive relative
+  to the previous frame. As a result, the frames of this instance
+  satisfy the usual PDR invariants, no matter how the other instances
+  are configured.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManImportLemmas( Pdr_Man_t * p )
+{
+    Pdr_Exc_t * pExc = p->pExc;
+    Pdr_Set_t * pCube;
+    int i, k, RetValue, kMax = Vec_PtrSize(p->vSolvers)-1;
+    int nUsed = Abc_MinInt( pExc->nUsed, PDR_EXC_MAX );
+    for ( ; p->iExcRead < nUsed; p->iExcRead++ )
+    {
+        if ( (pCube = pExc->pCubes[p->iExcRead]) == NULL ) // not yet published
+            break;
+        ABC_FENCE();
+        if ( pExc->pOwners[p->iExcRead] == p->iExcId )
+            continue;
+        p->nExcTried++;
+        k = Abc_MinInt( pExc->pFrames[p->iExcRead], kMax );
+        if ( Pdr_SetIsInit(pCube, -1) )
+            continue;
+        if ( Pdr_ManCheckContainment( p, k, pCube ) )
+            continue;
+        RetValue = Pdr_ManCheckCube( p, k-1, pCube, NULL, PDR_EXC_CONF, 0, 1 );
+        if ( RetValue != 1 ) // reachable or undecided
+            continue;
+        pCube = Pdr_SetDup( pCube );
+        Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+        for ( i = 1; i <= k; i++ )
+            Pdr_ManSolverAddClause( p, i, pCube );
+        p->iUseFrame = Abc_MinInt( p->iUseFrame, k );
+        p->nExcIn++;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Changes the parameters of one instance of the portfolio.]
+
+  Description [Instance 0 runs with the user's parameters. Other instances
+  use a different random seed and toggle the generalization order, CNF
+  computation, proof-obligation handling, etc.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Pdr_ManParConfig( Pdr_Par_t * pPars, int iInst )
+{
+    if ( iInst == 0 )
+        return "default";
+    pPars->nRandomSeed += 1000003 * iInst;
+    switch ( (iInst - 1) % 6 )
+    {
+    case 0: pPars->fMonoCnf ^= 1;                            return "mono CNF";
+    case 1: pPars->fReuseProofOblig ^= 1;                    return "reuse oblig";
+    case 2: pPars->fFlopOrder ^= 1; pPars->fTwoRounds ^= 1;  return "flop order";
+    case 3: pPars->fSkipDown ^= 1;  pPars->fCtgs = !pPars->fSkipDown; return "down/CTG";
+    case 4: pPars->fFlopPrio ^= 1;                           return "flop prio";
+    case 5: pPars->fSimpleGeneral ^= 1;                      return "simple gen";
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one instance of the portfolio.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManWorkerThread( void * pArg )
+{
+    Pdr_ThData_t * pThData = (Pdr_ThData_t *)pArg;
+    abctime clk = Abc_Clock();
+    Pdr_Man_t * p;
+    s_pExcThis = pThData->pExc;
+    p = Pdr_ManStart( pThData->pAig, &pThData->Pars, NULL );
+    p->pExc   = pThData->pExc;
+    p->iExcId = pThData->Id;
+    pThData->pMan     = p;
+    pThData->RetValue = Pdr_ManSolveInt( p );
+    // a counter-example is trusted only after it is checked
+    if ( pThData->RetValue == 0 && (p->pAig->pSeqModel == NULL || !Saig_ManVerifyCex(p->pAig, p->pAig->pSeqModel)) )
+        pThData->RetValue = -1;
+    p->tTotal += Abc_Clock() - clk;
+    // the first decided instance (or the one running under user's limits) stops the others
+    if ( pThData->RetValue != -1 || pThData->Id == 0 )
+    {
+        if ( pThData->RetValue != -1 )
+            ABC_CAS( &pThData->pExc->iWinner, -1, pThData->Id );
+        pThData->pExc->fStop = 1;
+    }
+    s_pExcThis = NULL;
+    pthread_exit( NULL );
+    assert(0);
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using several concurrent PDR instances.]
+
+  Description [Each instance works on its own copy of the AIG. Returns
+  the manager of the winning instance (or instance 0, if undecided),
+  whose counter-example, if any, is transferred to pAig. The manager
+  keeps a copy of the parameters of the winner, with the reporting
+  options taken from pPars. The caller stops the manager and frees
+  the AIG copy and the parameters it points to.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Pdr_Man_t * Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars, int * pRetValue )
+{
+    Pdr_ThData_t ThData[PDR_THR_MAX];
+    pthread_t WorkerThread[PDR_THR_MAX];
+    Pdr_Exc_t Exc, * pExc = &Exc;
+    Pdr_Man_t * p;
+    int i, k, status, iBest, nProcs = Abc_MinInt( pPars->nProcs, PDR_THR_MAX );
+    abctime clk = Abc_Clock();
+    // prepare the store
+    memset( pExc, 0, sizeof(Pdr_Exc_t) );
+    pExc->pCubes  = (Pdr_Set_t * volatile *)ABC_CALLOC( Pdr_Set_t *, PDR_EXC_MAX );
+    pExc->pFrames = ABC_ALLOC( int, PDR_EXC_MAX );
+    pExc->pOwners = ABC_ALLOC( int, PDR_EXC_MAX );
+    pExc->iWinner   = -1;
+    pExc->pFuncStop = pPars->pFuncStop;
+    pExc->RunId     = pPars->RunId;
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running %d PDR instances with lemma exchange.\n", nProcs );
+    // start the instances
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pAig     = Aig_ManDupSimple( pAig );
+        ThData[i].Pars     = *pPars;
+        ThData[i].pMan     = NULL;
+        ThData[i].pExc     = pExc;
+        ThData[i].Id       = i;
+        ThData[i].RetValue = -1;
+        ThData[i].pConfig  = Pdr_ManParConfig( &ThData[i].Pars, i );
+        ThData[i].Pars.nProcs       = 1;
+        ThData[i].Pars.fVerbose     = 0;
+        ThData[i].Pars.fVeryVerbose = 0;
+        ThData[i].Pars.fNotVerbose  = 1;
+        ThData[i].Pars.fSilent      = 1;
+        ThData[i].Pars.fDumpInv     = 0;
+        ThData[i].Pars.pFuncStop    = Pdr_ManCallBackToStop;
+        // only the first instance obeys the runtime limits of the user
+        if ( i > 0 )
+            ThData[i].Pars.nTimeOut = ThData[i].Pars.nTimeOutGap = 0;
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+    }
+    iBest = pExc->iWinner >= 0 ? pExc->iWinner : 0;
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nProcs; i++ )
+        {
+            p = ThData[i].pMan;
+            Abc_Print( 1, "Instance %2d (%-11s) : %-9s  Frame = %3d.  Clauses = %6d.  Lemmas: out = %6d  tried = %6d  in = %6d\n",
+                i, ThData[i].pConfig,
+                ThData[i].RetValue == 1 ? "proved" : ThData[i].RetValue == 0 ? "failed" : "undecided",
+                ThData[i].Pars.iFrame, p->nCubes, p->nExcOut, p->nExcTried, p->nExcIn );
+        }
+        if ( pExc->iWinner >= 0 )
+            Abc_Print( 1, "Instance %d reached the verdict.  ", pExc->iWinner );
+        else
+            Abc_Print( 1, "No instance reached the verdict.  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // clean up other instances
+    for ( i = 0; i < nProcs; i++ )
+    {
+        if ( i == iBest )
+            continue;
+        Pdr_ManStop( ThData[i].pMan );
+        Aig_ManStop( ThData[i].pAig );
+    }
+    for ( k = 0; k < Abc_MinInt(pExc->nUsed, PDR_EXC_MAX); k++ )
+        if ( pExc->pCubes[k] )
+            Pdr_SetDeref( pExc->pCubes[k] );
+    ABC_FREE( pExc->pCubes );
+    ABC_FREE( pExc->pFrames );
+    ABC_FREE( pExc->pOwners );
+    // pass the result of the winner to the caller
+    p = ThData[iBest].pMan;
+    p->pExc = NULL;
+    p->pPars = ABC_ALLOC( Pdr_Par_t, 1 );
+    *p->pPars = ThData[iBest].Pars;
+    p->pPars->fVerbose     = pPars->fVerbose;
+    p->pPars->fVeryVerbose = pPars->fVeryVerbose;
+    p->pPars->fNotVerbose  = pPars->fNotVerbose;
+    p->pPars->fSilent      = pPars->fSilent;
+    p->pPars->fDumpInv     = pPars->fDumpInv;
+    p->pPars->pFuncStop    = pPars->pFuncStop;
+    pPars->iFrame      = ThData[iBest].Pars.iFrame;
+    pPars->nFailOuts   = ThData[iBest].Pars.nFailOuts;
+    pPars->nProveOuts  = ThData[iBest].Pars.nProveOuts;
+    pPars->timeLastSolved = ThData[iBest].Pars.timeLastSolved;
+    pAig->pSeqModel = p->pAig->pSeqModel;
+    p->pAig->pSeqModel = NULL;
+    if ( ThData[iBest].RetValue == 1 && !pPars->fSilent )
+    {
+        Pdr_ManReportInvariant( p );
+        Pdr_ManVerifyInvariant( p );
+    }
+    *pRetValue = ThData[iBest].RetValue;
+    return p;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -109,6 +109,7 @@ struct Saig_ParBmc_t_
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
+    int         nProcs;         // the number of threads solving outputs
     int         fVerbose;       // verbose 
     int         fNotVerbose;    // skip line-by-line print-out 
     char *      pLogFileName;   // log file name
@@ -27,6 +27,17 @@
 #include "misc/vec/vecWec.h"
 #include "bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -68,6 +79,7 @@ struct Gia_ManBmc_t_
     int               nObjNums;    // SAT objects
     int               nWordNum;    // unsigned words for ternary simulation
     char * pSopSizes, ** pSops;    // CNF representation
+    Vec_Int_t *       vClaLog;     // clauses shared with the solvers of worker threads
 };
 
 extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
@@ -825,6 +837,7 @@ void Saig_Bmc3ManStop( Gia_ManBmc_t * p )
     Vec_IntFree( p->vMapRefs );
 //    Vec_VecFree( p->vSects );
     Vec_IntFree( p->vId2Num );
+    Vec_IntFreeP( &p->vClaLog );
     Vec_VecFree( (Vec_Vec_t *)p->vId2Var );
     Vec_PtrFreeFree( p->vTerInfo );
     if ( p->pSat )  sat_solver_delete( p->pSat );
@@ -1033,6 +1046,11 @@ static inline void Saig_ManBmcAddClauses( Gia_ManBmc_t * p, int uTruth, int Lits
             {
                 if ( !sat_solver_addclause( p->pSat, ClaLits, ClaLits+nClaLits ) )
                     assert( 0 );
+                if ( p->vClaLog )
+                {
+                    Vec_IntPush( p->vClaLog, nClaLits );
+                    Vec_IntPushArray( p->vClaLog, ClaLits, nClaLits );
+                }
             }
         }
     }
@@ -1347,6 +1365,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
+    p->nProcs         =     1;    // the number of threads solving outputs
     p->fVerbose       =     0;    // verbose 
     p->fNotVerbose    =     0;    // skip line-by-line print-out 
     p->iFrame         =    -1;    // explored up to this frame
@@ -1447,6 +1466,411 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
         return sat_solver_solve( p->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Data structures for solving outputs by several threads.]
+
+  Description [In the multi-output mode (bmc3 -a), the outputs of each
+  timeframe can be solved concurrently. The unrolling and its CNF are
+  derived by the main thread as before. The clauses are also recorded
+  in the clause log of the BMC manager, which is read-only while the
+  threads are running. Each worker thread owns a SAT solver and loads
+  the new part of the log before solving. The main thread solves outputs
+  using the solver of the BMC manager. Outputs are given to the threads
+  one at a time in the order of their indexes. When the timeframe is
+  finished, the main thread processes the results in the same order
+  as in the single-threaded mode, so that the reported results are
+  the same.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define BMC3_UNSOLVED  2   // the output is to be solved in this timeframe
+#define BMC3_SKIPPED   3   // the output is not solved in this timeframe
+#define BMC3_THR_MAX  64   // the max number of threads
+
+typedef struct Bmc3_ParMan_t_ Bmc3_ParMan_t;
+struct Bmc3_ParMan_t_
+{
+    Gia_ManBmc_t *    p;           // BMC manager
+    int               nProcs;      // the number of threads
+    int               fGenCex;     // derive counter-examples in the threads
+    sat_solver *      pSolvers[BMC3_THR_MAX]; // solvers (the first one belongs to the BMC manager)
+    int               pLoaded[BMC3_THR_MAX];  // the part of the clause log loaded into each solver
+    // the current timeframe
+    int               iFrame;      // the timeframe
+    abctime           nTimeLeft;   // the runtime left before the timeout
+    abctime           nGapLeft;    // the runtime left before the gap timeout
+    Vec_Int_t *       vOuts;       // outputs to be solved
+    Vec_Int_t *       vLits;       // literals of the outputs
+    Vec_Int_t *       vStatus;     // status of each output
+    Vec_Wrd_t *       vTimes;      // solving time of each output
+    Vec_Ptr_t *       vCexes;      // counter-examples of satisfiable outputs
+    Vec_Ptr_t *       vFails;      // outputs asserted by the same assignment
+    int               iNext;       // the next output to be solved
+    int               StopReason;  // 1 = gap timeout; 2 = timeout; 3 = callback
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t   Mutex;       // protects iNext and StopReason
+#endif
+};
+
+typedef struct Bmc3_ThData_t_
+{
+    Bmc3_ParMan_t *   q;
+    int               iThread;
+} Bmc3_ThData_t;
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the data for concurrent solving.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc3_ParManClean( Bmc3_ParMan_t * q )
+{
+    Abc_Cex_t * pCex;
+    Vec_Int_t * vFails;
+    int i;
+    Vec_PtrForEachEntry( Abc_Cex_t *, q->vCexes, pCex, i )
+        if ( pCex )
+            Abc_CexFree( pCex );
+    Vec_PtrForEachEntry( Vec_Int_t *, q->vFails, vFails, i )
+        if ( vFails )
+            Vec_IntFree( vFails );
+    Vec_PtrFill( q->vCexes, Vec_PtrSize(q->vCexes), NULL );
+    Vec_PtrFill( q->vFails, Vec_PtrSize(q->vFails), NULL );
+    Vec_IntFill( q->vStatus, Vec_IntSize(q->vStatus), BMC3_SKIPPED );
+    Vec_IntFill( q->vLits, Vec_IntSize(q->vLits), -1 );
+    Vec_IntClear( q->vOuts );
+}
+Bmc3_ParMan_t * Bmc3_ParManStart( Gia_ManBmc_t * p, int nProcs )
+{
+    Bmc3_ParMan_t * q;
+    int i, nPos = Saig_ManPoNum(p->pAig);
+    assert( p->pSat != NULL && nProcs > 1 );
+    q = ABC_CALLOC( Bmc3_ParMan_t, 1 );
+    q->p       = p;
+    q->nProcs  = Abc_MinInt( nProcs, BMC3_THR_MAX );
+    q->fGenCex = p->pPars->fUseBridge || p->pPars->fStoreCex;
+    q->vOuts   = Vec_IntAlloc( nPos );
+    q->vLits   = Vec_IntStartFull( nPos );
+    q->vStatus = Vec_IntStart( nPos );
+    q->vTimes  = Vec_WrdStart( nPos );
+    q->vCexes  = Vec_PtrStart( nPos );
+    q->vFails  = Vec_PtrStart( nPos );
+    q->pSolvers[0] = p->pSat;
+    for ( i = 1; i < q->nProcs; i++ )
+    {
+        sat_solver * pSat = sat_solver_new();
+        pSat->nLearntStart = p->pSat->nLearntStart;
+        pSat->nLearntDelta = p->pSat->nLearntDelta;
+        pSat->nLearntRatio = p->pSat->nLearntRatio;
+        pSat->nLearntMax   = p->pSat->nLearntMax;
+        pSat->fNoRestarts  = p->pSat->fNoRestarts;
+        pSat->RunId        = p->pSat->RunId;
+        pSat->pFuncStop    = p->pSat->pFuncStop;
+        q->pSolvers[i]     = pSat;
+    }
+    p->vClaLog = Vec_IntAlloc( 1 << 16 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &q->Mutex, NULL );
+#endif
+    Bmc3_ParManClean( q );
+    return q;
+}
+void Bmc3_ParManStop( Bmc3_ParMan_t * q )
+{
+    int i;
+    Bmc3_ParManClean( q );
+    for ( i = 1; i < q->nProcs; i++ )
+        sat_solver_delete( q->pSolvers[i] );
+    Vec_IntFree( q->vOuts );
+    Vec_IntFree( q->vLits );
+    Vec_IntFree( q->vStatus );
+    Vec_WrdFree( q->vTimes );
+    Vec_PtrFree( q->vCexes );
+    Vec_PtrFree( q->vFails );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &q->Mutex );
+#endif
+    ABC_FREE( q );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the output to be solved in this timeframe.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc3_ParManAddOutput( Bmc3_ParMan_t * q, int iOut, int Lit )
+{
+    Vec_IntPush( q->vOuts, iOut );
+    Vec_IntWriteEntry( q->vLits, iOut, Lit );
+    Vec_IntWriteEntry( q->vStatus, iOut, BMC3_UNSOLVED );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds a clause to the solver of the BMC manager and to the log.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmc3_ParManAddClause( Gia_ManBmc_t * p, int * pLits, int nLits )
+{
+    if ( p->vClaLog )
+    {
+        Vec_IntPush( p->vClaLog, nLits );
+        Vec_IntPushArray( p->vClaLog, pLits, nLits );
+    }
+    return sat_solver_addclause( p->pSat, pLits, pLits + nLits );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the clauses loaded into all solvers from the log.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc3_ParManTrimLog( Bmc3_ParMan_t * q )
+{
+    Vec_Int_t * vLog = q->p->vClaLog;
+    int i, nLoaded = Vec_IntSize(vLog);
+    for ( i = 1; i < q->nProcs; i++ )
+        nLoaded = Abc_MinInt( nLoaded, q->pLoaded[i] );
+    if ( nLoaded == 0 )
+        return;
+    memmove( Vec_IntArray(vLog), Vec_IntEntryP(vLog, nLoaded), sizeof(int) * (Vec_IntSize(vLog) - nLoaded) );
+    Vec_IntShrink( vLog, Vec_IntSize(vLog) - nLoaded );
+    for ( i = 1; i < q->nProcs; i++ )
+        q->pLoaded[i] -= nLoaded;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example using the given solver.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Bmc3_ParGenerateCex( Gia_ManBmc_t * p, sat_solver * pSat, int f, int i )
+{
+    Aig_Obj_t * pObjPi;
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Aig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), Saig_ManPoNum(p->pAig), f*Saig_ManPoNum(p->pAig)+i );
+    int j, k, iBit = Saig_ManRegNum(p->pAig);
+    for ( j = 0; j <= f; j++, iBit += Saig_ManPiNum(p->pAig) )
+        Saig_ManForEachPi( p->pAig, pObjPi, k )
+        {
+            int iLit = Saig_ManBmcLiteral( p, pObjPi, j );
+            if ( iLit != ~0 && sat_solver_var_value(pSat, lit_var(iLit)) )
+                Abc_InfoSetBit( pCex->pData, iBit + k );
+        }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one output by one thread.]
+
+  Description [The runtime limits are relative to the CPU time of
+  the calling thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc3_ParSolveOutput( Bmc3_ParMan_t * q, sat_solver * pSat, int iOut, abctime nTimeToStop )
+{
+    Gia_ManBmc_t * p = q->p;
+    int Lit = Vec_IntEntry( q->vLits, iOut ), iOut2, k, status;
+    abctime clk = Abc_Clock();
+    if ( Lit < 2 )
+    {
+        // constant outputs are processed by the main thread using its solver
+        Vec_IntWriteEntry( q->vStatus, iOut, Lit ? l_True : l_False );
+        Vec_WrdWriteEntry( q->vTimes, iOut, 0 );
+        return;
+    }
+    sat_solver_compress( pSat );
+    if ( p->pTime4Outs )
+        sat_solver_set_runtime_limit( pSat, p->pTime4Outs[iOut] + Abc_Clock() );
+    else
+        sat_solver_set_runtime_limit( pSat, nTimeToStop );
+    status = sat_solver_solve( pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    if ( status == l_False )
+    {
+        Lit = lit_neg( Lit );
+        sat_solver_addclause( pSat, &Lit, &Lit + 1 );
+    }
+    else if ( status == l_True )
+    {
+        Vec_Int_t * vFails = Vec_IntAlloc( 4 );
+        Vec_IntForEachEntry( q->vOuts, iOut2, k )
+        {
+            int Lit2 = Vec_IntEntry( q->vLits, iOut2 );
+            if ( Lit2 == 1 || (Lit2 > 1 && sat_solver_var_value(pSat, lit_var(Lit2)) != Abc_LitIsCompl(Lit2)) )
+                Vec_IntPush( vFails, iOut2 );
+        }
+        Vec_PtrWriteEntry( q->vFails, iOut, vFails );
+        if ( q->fGenCex )
+            Vec_PtrWriteEntry( q->vCexes, iOut, Bmc3_ParGenerateCex(p, pSat, q->iFrame, iOut) );
+    }
+    Vec_WrdWriteEntry( q->vTimes, iOut, (word)(Abc_Clock() - clk) );
+    Vec_IntWriteEntry( q->vStatus, iOut, status );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves outputs of the current timeframe by one thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc3_ParSolveThread( Bmc3_ParMan_t * q, int iThread )
+{
+    Gia_ManBmc_t * p = q->p;
+    sat_solver * pSat = q->pSolvers[iThread];
+    abctime clkStart   = Abc_Clock();
+    abctime nTimeToStop = q->nTimeLeft ? clkStart + q->nTimeLeft : 0;
+    abctime nTimeToGap  = q->nGapLeft  ? clkStart + q->nGapLeft  : 0;
+    int k, iOut, nLits;
+    // load the new clauses
+    if ( iThread > 0 )
+    {
+        Vec_Int_t * vLog = p->vClaLog;
+        sat_solver_setnvars( pSat, p->nSatVars );
+        for ( k = q->pLoaded[iThread]; k < Vec_IntSize(vLog); k += nLits + 1 )
+        {
+            nLits = Vec_IntEntry( vLog, k );
+            sat_solver_addclause( pSat, Vec_IntEntryP(vLog, k+1), Vec_IntEntryP(vLog, k+1+nLits) );
+        }
+        q->pLoaded[iThread] = k;
+    }
+    // solve the outputs
+    while ( 1 )
+    {
+        iOut = -1;
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_lock( &q->Mutex );
+#endif
+        if ( q->StopReason == 0 )
+        {
+            if ( nTimeToGap && Abc_Clock() > nTimeToGap )
+                q->StopReason = 1;
+            else if ( nTimeToStop && Abc_Clock() > nTimeToStop )
+                q->StopReason = 2;
+            else if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+                q->StopReason = 3;
+            else if ( q->iNext < Vec_IntSize(q->vOuts) )
+                iOut = Vec_IntEntry( q->vOuts, q->iNext++ );
+        }
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_unlock( &q->Mutex );
+#endif
+        if ( iOut == -1 )
+            break;
+        Bmc3_ParSolveOutput( q, pSat, iOut, nTimeToStop );
+        // stop the others after an undecided output, unless the outputs have their own limits
+        if ( Vec_IntEntry(q->vStatus, iOut) == l_Undef && p->pTime4Outs == NULL )
+        {
+#ifdef ABC_USE_PTHREADS
+            pthread_mutex_lock( &q->Mutex );
+#endif
+            q->iNext = Vec_IntSize(q->vOuts);
+#ifdef ABC_USE_PTHREADS
+            pthread_mutex_unlock( &q->Mutex );
+#endif
+        }
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+void * Bmc3_ParWorkerThread( void * pArg )
+{
+    Bmc3_ThData_t * pThData = (Bmc3_ThData_t *)pArg;
+    Bmc3_ParSolveThread( pThData->q, pThData->iThread );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Solves outputs of the current timeframe concurrently.]
+
+  Description [The outputs should be added using Bmc3_ParManAddOutput().
+  All threads are started, even if there are fewer outputs, so that each
+  solver loads the new clauses and the log can be trimmed afterwards.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc3_ParSolveFrame( Bmc3_ParMan_t * q, int iFrame, abctime nTimeToStop )
+{
+    Saig_ParBmc_t * pPars = q->p->pPars;
+    abctime clk = Abc_Clock();
+    int i;
+    q->iFrame     = iFrame;
+    q->iNext      = 0;
+    q->StopReason = 0;
+    q->nTimeLeft  = nTimeToStop ? Abc_MaxInt( nTimeToStop - clk, 1 ) : 0;
+    q->nGapLeft   = (pPars->nTimeOutGap && pPars->timeLastSolved) ? Abc_MaxInt( pPars->timeLastSolved + pPars->nTimeOutGap * CLOCKS_PER_SEC - clk, 1 ) : 0;
+    if ( Vec_IntSize(q->vOuts) == 0 )
+        return;
+#ifdef ABC_USE_PTHREADS
+    {
+        Bmc3_ThData_t ThData[BMC3_THR_MAX];
+        pthread_t WorkerThread[BMC3_THR_MAX];
+        int status, nThreads = q->nProcs;
+        for ( i = 1; i < nThreads; i++ )
+        {
+            ThData[i].q       = q;
+            ThData[i].iThread = i;
+            status = pthread_create( WorkerThread + i, NULL, Bmc3_ParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        Bmc3_ParSolveThread( q, 0 );
+        for ( i = 1; i < nThreads; i++ )
+        {
+            status = pthread_join( WorkerThread[i], NULL );  assert( status == 0 );
+        }
+    }
+#else
+    Bmc3_ParSolveThread( q, 0 );
+#endif
+    Bmc3_ParManTrimLog( q );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Bounded model checking engine.]
@@ -1461,13 +1885,14 @@ int Saig_ManCallSolver( Gia_ManBmc_t * p, int Lit )
 int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
 {
     Gia_ManBmc_t * p;
+    Bmc3_ParMan_t * q = NULL;
     Aig_Obj_t * pObj;
     Abc_Cex_t * pCexNew, * pCexNew0;
     FILE * pLogFile = NULL;
     unsigned * pInfo;
     int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
-    int i, f, k, Lit, status;
+    int i, f, k, Lit, status, fParSolved;
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
@@ -1504,6 +1929,17 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     }
     if ( pPars->fSolveAll && p->vCexes == NULL )
         p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
+    // solve the outputs of each timeframe by several threads
+    if ( pPars->nProcs > 1 )
+    {
+#ifdef ABC_USE_PTHREADS
+        if ( p->pSat && pPars->fSolveAll && !pPars->nFramesJump )
+            q = Bmc3_ParManStart( p, pPars->nProcs );
+        else
+#endif
+        if ( !pPars->fSilent )
+            Abc_Print( 1, "Concurrent solving is only supported by the default solver with \"-a\" and without \"-J\"; using one thread.\n" );
+    }
     if ( pPars->fVerbose )
     {
         Abc_Print( 1, "Running \"bmc3\". PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d. ObjNums =%6d.\n",// Sect =%3d.\n", 
@@ -1578,6 +2014,8 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
         if ( (pPars->nStart && f < pPars->nStart) || (nJumpFrame && f < nJumpFrame) )
             continue;
         // create CNF upfront
+        if ( q )
+            Bmc3_ParManClean( q );
         if ( pPars->fSolveAll )
         {
             Saig_ManForEachPo( pAig, pObj, i )
@@ -1604,9 +2042,13 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
                     continue;
                 // add constraints for this output
 clk2 = Abc_Clock();
-                Saig_ManBmcCreateCnf( p, pObj, f );
+                Lit = Saig_ManBmcCreateCnf( p, pObj, f );
 clkOther += Abc_Clock() - clk2;
+                if ( q )
+                    Bmc3_ParManAddOutput( q, i, Lit );
             }
+            if ( q )
+                Bmc3_ParSolveFrame( q, f, nTimeToStop );
         }
         // solve SAT
         clk = Abc_Clock(); 
@@ -1614,19 +2056,28 @@ clkOther += Abc_Clock() - clk2;
         {
             if ( i >= Saig_ManPoNum(pAig) )
                 break;
+            // outputs solved by the threads are processed without checking the time
+            status = q ? Vec_IntEntry(q->vStatus, i) : BMC3_SKIPPED;
+            fParSolved = (status == l_True || status == l_False || status == l_Undef);
+            if ( status == BMC3_UNSOLVED && q->StopReason == 3 )
+            {
+                if ( !pPars->fSilent )
+                    Abc_Print( 1, "Bmc3 got callbacks.\n" );
+                goto finish;
+            }
             // check for timeout
-            if ( pPars->nTimeOutGap && pPars->timeLastSolved && Abc_Clock() > pPars->timeLastSolved + pPars->nTimeOutGap * CLOCKS_PER_SEC )
+            if ( (!fParSolved && pPars->nTimeOutGap && pPars->timeLastSolved && Abc_Clock() > pPars->timeLastSolved + pPars->nTimeOutGap * CLOCKS_PER_SEC) || (status == BMC3_UNSOLVED && q->StopReason == 1) )
             {
                 Abc_Print( 1, "Reached gap timeout (%d seconds).\n",  pPars->nTimeOutGap );
                 goto finish;
             }
-            if ( nTimeToStop && Abc_Clock() > nTimeToStop )
+            if ( (!fParSolved && nTimeToStop && Abc_Clock() > nTimeToStop) || (status == BMC3_UNSOLVED && q->StopReason == 2) )
             {
                 if ( !pPars->fSilent )
                     Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
                 goto finish;
             }
-            if ( p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
+            if ( !fParSolved && p->pPars->pFuncStop && p->pPars->pFuncStop(p->pPars->RunId) )
             {
                 if ( !pPars->fSilent )
                     Abc_Print( 1, "Bmc3 got callbacks.\n" );
@@ -1640,12 +2091,14 @@ clkOther += Abc_Clock() - clk2;
                 continue;
             // add constraints for this output
 clk2 = Abc_Clock();
-            Lit = Saig_ManBmcCreateCnf( p, pObj, f );
+            Lit = fParSolved ? Vec_IntEntry( q->vLits, i ) : Saig_ManBmcCreateCnf( p, pObj, f );
 clkOther += Abc_Clock() - clk2;
             // solve this output
             fUnfinished = 0;
-            if ( p->pSat ) sat_solver_compress( p->pSat );
-            if ( p->pTime4Outs )
+            if ( p->pSat && !fParSolved ) sat_solver_compress( p->pSat );
+            if ( fParSolved )
+                clkOne = Abc_Clock() - (abctime)Vec_WrdEntry( q->vTimes, i );
+            else if ( p->pTime4Outs )
             {
                 assert( p->pTime4Outs[i] > 0 );
                 clkOne = Abc_Clock();
@@ -1657,8 +2110,9 @@ clkOther += Abc_Clock() - clk2;
                     sat_solver_set_runtime_limit( p->pSat, p->pTime4Outs[i] + Abc_Clock() );
             }
 clk2 = Abc_Clock();
-            status = Saig_ManCallSolver( p, Lit );
-clkSatRun = Abc_Clock() - clk2;
+            if ( !fParSolved )
+                status = Saig_ManCallSolver( p, Lit );
+clkSatRun = fParSolved ? (abctime)Vec_WrdEntry( q->vTimes, i ) : Abc_Clock() - clk2;
             if ( pLogFile )
                 fprintf( pLogFile, "Frame %5d  Output %5d  Time(ms) %8d %8d\n", f, i, 
                     Lit < 2 ? 0 : (int)(clkSatRun * 1000 / CLOCKS_PER_SEC),
@@ -1683,7 +2137,7 @@ nTimeUnsat += clkSatRun;
                     else if ( p->pSat3 )
                         status = bmcg_sat_solver_addclause( p->pSat3, &Lit, 1 );
                     else
-                        status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+                        status = Bmc3_ParManAddClause( p, &Lit, 1 );
                     assert( status );
                     // add learned units
                     if ( p->pSat )
@@ -1691,7 +2145,7 @@ nTimeUnsat += clkSatRun;
                         for ( k = 0; k < veci_size(&p->pSat->unit_lits); k++ )
                         {
                             Lit = veci_begin(&p->pSat->unit_lits)[k];
-                            status = sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+                            status = Bmc3_ParManAddClause( p, &Lit, 1 );
                             assert( status );
                         }
                         veci_resize(&p->pSat->unit_lits, 0);
@@ -1740,7 +2194,16 @@ nTimeSat += clkSatRun;
                         nOutDigits, i, f, nOutDigits, pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
                 if ( p->vCexes == NULL )
                     p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
-                pCexNew = (p->pPars->fUseBridge || pPars->fStoreCex) ? Saig_ManGenerateCex( p, f, i ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                pCexNew = NULL;
+                if ( fParSolved && Vec_PtrEntry(q->vCexes, i) )
+                {
+                    pCexNew = (Abc_Cex_t *)Vec_PtrEntry( q->vCexes, i );
+                    Vec_PtrWriteEntry( q->vCexes, i, NULL );
+                }
+                else if ( p->pPars->fUseBridge || pPars->fStoreCex )
+                    pCexNew = Saig_ManGenerateCex( p, f, i );
+                else
+                    pCexNew = (Abc_Cex_t *)(ABC_PTRINT_T)1;
                 pCexNew0 = NULL;
                 if ( p->pPars->fUseBridge )
                 {
@@ -1779,21 +2242,29 @@ nTimeSat += clkSatRun;
                     if ( p->vCexes && Vec_PtrEntry(p->vCexes, k) )
                         continue;
                     // check if this output is solved
-                    Lit = Saig_ManBmcCreateCnf( p, pObj, f );
-                    if ( p->pSat2 )
-                    {
-                        if ( satoko_read_cex_varvalue(p->pSat2, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
-                            continue;
-                    }
-                    else if ( p->pSat3 )
+                    if ( fParSolved && Vec_PtrEntry(q->vFails, i) )
                     {
-                        if ( bmcg_sat_solver_read_cex_varvalue(p->pSat3, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                        if ( Vec_IntFind( (Vec_Int_t *)Vec_PtrEntry(q->vFails, i), k ) == -1 )
                             continue;
                     }
                     else
                     {
-                        if ( sat_solver_var_value(p->pSat, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
-                            continue;
+                        Lit = Saig_ManBmcCreateCnf( p, pObj, f );
+                        if ( p->pSat2 )
+                        {
+                            if ( satoko_read_cex_varvalue(p->pSat2, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                                continue;
+                        }
+                        else if ( p->pSat3 )
+                        {
+                            if ( bmcg_sat_solver_read_cex_varvalue(p->pSat3, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                                continue;
+                        }
+                        else
+                        {
+                            if ( sat_solver_var_value(p->pSat, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
+                                continue;
+                        }
                     }
                     // write entry
                     pPars->nFailOuts++;
@@ -1881,6 +2352,8 @@ finish:
         Abc_Print( 1, "UNDEC = %.1f sec (%.1f %%)",   1.0*nTimeUndec/CLOCKS_PER_SEC, 100.0*nTimeUndec/(Abc_Clock() - clkTotal) );
         Abc_Print( 1, "\n" );
     }
+    if ( q )
+        Bmc3_ParManStop( q );
     Saig_Bmc3ManStop( p );
     fflush( stdout );
     if ( pLogFile )
@@ -77,6 +77,7 @@ struct Bmcs_Man_t_
     Vec_Int_t         vFr2Sat;             // mapping of objects in pFrames into SAT variables
     Vec_Int_t         vCiMap;              // maps CIs of pFrames into CIs/frames of GIA
     bmc_sat_solver *  pSats[PAR_THR_MAX];  // concurrent SAT solvers
+    satoko_share_t *  pShare;              // learned clauses exchanged by the solvers
     int               nSatVars;            // number of SAT variables used
     int               nSatVarsOld;         // number of SAT variables used
     int               fStopNow;            // signal when it is time to stop
@@ -398,6 +399,15 @@ Bmcs_Man_t * Bmcs_ManStart( Gia_Man_t * pGia, Bmc_AndPar_t * pPars )
         bmc_sat_solver_addclause( p->pSats[i], &Lit, 1 );  
         bmc_sat_solver_setstop( p->pSats[i], &p->fStopNow );
     }
+#ifndef ABC_USE_EXT_SOLVERS
+    // the solvers receive the same clauses and can exchange what they learn
+    if ( pPars->nProcs > 1 )
+    {
+        p->pShare = satoko_share_create( 8 );
+        for ( i = 0; i < pPars->nProcs; i++ )
+            satoko_share_attach( p->pSats[i], p->pShare, i );
+    }
+#endif
     p->nSatVars = 1;
     return p;
 }
@@ -413,6 +423,10 @@ void Bmcs_ManStop( Bmcs_Man_t * p )
     for ( i = 0; i < p->pPars->nProcs; i++ )
         if ( p->pSats[i] ) 
             bmc_sat_solver_stop( p->pSats[i] );
+#ifndef ABC_USE_EXT_SOLVERS
+    if ( p->pShare )
+        satoko_share_destroy( p->pShare );
+#endif
     ABC_FREE( p );
 }
 
@@ -173,6 +173,8 @@ extern int             Cnf_ManMapForCnf( Cnf_Man_t * p );
 extern void            Cnf_ManTransferCuts( Cnf_Man_t * p );
 extern void            Cnf_ManFreeCuts( Cnf_Man_t * p );
 extern void            Cnf_ManPostprocess( Cnf_Man_t * p );
+/*=== cnfStream.c ========================================================*/
+extern ABC_INT64_T     Cnf_DeriveFastStream( Aig_Man_t * p, char * pFileName, int fChangePol, int nProcs, int * pnVars );
 /*=== cnfUtil.c ========================================================*/
 extern Vec_Ptr_t *     Aig_ManScanMapping( Cnf_Man_t * p, int fCollect );
 extern Vec_Ptr_t *     Cnf_ManScanMapping( Cnf_Man_t * p, int fCollect, int fPreorder );
@@ -27,7 +27,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static Cnf_Man_t * s_pManCnf = NULL;
+// the CNF manager lives in the current ABC frame
+extern void * Abc_FrameReadManCnf();
+extern void   Abc_FrameSetManCnf( void * pMan );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -45,22 +47,22 @@ static Cnf_Man_t * s_pManCnf = NULL;
 ***********************************************************************/
 void Cnf_ManPrepare()
 {
-    if ( s_pManCnf == NULL )
+    if ( Abc_FrameReadManCnf() == NULL )
     {
 //        printf( "\n\nCreating CNF manager!!!!!\n\n" );
-        s_pManCnf = Cnf_ManStart();
+        Abc_FrameSetManCnf( Cnf_ManStart() );
     }
 }
 Cnf_Man_t * Cnf_ManRead()
 {
-    return s_pManCnf;
+    return (Cnf_Man_t *)Abc_FrameReadManCnf();
 }
 void Cnf_ManFree()
 {
-    if ( s_pManCnf == NULL )
+    if ( Abc_FrameReadManCnf() == NULL )
         return;
-    Cnf_ManStop( s_pManCnf );
-    s_pManCnf = NULL;
+    Cnf_ManStop( (Cnf_Man_t *)Abc_FrameReadManCnf() );
+    Abc_FrameSetManCnf( NULL );
 }
 
 
@@ -165,7 +167,7 @@ p->timeSave = Abc_Clock() - clk;
 Cnf_Dat_t * Cnf_Derive( Aig_Man_t * pAig, int nOutputs )
 {
     Cnf_ManPrepare();
-    return Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
+    return Cnf_DeriveWithMan( Cnf_ManRead(), pAig, nOutputs );
 }
  
 /**Function*************************************************************
@@ -219,7 +221,7 @@ p->timeSave = Abc_Clock() - clk;
 Cnf_Dat_t * Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin )
 {
     Cnf_ManPrepare();
-    return Cnf_DeriveOtherWithMan( s_pManCnf, pAig, fSkipTtMin );
+    return Cnf_DeriveOtherWithMan( Cnf_ManRead(), pAig, fSkipTtMin );
 }
 
 #if 0
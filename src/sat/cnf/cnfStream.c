@@ -0,0 +1,540 @@
+/**CFile****************************************************************
+
+  FileName    [cnfStream.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [Fast CNF computation streamed into a DIMACS file.]
+
+  Author      [ABC contributors]
+
+  Date        [Ver. 1.0. Started - October 17, 2026.]
+
+  Revision    [$Id: cnfStream.c,v 1.00 2026/10/17 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "cnf.h"
+#include "bool/kit/kit.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define CNF_STREAM_THR_MAX      64   // the largest number of threads
+#define CNF_STREAM_BLOCK   (1<<15)   // the number of roots given to a thread at a time
+#define CNF_STREAM_HEADER       24   // the width of the clause count in the header
+
+// the data of one thread; the scratch memory is reused in all rounds
+typedef struct Cnf_StreamThData_t_
+{
+    Aig_Man_t *  p;          // the AIG marked for the fast CNF computation
+    Vec_Ptr_t *  vRoots;     // the nodes with clauses in the order of writing
+    int *        pMap;       // the mapping of object IDs into SAT variables
+    char *       pPol;       // the polarity of each variable (or NULL)
+    int          iStart;     // the first root of this thread
+    int          iStop;      // the last root of this thread (not included)
+    int          nClauses;   // the number of clauses written into the buffer
+    Vec_Str_t *  vText;      // the DIMACS text of the clauses
+    // scratch memory
+    Vec_Ptr_t *  vLeaves;
+    Vec_Ptr_t *  vNodes;
+    Vec_Int_t *  vCover;
+    Vec_Int_t *  vClauses;
+    // the objects of the current cone (instead of traversal IDs and iData);
+    // the table is sized by the cone, rather than by the AIG
+    int *        pTable;     // hash table of pairs (object ID + 1, truth table index)
+    int          nTableMask; // hash table mask
+    Vec_Int_t *  vSlots;     // the slots used by the current cone
+} Cnf_StreamThData_t;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Appends the DIMACS literal to the text.]
+
+  Description [Formats the integer without stdio.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Cnf_StreamPushLit( Vec_Str_t * vText, int Lit, char * pPol )
+{
+    char Digits[16];
+    int nDigits = 0, Var = Abc_Lit2Var(Lit);
+    unsigned Num = (unsigned)Var + 1;
+    if ( Abc_LitIsCompl(Lit) ^ (pPol ? pPol[Var] : 0) )
+        Vec_StrPush( vText, '-' );
+    do Digits[nDigits++] = (char)('0' + Num % 10); while ( (Num /= 10) );
+    while ( nDigits )
+        Vec_StrPush( vText, Digits[--nDigits] );
+    Vec_StrPush( vText, ' ' );
+}
+static inline void Cnf_StreamPushClauses( Cnf_StreamThData_t * pThData, Vec_Int_t * vClauses )
+{
+    int k, Entry;
+    Vec_IntForEachEntry( vClauses, Entry, k )
+    {
+        if ( Entry == 0 )
+        {
+            if ( k > 0 )
+                Vec_StrPush( pThData->vText, '0' ), Vec_StrPush( pThData->vText, '\n' );
+            pThData->nClauses++;
+        }
+        else
+            Cnf_StreamPushLit( pThData->vText, Entry, pThData->pPol );
+    }
+    if ( Vec_IntSize(vClauses) > 0 )
+        Vec_StrPush( pThData->vText, '0' ), Vec_StrPush( pThData->vText, '\n' );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hash table of the objects in the current cone.]
+
+  Description [Returns the pair (object ID + 1, index) of the object.
+  The entry is added if it is not there.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Cnf_StreamTableFind( Cnf_StreamThData_t * p, int Id )
+{
+    int i = (int)(((unsigned)Id * 2654435761u) & (unsigned)p->nTableMask);
+    while ( p->pTable[2*i] && p->pTable[2*i] != Id + 1 )
+        i = (i + 1) & p->nTableMask;
+    return p->pTable + 2*i;
+}
+static void Cnf_StreamTableResize( Cnf_StreamThData_t * p )
+{
+    int * pOld = p->pTable, * pEntry, i, iSlot;
+    p->nTableMask = 2 * p->nTableMask + 1;
+    p->pTable = ABC_CALLOC( int, 2 * (p->nTableMask + 1) );
+    Vec_IntForEachEntry( p->vSlots, iSlot, i )
+    {
+        pEntry = Cnf_StreamTableFind( p, pOld[2*iSlot] - 1 );
+        pEntry[0] = pOld[2*iSlot];
+        pEntry[1] = pOld[2*iSlot+1];
+        Vec_IntWriteEntry( p->vSlots, i, (int)(pEntry - p->pTable) / 2 );
+    }
+    ABC_FREE( pOld );
+}
+static inline int * Cnf_StreamTableInsert( Cnf_StreamThData_t * p, int Id )
+{
+    int * pEntry = Cnf_StreamTableFind( p, Id );
+    if ( pEntry[0] )
+        return pEntry;
+    pEntry[0] = Id + 1;
+    pEntry[1] = -1;
+    Vec_IntPush( p->vSlots, (int)(pEntry - p->pTable) / 2 );
+    if ( 2 * Vec_IntSize(p->vSlots) <= p->nTableMask )
+        return pEntry;
+    Cnf_StreamTableResize( p );
+    return Cnf_StreamTableFind( p, Id );
+}
+static inline void Cnf_StreamTableClear( Cnf_StreamThData_t * p )
+{
+    int i, iSlot;
+    Vec_IntForEachEntry( p->vSlots, iSlot, i )
+        p->pTable[2*iSlot] = 0;
+    Vec_IntClear( p->vSlots );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects nodes inside the cone.]
+
+  Description [Same as Cnf_CollectVolume() but does not use traversal IDs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_StreamCollectVolume_rec( Cnf_StreamThData_t * pThData, Aig_Obj_t * pObj )
+{
+    if ( Cnf_StreamTableFind(pThData, Aig_ObjId(pObj))[0] )
+        return;
+    Cnf_StreamTableInsert( pThData, Aig_ObjId(pObj) );
+    assert( Aig_ObjIsNode(pObj) );
+    Cnf_StreamCollectVolume_rec( pThData, Aig_ObjFanin0(pObj) );
+    Cnf_StreamCollectVolume_rec( pThData, Aig_ObjFanin1(pObj) );
+    Vec_PtrPush( pThData->vNodes, pObj );
+}
+static void Cnf_StreamCollectVolume( Cnf_StreamThData_t * pThData, Aig_Obj_t * pRoot )
+{
+    Aig_Obj_t * pObj;
+    int i;
+    Cnf_StreamTableClear( pThData );
+    Vec_PtrForEachEntry( Aig_Obj_t *, pThData->vLeaves, pObj, i )
+        Cnf_StreamTableInsert( pThData, Aig_ObjId(pObj) );
+    Vec_PtrClear( pThData->vNodes );
+    Cnf_StreamCollectVolume_rec( pThData, pRoot );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derive truth table.]
+
+  Description [Same as Cnf_CutDeriveTruth() but does not write into the objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Cnf_StreamDeriveTruth( Cnf_StreamThData_t * pThData )
+{
+    static word Truth6[6] = {
+        ABC_CONST(0xAAAAAAAAAAAAAAAA),
+        ABC_CONST(0xCCCCCCCCCCCCCCCC),
+        ABC_CONST(0xF0F0F0F0F0F0F0F0),
+        ABC_CONST(0xFF00FF00FF00FF00),
+        ABC_CONST(0xFFFF0000FFFF0000),
+        ABC_CONST(0xFFFFFFFF00000000)
+    };
+    word C[2] = { 0, ~(word)0 }, S[256];
+    Vec_Ptr_t * vLeaves = pThData->vLeaves;
+    int i, iObj = 0;
+    Aig_Obj_t * pObj = NULL;
+    assert( Vec_PtrSize(vLeaves) <= 6 && Vec_PtrSize(pThData->vNodes) > 0 );
+    assert( Vec_PtrSize(vLeaves) + Vec_PtrSize(pThData->vNodes) <= 256 );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pObj, i )
+    {
+        Cnf_StreamTableFind( pThData, Aig_ObjId(pObj) )[1] = iObj;
+        S[iObj++] = Truth6[i];
+    }
+    Vec_PtrForEachEntry( Aig_Obj_t *, pThData->vNodes, pObj, i )
+    {
+        Cnf_StreamTableFind( pThData, Aig_ObjId(pObj) )[1] = iObj;
+        S[iObj++] = (S[Cnf_StreamTableFind(pThData, Aig_ObjFaninId0(pObj))[1]] ^ C[Aig_ObjFaninC0(pObj)]) &
+                    (S[Cnf_StreamTableFind(pThData, Aig_ObjFaninId1(pObj))[1]] ^ C[Aig_ObjFaninC1(pObj)]);
+    }
+    return S[iObj-1];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes clauses of one node.]
+
+  Description [Same as Cnf_ComputeClauses() but can be called by
+  several threads at the same time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_StreamComputeClauses( Cnf_StreamThData_t * pThData, Aig_Obj_t * pRoot )
+{
+    Vec_Ptr_t * vLeaves  = pThData->vLeaves;
+    Vec_Int_t * vClauses = pThData->vClauses;
+    Vec_Int_t * vCover   = pThData->vCover;
+    int * pMap = pThData->pMap;
+    Aig_Obj_t * pLeaf;
+    int c, k, Cube, OutLit, RetValue;
+    word Truth;
+    assert( pRoot->fMarkA );
+
+    Vec_IntClear( vClauses );
+
+    OutLit = Abc_Var2Lit( pMap[Aig_ObjId(pRoot)], 0 );
+    // detect cone
+    Cnf_CollectLeaves( pRoot, vLeaves, 0 );
+    Cnf_StreamCollectVolume( pThData, pRoot );
+    assert( pRoot == Vec_PtrEntryLast(pThData->vNodes) );
+    // check if this is an AND-gate
+    Vec_PtrForEachEntry( Aig_Obj_t *, pThData->vNodes, pLeaf, k )
+    {
+        if ( Aig_ObjFaninC0(pLeaf) && !Aig_ObjFanin0(pLeaf)->fMarkA )
+            break;
+        if ( Aig_ObjFaninC1(pLeaf) && !Aig_ObjFanin1(pLeaf)->fMarkA )
+            break;
+    }
+    if ( k == Vec_PtrSize(pThData->vNodes) )
+    {
+        Cnf_CollectLeaves( pRoot, vLeaves, 1 );
+        // write big clause
+        Vec_IntPush( vClauses, 0 );
+        Vec_IntPush( vClauses, OutLit );
+        Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pLeaf, k )
+            Vec_IntPush( vClauses, Abc_Var2Lit(pMap[Aig_ObjId(Aig_Regular(pLeaf))], !Aig_IsComplement(pLeaf)) );
+        // write small clauses
+        Vec_PtrForEachEntry( Aig_Obj_t *, vLeaves, pLeaf, k )
+        {
+            Vec_IntPush( vClauses, 0 );
+            Vec_IntPush( vClauses, OutLit ^ 1 );
+            Vec_IntPush( vClauses, Abc_Var2Lit(pMap[Aig_ObjId(Aig_Regular(pLeaf))], Aig_IsComplement(pLeaf)) );
+        }
+        return;
+    }
+    assert( Vec_PtrSize(vLeaves) <= 6 );
+
+    Truth = Cnf_StreamDeriveTruth( pThData );
+    if ( Truth == 0 || Truth == ~(word)0 )
+    {
+        Vec_IntPush( vClauses, 0 );
+        Vec_IntPush( vClauses, (Truth == 0) ? (OutLit ^ 1) : OutLit );
+        return;
+    }
+
+    RetValue = Kit_TruthIsop( (unsigned *)&Truth, Vec_PtrSize(vLeaves), vCover, 0 );
+    assert( RetValue >= 0 );
+    Vec_IntForEachEntry( vCover, Cube, c )
+    {
+        Vec_IntPush( vClauses, 0 );
+        Vec_IntPush( vClauses, OutLit );
+        for ( k = 0; k < Vec_PtrSize(vLeaves); k++, Cube >>= 2 )
+        {
+            if ( (Cube & 3) == 0 )
+                continue;
+            assert( (Cube & 3) != 3 );
+            Vec_IntPush( vClauses, Abc_Var2Lit(pMap[Aig_ObjId((Aig_Obj_t *)Vec_PtrEntry(vLeaves,k))], (Cube&3)!=1) );
+        }
+    }
+
+    Truth = ~Truth;
+
+    RetValue = Kit_TruthIsop( (unsigned *)&Truth, Vec_PtrSize(vLeaves), vCover, 0 );
+    assert( RetValue >= 0 );
+    Vec_IntForEachEntry( vCover, Cube, c )
+    {
+        Vec_IntPush( vClauses, 0 );
+        Vec_IntPush( vClauses, OutLit ^ 1 );
+        for ( k = 0; k < Vec_PtrSize(vLeaves); k++, Cube >>= 2 )
+        {
+            if ( (Cube & 3) == 0 )
+                continue;
+            assert( (Cube & 3) != 3 );
+            Vec_IntPush( vClauses, Abc_Var2Lit(pMap[Aig_ObjId((Aig_Obj_t *)Vec_PtrEntry(vLeaves,k))], (Cube&3)!=1) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Formats the clauses of the roots assigned to the thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_StreamProcessRange( Cnf_StreamThData_t * pThData )
+{
+    Aig_Obj_t * pObj;
+    int i;
+    Vec_StrClear( pThData->vText );
+    pThData->nClauses = 0;
+    for ( i = pThData->iStart; i < pThData->iStop; i++ )
+    {
+        pObj = (Aig_Obj_t *)Vec_PtrEntry( pThData->vRoots, i );
+        Cnf_StreamComputeClauses( pThData, pObj );
+        Cnf_StreamPushClauses( pThData, pThData->vClauses );
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+static void * Cnf_StreamWorkerThread( void * pArg )
+{
+    Cnf_StreamProcessRange( (Cnf_StreamThData_t *)pArg );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the CNF header.]
+
+  Description [The clause count is padded, so that it can be
+  overwritten in place when the count is known.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_StreamWriteHeader( FILE * pFile, int nVars, ABC_INT64_T nClauses )
+{
+    fprintf( pFile, "c Result of efficient AIG-to-CNF conversion using package CNF\n" );
+    fprintf( pFile, "p cnf %d %-*.0f\n", nVars, CNF_STREAM_HEADER, (double)nClauses );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the fast CNF and writes it into a DIMACS file.]
+
+  Description [Produces the same clauses as Cnf_DeriveFast() followed by
+  Cnf_DataWriteIntoFile(), without building Cnf_Dat_t. The roots are
+  split into blocks, whose clauses are derived and formatted by several
+  threads into separate buffers. The buffers are written in the order
+  of the blocks. Returns the number of clauses or -1 if the file cannot
+  be opened.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+ABC_INT64_T Cnf_DeriveFastStream( Aig_Man_t * p, char * pFileName, int fChangePol, int nProcs, int * pnVars )
+{
+    Cnf_StreamThData_t ThData[CNF_STREAM_THR_MAX];
+    Vec_Ptr_t * vRoots;
+    Vec_Int_t * vMap;
+    Vec_Str_t * vText;
+    Aig_Obj_t * pObj;
+    char * pPol = NULL;
+    ABC_INT64_T nClauses = 0;
+    FILE * pFile;
+    int i, k, nVars, nThreads, iRoot;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cnf_DeriveFastStream(): Output file \"%s\" cannot be opened.\n", pFileName );
+        return -1;
+    }
+    nProcs = Abc_MaxInt( 1, Abc_MinInt(nProcs, CNF_STREAM_THR_MAX) );
+    // mark the nodes with clauses
+    Aig_ManCleanMarkAB( p );
+    Cnf_DeriveFastMark( p );
+    // assign variables in the same order as Cnf_DeriveFastClauses()
+    vMap = Vec_IntStartFull( Aig_ManObjNumMax(p) );
+    vRoots = Vec_PtrAlloc( Aig_ManNodeNum(p) );
+    nVars = 1;
+    Aig_ManForEachNodeReverse( p, pObj, i )
+        if ( pObj->fMarkA )
+        {
+            Vec_IntWriteEntry( vMap, Aig_ObjId(pObj), nVars++ );
+            Vec_PtrPush( vRoots, pObj );
+        }
+    Aig_ManForEachCi( p, pObj, i )
+        Vec_IntWriteEntry( vMap, Aig_ObjId(pObj), nVars++ );
+    Vec_IntWriteEntry( vMap, Aig_ObjId(Aig_ManConst1(p)), nVars++ );
+    // the polarity applied by Cnf_DataTranformPolarity()
+    if ( fChangePol )
+    {
+        pPol = ABC_CALLOC( char, nVars );
+        Aig_ManForEachObj( p, pObj, i )
+            if ( !Aig_ObjIsCo(pObj) && Vec_IntEntry(vMap, Aig_ObjId(pObj)) >= 0 )
+                pPol[Vec_IntEntry(vMap, Aig_ObjId(pObj))] = (char)pObj->fPhase;
+    }
+    Cnf_StreamWriteHeader( pFile, nVars, 0 );
+    // start the threads' data
+    memset( ThData, 0, sizeof(ThData) );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        ThData[k].p        = p;
+        ThData[k].vRoots   = vRoots;
+        ThData[k].pMap     = Vec_IntArray( vMap );
+        ThData[k].pPol     = pPol;
+        ThData[k].vText    = Vec_StrAlloc( 1 << 20 );
+        ThData[k].vLeaves  = Vec_PtrAlloc( 100 );
+        ThData[k].vNodes   = Vec_PtrAlloc( 100 );
+        ThData[k].vCover   = Vec_IntAlloc( 1 << 16 );
+        ThData[k].vClauses = Vec_IntAlloc( 100 );
+        ThData[k].nTableMask = (1 << 10) - 1;
+        ThData[k].pTable   = ABC_CALLOC( int, 2 * (ThData[k].nTableMask + 1) );
+        ThData[k].vSlots   = Vec_IntAlloc( 1 << 9 );
+    }
+    // derive the clauses of the nodes, one round of blocks at a time
+    for ( iRoot = 0; iRoot < Vec_PtrSize(vRoots); )
+    {
+        for ( nThreads = 0; nThreads < nProcs && iRoot < Vec_PtrSize(vRoots); nThreads++ )
+        {
+            ThData[nThreads].iStart = iRoot;
+            ThData[nThreads].iStop  = iRoot = Abc_MinInt( iRoot + CNF_STREAM_BLOCK, Vec_PtrSize(vRoots) );
+        }
+#ifdef ABC_USE_PTHREADS
+        if ( nThreads > 1 )
+        {
+            pthread_t WorkerThread[CNF_STREAM_THR_MAX];
+            int status;
+            for ( k = 1; k < nThreads; k++ )
+            {
+                status = pthread_create( WorkerThread + k, NULL, Cnf_StreamWorkerThread, (void *)(ThData + k) );  assert( status == 0 );
+            }
+            Cnf_StreamProcessRange( ThData + 0 );
+            for ( k = 1; k < nThreads; k++ )
+            {
+                status = pthread_join( WorkerThread[k], NULL );  assert( status == 0 );
+            }
+        }
+        else
+#endif
+        for ( k = 0; k < nThreads; k++ )
+            Cnf_StreamProcessRange( ThData + k );
+        for ( k = 0; k < nThreads; k++ )
+        {
+            fwrite( Vec_StrArray(ThData[k].vText), 1, (size_t)Vec_StrSize(ThData[k].vText), pFile );
+            nClauses += ThData[k].nClauses;
+        }
+    }
+    // write the clauses of the outputs and the constant
+    vText = ThData[0].vText;
+    Vec_StrClear( vText );
+    Aig_ManForEachCo( p, pObj, i )
+    {
+        Cnf_StreamPushLit( vText, Abc_Var2Lit(Vec_IntEntry(vMap, Aig_ObjFaninId0(pObj)), Aig_ObjFaninC0(pObj)), pPol );
+        Vec_StrPush( vText, '0' ), Vec_StrPush( vText, '\n' );
+    }
+    Cnf_StreamPushLit( vText, Abc_Var2Lit(Vec_IntEntry(vMap, Aig_ObjId(Aig_ManConst1(p))), 0), pPol );
+    Vec_StrPush( vText, '0' ), Vec_StrPush( vText, '\n' );
+    Vec_StrPush( vText, '\n' );
+    fwrite( Vec_StrArray(vText), 1, (size_t)Vec_StrSize(vText), pFile );
+    nClauses += Aig_ManCoNum(p) + 1;
+    // update the header
+    rewind( pFile );
+    Cnf_StreamWriteHeader( pFile, nVars, nClauses );
+    fclose( pFile );
+    // cleanup
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Vec_StrFree( ThData[k].vText );
+        Vec_PtrFree( ThData[k].vLeaves );
+        Vec_PtrFree( ThData[k].vNodes );
+        Vec_IntFree( ThData[k].vCover );
+        Vec_IntFree( ThData[k].vClauses );
+        ABC_FREE( ThData[k].pTable );
+        Vec_IntFreeP( &ThData[k].vSlots );
+    }
+    Aig_ManCleanMarkA( p );
+    Vec_PtrFree( vRoots );
+    Vec_IntFree( vMap );
+    ABC_FREE( pPol );
+    if ( pnVars )
+        *pnVars = nVars;
+    return nClauses;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -0,0 +1,244 @@
+//===--- portfolio.c --------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+
+#include "act_var.h"
+#include "solver.h"
+#include "utils/mem.h"
+
+#include "misc/util/abc_global.h"
+#include "misc/util/utilPth.h"
+
+#ifdef ABC_USE_PTHREADS
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+//===------------------------------------------------------------------------===
+// Clause exchange (used by the solver)
+//===------------------------------------------------------------------------===
+void solver_share_export(solver_t *s, unsigned *lits, unsigned size)
+{
+    struct satoko_share *share = s->share;
+    word pos = ABC_FETCH_ADD64(&share->head, 1);
+    struct share_slot *slot = share->slots + (pos & share->mask);
+
+    assert(size <= SHARE_MAX_LITS);
+    slot->seq = 2 * pos + 1;
+    ABC_FENCE();
+    slot->owner = s->share_id;
+    slot->size = size;
+    memcpy(slot->lits, lits, sizeof(unsigned) * size);
+    ABC_FENCE();
+    slot->seq = 2 * pos + 2;
+    s->stats.n_exported++;
+}
+
+/** Adds a clause learnt by another solver. Must be called at level 0.
+ *  Returns SATOKO_UNSAT if the clause is falsified, SATOKO_OK if it became
+ *  a unit, and SATOKO_ERR otherwise.
+ */
+static int solver_share_add(solver_t *s, unsigned *lits, unsigned size)
+{
+    unsigned i, cref;
+
+    vec_uint_clear(s->temp_lits);
+    for (i = 0; i < size; i++) {
+        if (lit2var(lits[i]) >= vec_char_size(s->assigns))
+            return SATOKO_ERR;
+        if (lit_value(s, lits[i]) == SATOKO_LIT_TRUE)
+            return SATOKO_ERR;
+        if (lit_value(s, lits[i]) != SATOKO_LIT_FALSE)
+            vec_uint_push_back(s->temp_lits, lits[i]);
+    }
+    s->stats.n_imported++;
+    if (vec_uint_size(s->temp_lits) == 0)
+        return SATOKO_UNSAT;
+    if (vec_uint_size(s->temp_lits) == 1) {
+        solver_enqueue(s, vec_uint_at(s->temp_lits, 0), UNDEF);
+        return SATOKO_OK;
+    }
+    cref = solver_clause_create(s, s->temp_lits, 1);
+    clause_watch(s, cref);
+    return SATOKO_ERR;
+}
+
+/** Reads the clauses published since the last call.
+ *  Returns SATOKO_UNSAT if the problem became trivially unsatisfiable,
+ *  SATOKO_OK if new units should be propagated, and SATOKO_ERR otherwise.
+ */
+int solver_share_import(solver_t *s)
+{
+    struct satoko_share *share = s->share;
+    unsigned lits[SHARE_MAX_LITS];
+    unsigned owner, size;
+    int status, result = SATOKO_ERR;
+    word head = share->head;
+
+    assert(solver_dlevel(s) == 0);
+    if (solver_has_marks(s))
+        return SATOKO_ERR;
+    if (head - s->share_pos > share->mask + 1)
+        s->share_pos = head - share->mask - 1;
+    while (s->share_pos < head) {
+        struct share_slot *slot = share->slots + (s->share_pos & share->mask);
+        word seq = 2 * s->share_pos + 2;
+
+        if (slot->seq != seq) {
+            if (slot->seq < seq)
+                break; /* Not yet published */
+            s->share_pos++; /* Overwritten */
+            continue;
+        }
+        ABC_FENCE();
+        owner = slot->owner;
+        size = slot->size;
+        memcpy(lits, slot->lits, sizeof(unsigned) * size);
+        ABC_FENCE();
+        s->share_pos++;
+        if (slot->seq != seq || owner == s->share_id)
+            continue;
+        status = solver_share_add(s, lits, size);
+        if (status == SATOKO_UNSAT)
+            return SATOKO_UNSAT;
+        if (status == SATOKO_OK)
+            result = SATOKO_OK;
+    }
+    return result;
+}
+
+//===------------------------------------------------------------------------===
+// Portfolio API
+//===------------------------------------------------------------------------===
+satoko_share_t *satoko_share_create(unsigned max_size)
+{
+    satoko_share_t *share = satoko_calloc(satoko_share_t, 1);
+    share->slots = satoko_calloc(struct share_slot, (size_t)1 << SHARE_LOG_SLOTS);
+    share->mask = ((word)1 << SHARE_LOG_SLOTS) - 1;
+    share->max_size = max_size < SHARE_MAX_LITS ? max_size : SHARE_MAX_LITS;
+    share->winner = -1;
+    return share;
+}
+
+void satoko_share_destroy(satoko_share_t *share)
+{
+    satoko_free(share->slots);
+    satoko_free(share);
+}
+
+/** Connects the solver to the exchange. The solvers connected to the same
+ *  exchange must be built from the same clauses over the same variables.
+ */
+void satoko_share_attach(satoko_t *s, satoko_share_t *share, unsigned id)
+{
+    s->share = share;
+    s->share_id = id;
+    s->share_pos = share ? share->head : 0;
+}
+
+/** Makes the solver with the given id behave differently from the others by
+ *  changing its restart and decay parameters, its initial phase, and the
+ *  initial order of its decisions. Solver 0 is not changed.
+ */
+void satoko_diversify(satoko_t *s, unsigned id)
+{
+    unsigned var, seed = 0x9E3779B9u * (id + 1);
+
+    if (id == 0)
+        return;
+    s->opts.f_rst = 0.8 - (id % 5) * 0.05;
+    s->opts.b_rst = 1.4 - (id % 4) * 0.05;
+    s->opts.var_decay = 0.95 - (id % 3) * 0.02;
+    s->opts.garbage_max_ratio = (float) 0.3 + (id % 4) * 0.05;
+    for (var = 0; var < vec_char_size(s->polarity); var++) {
+        seed = seed * 1664525 + 1013904223;
+        if (id % 2)
+            vec_char_assign(s->polarity, var, !vec_char_at(s->polarity, var));
+        if (id > 1 && (seed >> 28) == 0)
+            var_act_bump(s, var);
+    }
+}
+
+#ifndef ABC_USE_PTHREADS
+
+int satoko_portfolio_solve(satoko_t **solvers, int n_solvers, int *winner)
+{
+    assert(n_solvers > 0);
+    if (winner)
+        *winner = 0;
+    return satoko_solve(solvers[0]);
+}
+
+#else // pthreads are used
+
+struct portfolio_thread {
+    satoko_t *solver;
+    int id;
+    int status;
+};
+
+static void *portfolio_worker(void *arg)
+{
+    struct portfolio_thread *data = (struct portfolio_thread *)arg;
+    satoko_t *s = data->solver;
+
+    data->status = satoko_solve(s);
+    if (data->status != SATOKO_UNDEC && ABC_CAS(&s->share->winner, -1, data->id))
+        s->share->f_stop = 1;
+    return NULL;
+}
+
+/** Solves the problem using several solvers concurrently. The solvers should
+ *  be attached to the same exchange. The first solver that finishes stops the
+ *  others; its status is returned and its index is written into 'winner'.
+ */
+int satoko_portfolio_solve(satoko_t **solvers, int n_solvers, int *winner)
+{
+    struct portfolio_thread *data = satoko_calloc(struct portfolio_thread, n_solvers);
+    pthread_t *threads = satoko_calloc(pthread_t, n_solvers);
+    satoko_share_t *share = solvers[0]->share;
+    int i, rc, status = SATOKO_UNDEC;
+
+    assert(n_solvers > 0 && share != NULL);
+    share->f_stop = 0;
+    share->winner = -1;
+    ABC_FENCE();
+    for (i = 0; i < n_solvers; i++) {
+        assert(solvers[i]->share == share);
+        data[i].solver = solvers[i];
+        data[i].id = i;
+        data[i].status = SATOKO_UNDEC;
+        rc = pthread_create(threads + i, NULL, portfolio_worker, (void *)(data + i));
+        assert(rc == 0);
+    }
+    for (i = 0; i < n_solvers; i++) {
+        rc = pthread_join(threads[i], NULL);
+        assert(rc == 0);
+    }
+    if (share->winner >= 0)
+        status = data[share->winner].status;
+    if (winner)
+        *winner = share->winner >= 0 ? share->winner : 0;
+    share->f_stop = 0;
+    satoko_free(threads);
+    satoko_free(data);
+    return status;
+}
+
+#endif // pthreads are used
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,42 @@
+//===--- portfolio.h --------------------------------------------------------===
+//
+//                     satoko: Satisfiability solver
+//
+// This file is distributed under the BSD 2-Clause License.
+// See LICENSE for details.
+//
+//===------------------------------------------------------------------------===
+#ifndef satoko__portfolio_h
+#define satoko__portfolio_h
+
+#include "misc/util/abc_global.h"
+ABC_NAMESPACE_HEADER_START
+
+#define SHARE_MAX_LITS 8
+#define SHARE_LOG_SLOTS 14
+
+/* One exchanged clause. The sequence number is odd while the slot is being
+ * written and equals 2 * (position + 1) once the clause at 'position' is
+ * published. */
+struct share_slot {
+    volatile word seq;
+    unsigned owner;
+    unsigned size;
+    unsigned lits[SHARE_MAX_LITS];
+};
+
+/* Bounded ring of clauses shared by the solvers of a portfolio. Writers
+ * reserve a position with an atomic increment of 'head', so the ring never
+ * blocks. Each reader keeps its own position and skips the clauses that
+ * were overwritten before it got to them. */
+struct satoko_share {
+    struct share_slot *slots;
+    word mask;
+    volatile word head;
+    unsigned max_size;  /* Largest clause exported (at most SHARE_MAX_LITS) */
+    volatile int f_stop;
+    volatile int winner;
+};
+
+ABC_NAMESPACE_HEADER_END
+#endif /* satoko__portfolio_h */
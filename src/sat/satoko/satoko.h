@@ -34,6 +34,9 @@ enum {
 struct solver_t_;
 typedef struct solver_t_ satoko_t;
 
+struct satoko_share;
+typedef struct satoko_share satoko_share_t;
+
 typedef struct satoko_opts satoko_opts_t;
 struct satoko_opts {
     /* Limits */
@@ -67,6 +70,9 @@ struct satoko_opts {
     float garbage_max_ratio;
     char verbose;
     char no_simplify;
+
+    /* Portfolio */
+    unsigned n_threads;  /* N.of diversified solvers run concurrently */
 };
 
 typedef struct satoko_stats satoko_stats_t;
@@ -83,6 +89,9 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    long n_exported;
+    long n_imported;
 };
 
 
@@ -143,6 +152,19 @@ extern int satoko_read_cex_varvalue(satoko_t *, int);
 extern abctime satoko_set_runtime_limit(satoko_t *, abctime);
 extern char satoko_var_polarity(satoko_t *, unsigned);
 
+/* Portfolio of solvers exchanging short learnt clauses.
+ * - The exchange keeps a bounded number of recent clauses with at most
+ *   'max_size' literals (and at most 8). Solvers attached to it export their
+ *   short learnt clauses and import those of the others on restarts.
+ * - The attached solvers must have the same clauses over the same variables.
+ * - satoko_portfolio_solve() runs the attached solvers in separate threads
+ *   and returns the status of the first one to finish. */
+extern satoko_share_t * satoko_share_create(unsigned max_size);
+extern void satoko_share_destroy(satoko_share_t *);
+extern void satoko_share_attach(satoko_t *, satoko_share_t *, unsigned id);
+extern void satoko_diversify(satoko_t *, unsigned id);
+extern int  satoko_portfolio_solve(satoko_t **, int n_solvers, int *winner);
+
 
 ABC_NAMESPACE_HEADER_END
 #endif /* satoko__satoko_h */
@@ -355,6 +355,8 @@ static inline void solver_handle_conflict(solver_t *s, unsigned confl_cref)
         cref = solver_clause_create(s, s->temp_lits, 1);
         clause_watch(s, cref);
     }
+    if (s->share && vec_uint_size(s->temp_lits) <= s->share->max_size)
+        solver_share_export(s, vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits));
     solver_enqueue(s, vec_uint_at(s->temp_lits, 0), cref);
     var_act_decay(s);
     clause_act_decay(s);
@@ -650,6 +652,14 @@ char solver_search(solver_t *s)
                 solver_cancel_until(s, 0);
                 return SATOKO_UNDEC;
             }
+            /* Import clauses learnt by other solvers of the portfolio */
+            if (s->share && solver_dlevel(s) == 0) {
+                int status = solver_share_import(s);
+                if (status == SATOKO_UNSAT)
+                    return SATOKO_UNSAT;
+                if (status == SATOKO_OK)
+                    continue; /* New units have to be propagated */
+            }
             if (!s->opts.no_simplify && solver_dlevel(s) == 0)
                 satoko_simplify(s);
 
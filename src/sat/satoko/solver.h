@@ -16,6 +16,7 @@
 
 #include "clause.h"
 #include "cdb.h"
+#include "portfolio.h"
 #include "satoko.h"
 #include "types.h"
 #include "watch_list.h"
@@ -106,6 +107,11 @@ struct solver_t_ {
     int     RunId;           
     int   (*pFuncStop)(int);  
 
+    /* Clause exchange with other solvers of a portfolio */
+    struct satoko_share *share;
+    unsigned share_id;
+    word share_pos; /* Next position to read from the exchange ring */
+
     struct satoko_stats stats;
     struct satoko_opts opts;
 };
@@ -115,6 +121,8 @@ extern unsigned solver_clause_create(solver_t *, vec_uint_t *, unsigned);
 extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
 extern unsigned solver_propagate(solver_t *);
+extern void solver_share_export(solver_t *, unsigned *, unsigned);
+extern int solver_share_import(solver_t *);
 
 /* Debuging */
 extern void solver_debug_check(solver_t *, int);
@@ -223,7 +231,7 @@ static inline int solver_has_marks(satoko_t *s)
 
 static inline int solver_stop(satoko_t *s)
 {
-    return s->pstop && *s->pstop;
+    return (s->pstop && *s->pstop) || (s->share && s->share->f_stop);
 }
 
 //===------------------------------------------------------------------------===
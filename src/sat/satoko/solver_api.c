@@ -188,6 +188,8 @@ void satoko_default_opts(satoko_opts_t *opts)
     opts->clause_min_lbd_bin_resol = 6;
 
     opts->garbage_max_ratio = (float) 0.3;
+    /* Portfolio */
+    opts->n_threads = 1;
 }
 
 /**